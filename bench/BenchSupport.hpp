@@ -0,0 +1,185 @@
+#pragma once
+#ifndef AIQUANT_BENCH_SUPPORT_HPP
+#define AIQUANT_BENCH_SUPPORT_HPP
+
+// Shared helpers for the benchmark executables: argument lookup, best-of-R
+// timing, synthetic tick/candle generators and text/JSON/CSV reporting.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "fin/core/Candle.hpp"
+#include "fin/core/CandleSeries.hpp"
+#include "fin/core/Tick.hpp"
+
+namespace fin::bench
+{
+    inline std::string arg_value(const std::vector<std::string> &args, const std::string &flag, const std::string &fallback)
+    {
+        for (std::size_t i = 0; i + 1 < args.size(); ++i)
+            if (args[i] == flag)
+                return args[i + 1];
+        return fallback;
+    }
+
+    inline bool has_flag(const std::vector<std::string> &args, const std::string &flag)
+    {
+        return std::find(args.begin(), args.end(), flag) != args.end();
+    }
+
+    // ------------------------------------------------------------ generators
+
+    inline constexpr long long kSyntheticStartMs = 1693492800000LL; // 2023-08-31 14:40 UTC
+    inline constexpr long long kSyntheticTickStepMs = 700;
+
+    // Deterministic random-walk-ish close for bar/tick i (no RNG state, so
+    // every benchmark sees the same series for the same i).
+    inline double synthetic_close(std::size_t i)
+    {
+        return 100.0 + 5.0 * std::sin(0.013 * static_cast<double>(i)) + static_cast<double>(i % 11) * 0.1;
+    }
+
+    // n ticks of one symbol, ~0.7 s apart, prices on a 0.01 grid.
+    inline std::vector<fin::core::Tick> make_ticks(std::size_t n, const fin::core::Symbol &sym = fin::core::Symbol("ABC"))
+    {
+        std::vector<fin::core::Tick> ticks;
+        ticks.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const auto ms = kSyntheticStartMs + static_cast<long long>(i) * kSyntheticTickStepMs;
+            const double px = std::round(synthetic_close(i) * 100.0) / 100.0;
+            ticks.emplace_back(fin::core::Timestamp(std::chrono::milliseconds(ms)), sym,
+                               fin::core::Price(px), fin::core::Volume(static_cast<double>(1 + i % 5)));
+        }
+        return ticks;
+    }
+
+    // n one-minute candles with high/low around the synthetic close.
+    inline fin::core::CandleSeries make_candles(std::size_t n)
+    {
+        fin::core::CandleSeries series;
+        series.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double c = synthetic_close(i);
+            const double o = synthetic_close(i == 0 ? 0 : i - 1);
+            const double h = std::max(o, c) + 0.5 + static_cast<double>(i % 3) * 0.1;
+            const double l = std::min(o, c) - 0.5 - static_cast<double>(i % 5) * 0.1;
+            const auto ts = fin::core::Timestamp(std::chrono::minutes(kSyntheticStartMs / 60000 + static_cast<long long>(i)));
+            series.push_back(fin::core::Candle(ts, fin::core::Price(o), fin::core::Price(h), fin::core::Price(l),
+                                               fin::core::Price(c), fin::core::Volume(static_cast<double>(10 + i % 7))));
+        }
+        return series;
+    }
+
+    // Writes `rows` ticks as "Timestamp,symbol,price,volume" CSV (ms epoch).
+    inline void write_ticks_csv(const std::filesystem::path &path, std::size_t rows)
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "Timestamp,symbol,price,volume\n";
+        char line[96];
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            const auto ms = kSyntheticStartMs + static_cast<long long>(i) * kSyntheticTickStepMs;
+            const int n = std::snprintf(line, sizeof(line), "%lld,ABC,%.2f,%zu\n", ms, synthetic_close(i), 1 + i % 5);
+            out.write(line, n);
+        }
+    }
+
+    // --------------------------------------------------------------- timing
+
+    struct Result
+    {
+        std::string name;
+        std::size_t items = 0; // operations per repetition
+        std::size_t reps = 0;
+        double best_s = 0.0;   // fastest repetition
+        double checksum = 0.0; // folded outputs, keeps the work observable
+
+        double ns_per_op() const { return items ? best_s * 1e9 / static_cast<double>(items) : 0.0; }
+        double items_per_s() const { return best_s > 0.0 ? static_cast<double>(items) / best_s : 0.0; }
+    };
+
+    // Runs `body()` `reps` times and keeps the fastest; `body` performs `items`
+    // operations and returns a checksum of what it produced.
+    template <class Body>
+    Result measure(std::string name, std::size_t items, std::size_t reps, Body &&body)
+    {
+        Result r;
+        r.name = std::move(name);
+        r.items = items;
+        r.reps = std::max<std::size_t>(reps, 1);
+        r.best_s = 1e30;
+        for (std::size_t i = 0; i < r.reps; ++i)
+        {
+            const auto t0 = std::chrono::steady_clock::now();
+            r.checksum = static_cast<double>(body());
+            const auto t1 = std::chrono::steady_clock::now();
+            r.best_s = std::min(r.best_s, std::chrono::duration<double>(t1 - t0).count());
+        }
+        return r;
+    }
+
+    // ------------------------------------------------------------ reporting
+
+    inline void write_text(std::ostream &os, const std::vector<Result> &results)
+    {
+        std::size_t width = 8;
+        for (const auto &r : results)
+            width = std::max(width, r.name.size() + 2);
+        for (const auto &r : results)
+        {
+            os << std::left << std::setw(static_cast<int>(width)) << r.name << std::right
+               << std::setw(12) << r.items << " ops"
+               << std::setw(12) << std::fixed << std::setprecision(2) << r.ns_per_op() << " ns/op"
+               << std::setw(12) << std::setprecision(2) << r.items_per_s() / 1e6 << " Mops/s\n";
+        }
+    }
+
+    inline void write_csv(std::ostream &os, const std::vector<Result> &results)
+    {
+        os << "name,items,reps,best_s,ns_per_op,items_per_s,checksum\n";
+        os << std::setprecision(9);
+        for (const auto &r : results)
+            os << r.name << ',' << r.items << ',' << r.reps << ',' << r.best_s << ','
+               << r.ns_per_op() << ',' << r.items_per_s() << ',' << r.checksum << '\n';
+    }
+
+    inline void write_json(std::ostream &os, const std::string &suite, const std::vector<Result> &results)
+    {
+        // Names are plain identifiers (letters, digits, '.', '_'), no escaping needed.
+        os << std::setprecision(9);
+        os << "{\n  \"suite\": \"" << suite << "\",\n"
+#ifdef NDEBUG
+           << "  \"build\": \"release\",\n"
+#else
+           << "  \"build\": \"debug\",\n"
+#endif
+           << "  \"results\": [\n";
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            const auto &r = results[i];
+            os << "    {\"name\": \"" << r.name << "\", \"items\": " << r.items << ", \"reps\": " << r.reps
+               << ", \"best_s\": " << r.best_s << ", \"ns_per_op\": " << r.ns_per_op()
+               << ", \"items_per_s\": " << r.items_per_s() << ", \"checksum\": ";
+            if (std::isfinite(r.checksum))
+                os << r.checksum;
+            else
+                os << "null";
+            os << '}' << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        os << "  ]\n}\n";
+    }
+
+} // namespace fin::bench
+
+#endif // AIQUANT_BENCH_SUPPORT_HPP
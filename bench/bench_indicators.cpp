@@ -0,0 +1,98 @@
+// Streaming update() cost of the windowed indicators.
+//
+//   aiquant_bench_indicators [--samples N] [--period P] [--reps R]
+//
+// Feeds N synthetic bars (default 10'000'000) through SMA, ZScore,
+// BollingerBands, Momentum and Stochastic with window P (default 20) and
+// reports the best of R runs (default 3) in ns per update.
+// Build with -DCMAKE_BUILD_TYPE=Release for meaningful numbers.
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include "BenchSupport.hpp"
+
+#include "fin/indicators/BollingerBands.hpp"
+#include "fin/indicators/Momentum.hpp"
+#include "fin/indicators/SMA.hpp"
+#include "fin/indicators/Stochastic.hpp"
+#include "fin/indicators/ZScore.hpp"
+
+namespace
+{
+    using fin::bench::arg_value;
+
+    struct Bars
+    {
+        std::vector<double> high, low, close;
+    };
+
+    Bars make_bars(std::size_t n)
+    {
+        Bars b;
+        b.high.resize(n);
+        b.low.resize(n);
+        b.close.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double c = 100.0 + 5.0 * std::sin(0.013 * static_cast<double>(i)) + static_cast<double>(i % 11) * 0.1;
+            b.close[i] = c;
+            b.high[i] = c + 0.5 + static_cast<double>(i % 3) * 0.1;
+            b.low[i] = c - 0.5 - static_cast<double>(i % 5) * 0.1;
+        }
+        return b;
+    }
+
+    // `body(i)` returns something to fold into the checksum.
+    template <class Make, class Body>
+    void run(const char *name, std::size_t n, std::size_t reps, Make make, Body body)
+    {
+        double best = 1e30, checksum = 0.0;
+        for (std::size_t r = 0; r < reps; ++r)
+        {
+            auto ind = make();
+            checksum = 0.0;
+            const auto t0 = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < n; ++i)
+                checksum += body(ind, i);
+            const auto t1 = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+        }
+        std::cout << std::left << std::setw(16) << name << std::right
+                  << std::setw(10) << std::fixed << std::setprecision(2) << (best * 1e9 / static_cast<double>(n)) << " ns/update"
+                  << std::setw(10) << std::setprecision(3) << best << " s"
+                  << "  (checksum " << std::setprecision(3) << checksum << ")\n";
+    }
+}
+
+int main(int argc, char **argv)
+{
+    using namespace fin::indicators;
+    std::vector<std::string> args(argv + 1, argv + argc);
+    const std::size_t n = std::stoull(arg_value(args, "--samples", "10000000"));
+    const std::size_t p = std::max<std::size_t>(1, std::stoull(arg_value(args, "--period", "20")));
+    const std::size_t reps = std::max<std::size_t>(1, std::stoull(arg_value(args, "--reps", "3")));
+    const Bars b = make_bars(n);
+
+    std::cout << n << " updates, period " << p << "\n";
+    run("SMA", n, reps, [&]
+        { return SMA(p); }, [&](SMA &s, std::size_t i)
+        { return s.update(b.close[i]).value_or(0.0); });
+    run("ZScore", n, reps, [&]
+        { return ZScore(p); }, [&](ZScore &s, std::size_t i)
+        { return s.update(b.close[i]).value_or(0.0); });
+    run("BollingerBands", n, reps, [&]
+        { return BollingerBands(p, 2.0); }, [&](BollingerBands &s, std::size_t i)
+        { auto v = s.update(b.close[i]); return v ? v->upper : 0.0; });
+    run("Momentum", n, reps, [&]
+        { return Momentum(p); }, [&](Momentum &s, std::size_t i)
+        { return s.update(b.close[i]).value_or(0.0); });
+    run("Stochastic", n, reps, [&]
+        { return Stochastic(p, 3); }, [&](Stochastic &s, std::size_t i)
+        { auto v = s.update(b.high[i], b.low[i], b.close[i]); return v ? v->d : 0.0; });
+    return 0;
+}
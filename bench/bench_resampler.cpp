@@ -0,0 +1,90 @@
+// Resampler throughput: double Price path vs integer-ticks FixedPrice path.
+//
+//   aiquant_bench_resampler [--ticks N] [--reps R]
+//
+// Ticks are generated in memory (default 10'000'000, ~0.7 s apart, 0.01 tick
+// size) and fed to TickToCandleResampler and FixedTickToCandleResampler at
+// M1; each path is run R times (default 5) and the best time is reported.
+// Build with -DCMAKE_BUILD_TYPE=Release for meaningful numbers.
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include "BenchSupport.hpp"
+
+#include "fin/io/Resampler.hpp"
+
+namespace
+{
+    using fin::bench::arg_value;
+
+    template <class Resampler, class TickVec>
+    void run(const char *name, const TickVec &ticks, std::size_t reps)
+    {
+        double best = 1e30;
+        std::size_t candles = 0;
+        double checksum = 0.0;
+        for (std::size_t r = 0; r < reps; ++r)
+        {
+            const auto t0 = std::chrono::steady_clock::now();
+            Resampler res(fin::io::Timeframe::M1);
+            candles = 0;
+            checksum = 0.0;
+            for (const auto &t : ticks)
+                if (auto c = res.update(t))
+                {
+                    ++candles;
+                    checksum += c->volume().value();
+                }
+            if (auto c = res.flush())
+            {
+                ++candles;
+                checksum += c->volume().value();
+            }
+            const auto t1 = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+        }
+
+        std::cout << std::left << std::setw(12) << name
+                  << std::right << std::setw(12) << ticks.size() << " ticks"
+                  << std::setw(10) << candles << " candles"
+                  << std::setw(10) << std::fixed << std::setprecision(3) << best << " s"
+                  << std::setw(10) << std::setprecision(2) << (static_cast<double>(ticks.size()) / best / 1e6) << " Mticks/s"
+                  << "  (checksum " << std::setprecision(0) << checksum << ")\n";
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<std::string> args(argv + 1, argv + argc);
+    const std::size_t n = std::stoull(arg_value(args, "--ticks", "10000000"));
+    const std::size_t reps = std::max<std::size_t>(1, std::stoull(arg_value(args, "--reps", "5")));
+
+    const fin::core::Symbol sym("ABC");
+    fin::core::set_price_scale(sym, fin::core::PriceScale{100});
+
+    std::vector<fin::core::Tick> dticks;
+    std::vector<fin::core::FixedTick> fticks;
+    dticks.reserve(n);
+    fticks.reserve(n);
+    long long ms = 1693492800000LL;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        ms += 1 + static_cast<long long>(i % 7) * 200;
+        const fin::core::Tick t{fin::core::Timestamp(std::chrono::milliseconds(ms)), sym,
+                                fin::core::Price{100.0 + static_cast<double>(i % 1000) * 0.01},
+                                fin::core::Volume{1.0 + static_cast<double>(i % 17)}};
+        dticks.push_back(t);
+        fticks.push_back(fin::core::to_fixed(t));
+    }
+
+    std::cout << "sizeof Tick " << sizeof(fin::core::Tick) << " / FixedTick " << sizeof(fin::core::FixedTick)
+              << ", sizeof Candle " << sizeof(fin::core::Candle) << " / FixedCandle " << sizeof(fin::core::FixedCandle) << "\n";
+    run<fin::io::TickToCandleResampler>("double", dticks, reps);
+    run<fin::io::FixedTickToCandleResampler>("fixed", fticks, reps);
+    return 0;
+}
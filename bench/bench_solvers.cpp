@@ -0,0 +1,191 @@
+// Normal-equation solver cost as the feature count grows.
+//
+//   aiquant_bench_solvers [--features 8,32,...] [--reps R]
+//
+// For each feature count d (default 8,16,32,64,128,256,512) builds the
+// ridge system X'X + 1e-6 I from 4d random samples and times, best of R
+// runs (default 3):
+//   gauss_jordan  the previous LinearTrainer solver: pivoted Gauss-Jordan
+//                 over a vector-of-vectors matrix
+//   cholesky      fin::ml::cholesky_solve (blocked, flat row-major)
+//   qr            fin::ml::qr_solve (column-pivoted Householder)
+// reporting microseconds per solve and the relative residual |Ax - b| / |b|.
+// Build with -DCMAKE_BUILD_TYPE=Release for meaningful numbers.
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "BenchSupport.hpp"
+
+#include "fin/ml/LinearSolve.hpp"
+
+namespace
+{
+    using fin::bench::arg_value;
+
+    // The solver LinearTrainer used before the flat SPD path, kept verbatim
+    // as the baseline.
+    bool gauss_jordan(std::vector<std::vector<double>> &A, std::vector<double> &b)
+    {
+        const std::size_t n = A.size();
+        for (std::size_t col = 0; col < n; ++col)
+        {
+            std::size_t pivot = col;
+            double max_val = std::fabs(A[pivot][col]);
+            for (std::size_t row = col + 1; row < n; ++row)
+            {
+                double v = std::fabs(A[row][col]);
+                if (v > max_val)
+                {
+                    max_val = v;
+                    pivot = row;
+                }
+            }
+            if (max_val < 1e-12)
+                return false;
+            if (pivot != col)
+            {
+                std::swap(A[pivot], A[col]);
+                std::swap(b[pivot], b[col]);
+            }
+            const double inv_pivot = 1.0 / A[col][col];
+            for (std::size_t j = col; j < n; ++j)
+                A[col][j] *= inv_pivot;
+            b[col] *= inv_pivot;
+            for (std::size_t row = 0; row < n; ++row)
+            {
+                if (row == col)
+                    continue;
+                const double factor = A[row][col];
+                if (factor == 0.0)
+                    continue;
+                for (std::size_t j = col; j < n; ++j)
+                    A[row][j] -= factor * A[col][j];
+                b[row] -= factor * b[col];
+            }
+        }
+        return true;
+    }
+
+    struct System
+    {
+        std::size_t n = 0;
+        std::vector<double> A; // flat row-major
+        std::vector<double> b;
+    };
+
+    // Ridge normal equations (with bias column) of 4d noisy samples whose
+    // features share a common factor, as engineered features tend to.
+    System make_system(std::size_t d)
+    {
+        std::mt19937 rng(static_cast<unsigned>(d));
+        std::normal_distribution<double> z(0.0, 1.0);
+
+        System sys;
+        sys.n = d + 1;
+        sys.A.assign(sys.n * sys.n, 0.0);
+        sys.b.assign(sys.n, 0.0);
+        std::vector<double> x(sys.n, 1.0); // x[d] is the bias column
+        for (std::size_t s = 0; s < 4 * d; ++s)
+        {
+            const double common = z(rng);
+            double y = 0.1 * z(rng);
+            for (std::size_t j = 0; j < d; ++j)
+            {
+                x[j] = 0.5 * common + z(rng);
+                y += x[j] * (static_cast<double>(j % 7) - 3.0);
+            }
+            for (std::size_t r = 0; r < sys.n; ++r)
+            {
+                for (std::size_t c = 0; c < sys.n; ++c)
+                    sys.A[r * sys.n + c] += x[r] * x[c];
+                sys.b[r] += x[r] * y;
+            }
+        }
+        for (std::size_t j = 0; j < d; ++j)
+            sys.A[j * sys.n + j] += 1e-6;
+        return sys;
+    }
+
+    double relative_residual(const System &sys, const std::vector<double> &x)
+    {
+        double num = 0.0, den = 0.0;
+        for (std::size_t i = 0; i < sys.n; ++i)
+        {
+            double r = -sys.b[i];
+            for (std::size_t j = 0; j < sys.n; ++j)
+                r += sys.A[i * sys.n + j] * x[j];
+            num += r * r;
+            den += sys.b[i] * sys.b[i];
+        }
+        return den > 0.0 ? std::sqrt(num / den) : std::sqrt(num);
+    }
+
+    // Runs `solve()` `iters` times per repetition; reports us/solve.
+    template <class Solve>
+    void run(const char *name, const System &sys, std::size_t reps, Solve solve)
+    {
+        const double n3 = static_cast<double>(sys.n) * sys.n * sys.n;
+        const std::size_t iters = std::max<std::size_t>(1, static_cast<std::size_t>(5e7 / n3));
+
+        std::vector<double> x;
+        const auto r = fin::bench::measure(name, iters, reps, [&]
+                                           {
+                                               double acc = 0.0;
+                                               for (std::size_t i = 0; i < iters; ++i)
+                                               {
+                                                   x = solve();
+                                                   acc += x[0];
+                                               }
+                                               return acc; });
+
+        std::cout << std::left << std::setw(6) << sys.n - 1 << std::setw(14) << name << std::right
+                  << std::setw(12) << std::fixed << std::setprecision(2) << r.ns_per_op() / 1e3 << " us/solve"
+                  << std::setw(14) << std::scientific << std::setprecision(2) << relative_residual(sys, x) << " residual\n"
+                  << std::defaultfloat;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<std::string> args(argv + 1, argv + argc);
+    const std::size_t reps = std::max<std::size_t>(1, std::stoull(arg_value(args, "--reps", "3")));
+
+    std::vector<std::size_t> dims;
+    std::stringstream list(arg_value(args, "--features", "8,16,32,64,128,256,512"));
+    for (std::string item; std::getline(list, item, ',');)
+        dims.push_back(std::stoull(item));
+
+    std::cout << "features solver            time      rel. residual\n";
+    for (std::size_t d : dims)
+    {
+        const System sys = make_system(d);
+
+        run("gauss_jordan", sys, reps, [&]
+            {
+                std::vector<std::vector<double>> A(sys.n, std::vector<double>(sys.n));
+                for (std::size_t i = 0; i < sys.n; ++i)
+                    std::copy_n(sys.A.begin() + static_cast<std::ptrdiff_t>(i * sys.n), sys.n, A[i].begin());
+                std::vector<double> b = sys.b;
+                gauss_jordan(A, b);
+                return b; });
+
+        run("cholesky", sys, reps, [&]
+            {
+                std::vector<double> A = sys.A, b = sys.b;
+                fin::ml::cholesky_solve(A, b);
+                return b; });
+
+        run("qr", sys, reps, [&]
+            {
+                std::vector<double> A = sys.A, b = sys.b;
+                fin::ml::qr_solve(A, b);
+                return b; });
+    }
+    return 0;
+}
@@ -0,0 +1,610 @@
+// Microbenchmark suite over every hot path of the library.
+//
+//   aiquant_bench [--ticks N] [--candles N] [--reps R] [--filter substr]
+//                 [--format text|json|csv] [--out path]
+//
+// Generates N synthetic ticks (default 2'000'000) and N one-minute candles
+// (default 1'000'000) in memory and times, best of R runs (default 3):
+//   io.*          FileTickSource CSV parse, TickToCandleResampler::update
+//   indicators.*  update() and compute() of every indicator, the compute_into()
+//                 batch kernels of SMA/EMA/BollingerBands/ZScore, FeatureBus::update
+//                 per row and appending into a FeatureMatrix, and the same
+//                 feature sets on the compile-time StaticFeatureBus vs the
+//                 runtime-configured DynamicFeatureBus; features plus the
+//                 backtester's EMAs/RSI computed separately vs through one
+//                 shared IndicatorGraph
+//   signal.*      SignalEngine::eval
+//   backtest.*    Backtester::on_candle
+//   ml.*          LinearModel::predict and bound predict_batch, training
+//                 from FeatureRows and from a FeatureMatrix,
+//                 rolling-window refits through RidgeAccumulator
+// Only cases whose name contains --filter run. Results are ns/op and items/s
+// per case; JSON/CSV output is meant to be archived and diffed between
+// releases. Build with -DCMAKE_BUILD_TYPE=Release for meaningful numbers.
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "BenchSupport.hpp"
+
+#include "fin/backtest/Backtester.hpp"
+#include "fin/indicators/ADX.hpp"
+#include "fin/indicators/ATR.hpp"
+#include "fin/indicators/BollingerBands.hpp"
+#include "fin/indicators/DynamicFeatureBus.hpp"
+#include "fin/indicators/EMA.hpp"
+#include "fin/indicators/FeatureBus.hpp"
+#include "fin/indicators/IndicatorGraph.hpp"
+#include "fin/indicators/MACD.hpp"
+#include "fin/indicators/Momentum.hpp"
+#include "fin/indicators/RSI.hpp"
+#include "fin/indicators/SMA.hpp"
+#include "fin/indicators/StaticFeatureBus.hpp"
+#include "fin/indicators/Stochastic.hpp"
+#include "fin/indicators/VWAP.hpp"
+#include "fin/indicators/ZScore.hpp"
+#include "fin/io/MultiTimeframeResampler.hpp"
+#include "fin/io/Resampler.hpp"
+#include "fin/io/Sources.hpp"
+#include "fin/ml/FeatureVector.hpp"
+#include "fin/ml/LinearTrainer.hpp"
+#include "fin/ml/RidgeAccumulator.hpp"
+#include "fin/signal/SignalEngine.hpp"
+
+namespace
+{
+    using fin::bench::Result;
+
+    class Suite
+    {
+    public:
+        Suite(std::size_t reps, std::string filter) : reps_(reps), filter_(std::move(filter)) {}
+
+        bool wants(const std::string &name) const { return filter_.empty() || name.find(filter_) != std::string::npos; }
+
+        template <class Body>
+        void run(const std::string &name, std::size_t items, Body &&body)
+        {
+            if (!wants(name))
+                return;
+            results_.push_back(fin::bench::measure(name, items, reps_, std::forward<Body>(body)));
+            std::cerr << "  " << name << " done\n";
+        }
+
+        const std::vector<Result> &results() const { return results_; }
+
+    private:
+        std::size_t reps_;
+        std::string filter_;
+        std::vector<Result> results_;
+    };
+
+    // Sums the engaged values of a vector<optional<T>> through `f`.
+    template <class T, class F>
+    double fold(const std::vector<std::optional<T>> &xs, F f)
+    {
+        double acc = 0.0;
+        for (const auto &x : xs)
+            if (x)
+                acc += f(*x);
+        return acc;
+    }
+
+    double identity(double x) { return x; }
+
+    void bench_io(Suite &suite, const std::vector<fin::core::Tick> &ticks)
+    {
+        if (suite.wants("io.file_tick_source.parse"))
+        {
+            const auto path = std::filesystem::temp_directory_path() / "aiquant_bench_suite_ticks.csv";
+            fin::bench::write_ticks_csv(path, ticks.size());
+            suite.run("io.file_tick_source.parse", ticks.size(), [&]
+                      {
+                          fin::io::FileTickSource src(path.string());
+                          double acc = 0.0;
+                          while (auto t = src.next())
+                              acc += t->price().value();
+                          return acc; });
+            std::filesystem::remove(path);
+        }
+
+        suite.run("io.resampler.update", ticks.size(), [&]
+                  {
+                      fin::io::TickToCandleResampler res(fin::io::Timeframe::M1);
+                      double acc = 0.0;
+                      for (const auto &t : ticks)
+                          if (auto c = res.update(t))
+                              acc += c->close().value();
+                      return acc; });
+
+        // Per-tick vs batched appends into a CandleSeries; batches are filled
+        // up front so only the resampling is timed.
+        suite.run("io.resampler.update_series", ticks.size(), [&]
+                  {
+                      fin::io::TickToCandleResampler res(fin::io::Timeframe::M1);
+                      fin::core::CandleSeries out;
+                      for (const auto &t : ticks)
+                          res.update(t, out);
+                      return static_cast<double>(out.size()); });
+
+        // Same M1 bars with the width as a compile-time constant.
+        suite.run("io.resampler.update_static", ticks.size(), [&]
+                  {
+                      fin::io::StaticTickToCandleResampler<std::chrono::minutes> res;
+                      fin::core::CandleSeries out;
+                      for (const auto &t : ticks)
+                          res.update(t, out);
+                      return static_cast<double>(out.size()); });
+
+        // Watermark mode on ordered ticks: the cost of the reorder ring.
+        suite.run("io.resampler.update_watermark", ticks.size(), [&]
+                  {
+                      fin::io::TickToCandleResampler res(fin::io::Timeframe::M1, std::chrono::seconds(2));
+                      fin::core::CandleSeries out;
+                      for (const auto &t : ticks)
+                          res.update(t, out);
+                      return static_cast<double>(out.size()); });
+
+        std::vector<fin::io::TickBatch> batches;
+        for (const auto &t : ticks)
+        {
+            if (batches.empty() || batches.back().full())
+                batches.emplace_back();
+            batches.back().push_back(t);
+        }
+        suite.run("io.resampler.update_batch", ticks.size(), [&]
+                  {
+                      fin::io::TickToCandleResampler res(fin::io::Timeframe::M1);
+                      fin::core::CandleSeries out;
+                      for (const auto &b : batches)
+                          res.update_batch(b, out);
+                      return static_cast<double>(out.size()); });
+
+        // M1 + M5 + H1: three passes over the ticks vs one cascading pass.
+        const std::vector<fin::io::Timeframe> tfs{fin::io::Timeframe::M1, fin::io::Timeframe::M5, fin::io::Timeframe::H1};
+        suite.run("io.multi_timeframe.separate", ticks.size(), [&]
+                  {
+                      double bars = 0.0;
+                      for (const auto tf : tfs)
+                      {
+                          fin::io::TickToCandleResampler res(tf);
+                          fin::core::CandleSeries out;
+                          for (const auto &b : batches)
+                              res.update_batch(b, out);
+                          res.flush(out);
+                          bars += static_cast<double>(out.size());
+                      }
+                      return bars; });
+        suite.run("io.multi_timeframe.cascade", ticks.size(), [&]
+                  {
+                      fin::io::MultiTimeframeResampler res(tfs);
+                      for (const auto &b : batches)
+                          res.update_batch(b);
+                      res.flush();
+                      double bars = 0.0;
+                      for (const auto tf : tfs)
+                          bars += static_cast<double>(res.series(tf).size());
+                      return bars; });
+    }
+
+    void bench_indicators(Suite &suite, const fin::core::CandleSeriesView &bars)
+    {
+        using namespace fin::indicators;
+        const std::size_t n = bars.size();
+
+        // compute_into() outputs, allocated once so only the kernels are timed.
+        std::vector<double> out(n), upper(n), lower(n), scratch(n);
+        auto tail_sum = [](const std::vector<double> &v, std::size_t from)
+        {
+            double acc = 0.0;
+            for (std::size_t i = from; i < v.size(); ++i)
+                acc += v[i];
+            return acc;
+        };
+
+        suite.run("indicators.sma.update", n, [&]
+                  {
+                      SMA ind(20);
+                      double acc = 0.0;
+                      for (std::size_t i = 0; i < n; ++i)
+                          acc += ind.update(bars.close[i]).value_or(0.0);
+                      return acc; });
+        suite.run("indicators.sma.compute", n, [&]
+                  { return fold(SMA::compute(bars.close, 20), identity); });
+        suite.run("indicators.sma.compute_into", n, [&]
+                  { return tail_sum(out, SMA::compute_into(bars.close, out, 20)); });
+
+        suite.run("indicators.ema.update", n, [&]
+                  {
+                      EMA ind(20);
+                      double acc = 0.0;
+                      for (std::size_t i = 0; i < n; ++i)
+                          acc += ind.update(bars.close[i]).value_or(0.0);
+                      return acc; });
+        suite.run("indicators.ema.compute", n, [&]
+                  { return fold(EMA::compute(bars.close, 20), identity); });
+        suite.run("indicators.ema.compute_into", n, [&]
+                  { return tail_sum(out, EMA::compute_into(bars.close, out, 20)); });
+
+        suite.run("indicators.rsi.update", n, [&]
+                  {
+                      RSI ind(14);
+                      double acc = 0.0;
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          ind.update(fin::core::Price(bars.close[i]));
+                          if (ind.is_ready())
+                              acc += ind.value();
+                      }
+                      return acc; });
+
+        suite.run("indicators.macd.update", n, [&]
+                  {
+                      MACD ind(12, 26, 9);
+                      double acc = 0.0;
+                      for (std::size_t i = 0; i < n; ++i)
+                          if (auto v = ind.update(bars.close[i]))
+                              acc += v->hist;
+                      return acc; });
+        suite.run("indicators.macd.compute", n, [&]
+                  { return fold(MACD::compute(bars.close, 12, 26, 9), [](const MACDValue &v)
+                                { return v.hist; }); });
+
+        suite.run("indicators.bollinger.update", n, [&]
+                  {
+                      BollingerBands ind(20, 2.0);
+                      double acc = 0.0;
+                      for (std::size_t i = 0; i < n; ++i)
+                          if (auto v = ind.update(bars.close[i]))
+                              acc += v->upper;
+                      return acc; });
+        suite.run("indicators.bollinger.compute", n, [&]
+                  { return fold(BollingerBands::compute(bars.close, 20, 2.0), [](const BollingerBands::Bands &b)
+                                { return b.upper; }); });
+        suite.run("indicators.bollinger.compute_into", n, [&]
+                  { return tail_sum(upper, BollingerBands::compute_into(bars.close, out, upper, lower, 20, 2.0)); });
+
+        suite.run("indicators.zscore.update", n, [&]
+                  {
+                      ZScore ind(20);
+                      double acc = 0.0;
+                      for (std::size_t i = 0; i < n; ++i)
+                          acc += ind.update(bars.close[i]).value_or(0.0);
+                      return acc; });
+        suite.run("indicators.zscore.compute", n, [&]
+                  { return fold(ZScore::compute(bars.close, 20), identity); });
+        suite.run("indicators.zscore.compute_into", n, [&]
+                  { return tail_sum(out, ZScore::compute_into(bars.close, out, 20)); });
+        suite.run("indicators.zscore.compute_into_scratch", n, [&]
+                  { return tail_sum(out, ZScore::compute_into(bars.close, out, scratch, 20)); });
+
+        suite.run("indicators.momentum.update", n, [&]
+                  {
+                      Momentum ind(10);
+                      double acc = 0.0;
+                      for (std::size_t i = 0; i < n; ++i)
+                          acc += ind.update(bars.close[i]).value_or(0.0);
+                      return acc; });
+        suite.run("indicators.momentum.compute", n, [&]
+                  { return fold(Momentum::compute(bars.close, 10), identity); });
+
+        suite.run("indicators.stochastic.update", n, [&]
+                  {
+                      Stochastic ind(14, 3);
+                      double acc = 0.0;
+                      for (std::size_t i = 0; i < n; ++i)
+                          if (auto v = ind.update(bars.high[i], bars.low[i], bars.close[i]))
+                              acc += v->d;
+                      return acc; });
+        suite.run("indicators.stochastic.compute", n, [&]
+                  { return fold(Stochastic::compute(bars.high, bars.low, bars.close, 14, 3), [](const StochOut &v)
+                                { return v.d; }); });
+
+        suite.run("indicators.atr.update", n, [&]
+                  {
+                      ATR ind(14);
+                      double acc = 0.0;
+                      for (std::size_t i = 0; i < n; ++i)
+                          acc += ind.update(bars.high[i], bars.low[i], bars.close[i]).value_or(0.0);
+                      return acc; });
+        suite.run("indicators.atr.compute", n, [&]
+                  { return fold(ATR::compute(bars.high, bars.low, bars.close, 14), identity); });
+
+        suite.run("indicators.adx.update", n, [&]
+                  {
+                      ADX ind(14);
+                      double acc = 0.0;
+                      for (std::size_t i = 0; i < n; ++i)
+                          if (auto v = ind.update(bars.high[i], bars.low[i], bars.close[i]))
+                              acc += v->adx;
+                      return acc; });
+        suite.run("indicators.adx.compute", n, [&]
+                  { return fold(ADX::compute(bars.high, bars.low, bars.close, 14), [](const ADXOut &v)
+                                { return v.adx; }); });
+
+        suite.run("indicators.vwap.update", n, [&]
+                  {
+                      VWAP ind;
+                      double acc = 0.0;
+                      for (std::size_t i = 0; i < n; ++i)
+                          acc += ind.update(bars.high[i], bars.low[i], bars.close[i], bars.volume[i]);
+                      return acc; });
+        suite.run("indicators.vwap.compute", n, [&]
+                  {
+                      double acc = 0.0;
+                      for (double v : VWAP::compute(bars.high, bars.low, bars.close, bars.volume))
+                          acc += v;
+                      return acc; });
+
+        suite.run("indicators.feature_bus.update", n, [&]
+                  {
+                      FeatureBus bus;
+                      double acc = 0.0;
+                      for (std::size_t i = 0; i < n; ++i)
+                          if (auto row = bus.update(bars.ts[i], bars.close[i]))
+                              acc += row->macd_hist;
+                      return acc; });
+
+        suite.run("indicators.feature_bus.update_matrix", n, [&]
+                  {
+                      FeatureBus bus;
+                      fin::core::FeatureMatrix out(FeatureBus::schema());
+                      out.reserve(n);
+                      bus.update(bars, out);
+                      return static_cast<double>(out.rows()); });
+
+        // Same sets, compile-time vs runtime composition; only the dispatch differs.
+        auto run_static = [&](auto &bus)
+        {
+            typename std::decay_t<decltype(bus)>::Row row{};
+            double acc = 0.0;
+            for (std::size_t i = 0; i < n; ++i)
+                if (bus.update(FeatureInput::from(bars, i), row))
+                    acc += row.back();
+            return acc;
+        };
+        auto run_dynamic = [&](DynamicFeatureBus &bus)
+        {
+            std::vector<double> row(bus.width());
+            double acc = 0.0;
+            for (std::size_t i = 0; i < n; ++i)
+                if (bus.update(FeatureInput::from(bars, i), row))
+                    acc += row.back();
+            return acc;
+        };
+
+        suite.run("indicators.feature_bus.static", n, [&]
+                  {
+                      FeatureBus::Static bus(FeatureBus::schema(), features::Close{}, features::Ema(12),
+                                             features::Rsi(14), features::Macd(12, 26, 9));
+                      return run_static(bus); });
+        suite.run("indicators.feature_bus.dynamic", n, [&]
+                  {
+                      DynamicFeatureBus bus(default_feature_specs());
+                      return run_dynamic(bus); });
+
+        // Default features plus the backtester's EMA(12), EMA(26), RSI(14):
+        // each reader on its own indicators, then all on one deduplicated graph.
+        suite.run("indicators.indicator_graph.separate", n, [&]
+                  {
+                      FeatureBus::Static bus(FeatureBus::schema(), features::Close{}, features::Ema(12),
+                                             features::Rsi(14), features::Macd(12, 26, 9));
+                      FeatureBus::Static::Row row{};
+                      EMA fast(12), slow(26);
+                      RSI rsi(14);
+                      double acc = 0.0;
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const auto in = FeatureInput::from(bars, i);
+                          if (bus.update(in, row))
+                              acc += row.back();
+                          fast.update(in.close);
+                          slow.update(in.close);
+                          rsi.update(fin::core::Price(in.close));
+                      }
+                      return acc + rsi.value(); });
+        suite.run("indicators.indicator_graph.shared", n, [&]
+                  {
+                      IndicatorGraph graph;
+                      DynamicFeatureBus bus(default_feature_specs(), graph);
+                      const auto fast = graph.ema(12), slow = graph.ema(26), rsi = graph.rsi(14);
+                      std::vector<double> row(bus.width());
+                      double acc = 0.0;
+                      for (std::size_t i = 0; i < n; ++i)
+                          if (bus.update(FeatureInput::from(bars, i), row))
+                              acc += row.back();
+                      return acc + graph.value(fast) + graph.value(slow) + graph.value(rsi); });
+
+        // close, ema, rsi, macd, bbands, atr, stoch, momentum
+        const auto wide = *parse_feature_specs("close,ema:12,rsi:14,macd,bbands,atr,stoch,momentum");
+        suite.run("indicators.feature_bus.static_wide", n, [&]
+                  {
+                      StaticFeatureBus<features::Close, features::Ema, features::Rsi, features::Macd,
+                                       features::Bollinger, features::Atr, features::Stoch, features::MomentumOf>
+                          bus(fin::core::FeatureSchema::make(feature_columns(wide)), features::Close{}, features::Ema(12),
+                              features::Rsi(14), features::Macd(), features::Bollinger(), features::Atr(),
+                              features::Stoch(), features::MomentumOf());
+                      return run_static(bus); });
+        suite.run("indicators.feature_bus.dynamic_wide", n, [&]
+                  {
+                      DynamicFeatureBus bus(wide);
+                      return run_dynamic(bus); });
+    }
+
+    void bench_signal_backtest(Suite &suite, const fin::core::CandleSeriesView &bars)
+    {
+        const std::size_t n = bars.size();
+
+        if (suite.wants("signal.signal_engine.eval"))
+        {
+            // Snapshots precomputed so only eval() is timed.
+            std::vector<fin::signal::IndicatorsSnapshot> snaps(n);
+            fin::indicators::EMA fast(12), slow(26);
+            fin::indicators::RSI rsi(14);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto &s = snaps[i];
+                s.ts = bars.ts[i];
+                s.close = bars.close[i];
+                s.ema_fast = fast.update(bars.close[i]);
+                s.ema_slow = slow.update(bars.close[i]);
+                rsi.update(fin::core::Price(bars.close[i]));
+                if (rsi.is_ready())
+                    s.rsi = rsi.value();
+            }
+            const fin::signal::SignalEngine engine{};
+            suite.run("signal.signal_engine.eval", n, [&]
+                      {
+                          double acc = 0.0;
+                          for (const auto &s : snaps)
+                              acc += engine.eval(s).score;
+                          return acc; });
+        }
+
+        suite.run("backtest.backtester.on_candle", n, [&]
+                  {
+                      fin::backtest::Backtester bt;
+                      for (std::size_t i = 0; i < n; ++i)
+                          bt.on_candle(bars.candle(i));
+                      return bt.finalize().final_cash; });
+    }
+
+    void bench_ml(Suite &suite, const fin::core::CandleSeriesView &bars)
+    {
+        if (!suite.wants("ml."))
+            return;
+
+        fin::indicators::FeatureBus bus;
+        const auto rows = bus.update(bars);
+        if (rows.size() < 3)
+            return;
+
+        std::vector<fin::ml::FeatureVector> features;
+        features.reserve(rows.size());
+        for (const auto &row : rows)
+            features.push_back(fin::ml::FeatureVector::from_feature_row(row));
+
+        const auto trained = fin::ml::train_linear_from_feature_rows(rows);
+        suite.run("ml.linear_model.predict", features.size(), [&]
+                  {
+                      double acc = 0.0;
+                      for (const auto &fv : features)
+                          acc += trained.model.predict(fv);
+                      return acc; });
+
+        fin::core::FeatureMatrix matrix(fin::indicators::FeatureBus::schema());
+        fin::indicators::FeatureBus{}.update(bars, matrix);
+        std::vector<double> predictions(matrix.rows());
+        suite.run("ml.linear_model.predict_batch", matrix.rows(), [&]
+                  {
+                      trained.model.predict_batch(matrix.view(), predictions);
+                      return predictions.back(); });
+
+        suite.run("ml.train_linear_from_feature_rows", rows.size(), [&]
+                  { return fin::ml::train_linear_from_feature_rows(rows).mse; });
+
+        suite.run("ml.train_linear_from_features", matrix.rows(), [&]
+                  { return fin::ml::train_linear_from_features(matrix.view()).mse; });
+
+        // One add, one remove and one solve per step over a 1000-row window.
+        constexpr std::size_t kWindow = 1000;
+        if (rows.size() > kWindow + 1)
+        {
+            const std::size_t steps = rows.size() - 1 - kWindow;
+            suite.run("ml.ridge_accumulator.rolling_refit", steps, [&]
+                      {
+                          auto sample = [&rows](std::size_t i)
+                          { return fin::ml::FeatureVector::feature_row_values(rows[i]); };
+                          auto target = [&rows](std::size_t i)
+                          { return rows[i + 1].close - rows[i].close; };
+
+                          fin::ml::RidgeAccumulator acc(fin::ml::FeatureVector::FeatureRowValues{}.size());
+                          for (std::size_t i = 0; i < kWindow; ++i)
+                              acc.add_sample(sample(i), target(i));
+                          double acc_bias = 0.0;
+                          for (std::size_t i = kWindow; i < kWindow + steps; ++i)
+                          {
+                              acc.add_sample(sample(i), target(i));
+                              acc.remove_sample(sample(i - kWindow), target(i - kWindow));
+                              acc_bias += acc.solve(1e-6).bias;
+                          }
+                          return acc_bias; });
+        }
+    }
+    // End-to-end per-candle loop: ticks -> S1 candles -> FeatureBus -> Backtester,
+    // all through the Tick / Candle / Price accessors (S1 keeps it candle-heavy).
+    void bench_pipeline(Suite &suite, const std::vector<fin::core::Tick> &ticks)
+    {
+        suite.run("pipeline.candle_loop", ticks.size(), [&]
+                  {
+                      fin::io::TickToCandleResampler res(fin::io::Timeframe::S1);
+                      fin::indicators::FeatureBus bus;
+                      fin::backtest::Backtester bt;
+                      double acc = 0.0;
+                      auto on_candle = [&](const fin::core::Candle &c)
+                      {
+                          if (auto row = bus.update(c))
+                              acc += row->ema_fast;
+                          bt.on_candle(c);
+                      };
+                      for (const auto &t : ticks)
+                          if (auto c = res.update(t))
+                              on_candle(*c);
+                      if (auto c = res.flush())
+                          on_candle(*c);
+                      return acc + bt.finalize().final_cash; });
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<std::string> args(argv + 1, argv + argc);
+    const std::size_t ticks_n = std::stoull(fin::bench::arg_value(args, "--ticks", "2000000"));
+    const std::size_t candles_n = std::stoull(fin::bench::arg_value(args, "--candles", "1000000"));
+    const std::size_t reps = std::max<std::size_t>(1, std::stoull(fin::bench::arg_value(args, "--reps", "3")));
+    const std::string format = fin::bench::arg_value(args, "--format", "text");
+    const std::string out_path = fin::bench::arg_value(args, "--out", "");
+
+    if (format != "text" && format != "json" && format != "csv")
+    {
+        std::cerr << "Unknown --format '" << format << "' (expected text, json or csv)\n";
+        return 2;
+    }
+
+    Suite suite(reps, fin::bench::arg_value(args, "--filter", ""));
+    const auto ticks = fin::bench::make_ticks(ticks_n);
+    const auto candles = fin::bench::make_candles(candles_n);
+    const auto bars = candles.view();
+
+    std::cerr << "aiquant_bench: " << ticks_n << " ticks, " << candles_n << " candles, best of " << reps << "\n";
+    bench_io(suite, ticks);
+    bench_indicators(suite, bars);
+    bench_signal_backtest(suite, bars);
+    bench_ml(suite, bars);
+    bench_pipeline(suite, ticks);
+
+    std::ofstream file;
+    if (!out_path.empty())
+    {
+        file.open(out_path);
+        if (!file)
+        {
+            std::cerr << "Cannot write " << out_path << "\n";
+            return 1;
+        }
+    }
+    std::ostream &os = out_path.empty() ? std::cout : file;
+    if (format == "json")
+        fin::bench::write_json(os, "aiquant_bench", suite.results());
+    else if (format == "csv")
+        fin::bench::write_csv(os, suite.results());
+    else
+        fin::bench::write_text(os, suite.results());
+    return 0;
+}
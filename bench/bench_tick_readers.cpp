@@ -0,0 +1,176 @@
+// Throughput comparison of the tick CSV readers (FileTickSource vs MmapTickSource),
+// of the separator scanner kernels (scalar / SSE2 / AVX2) behind the latter, and
+// of the chunked parallel ingest at 1, 2, 4, ... worker threads.
+//
+//   aiquant_bench_readers [--rows N] [--file path] [--keep] [--max-threads N]
+//
+// Without --file a synthetic ticks CSV with N rows (default 10'000'000) is
+// generated in the temp directory and removed afterwards unless --keep is set.
+// Build with -DCMAKE_BUILD_TYPE=Release for meaningful numbers.
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BenchSupport.hpp"
+
+#include "fin/io/MappedFile.hpp"
+#include "fin/io/ParallelIngest.hpp"
+#include "fin/io/Sources.hpp"
+
+namespace
+{
+    using fin::bench::arg_value;
+    using fin::bench::has_flag;
+
+    void write_synthetic_ticks(const std::filesystem::path &path, std::size_t rows)
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "Timestamp,symbol,price,volume\n";
+        long long ts = 1693492800000LL;
+        char line[96];
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            ts += 1 + static_cast<long long>(i % 7) * 13;
+            const double price = 100.0 + static_cast<double>(i % 1000) * 0.01;
+            const double volume = 1.0 + static_cast<double>(i % 17);
+            const int n = std::snprintf(line, sizeof(line), "%lld,ABC,%.2f,%.0f\n", ts, price, volume);
+            out.write(line, n);
+        }
+    }
+
+    void report(const char *name, const fin::io::ReadStats &st, double secs, double file_mb, double checksum)
+    {
+        std::cout << std::left << std::setw(16) << name
+                  << std::right << std::setw(12) << st.parsed << " ticks"
+                  << std::setw(10) << std::fixed << std::setprecision(3) << secs << " s"
+                  << std::setw(10) << std::setprecision(2) << (static_cast<double>(st.parsed) / secs / 1e6) << " Mticks/s"
+                  << std::setw(10) << (file_mb / secs) << " MB/s"
+                  << "  (checksum " << std::setprecision(0) << checksum << ")\n";
+    }
+
+    template <class Source, class... Extra>
+    void run(const char *name, const std::filesystem::path &path, double file_mb, Extra... extra)
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        Source src(path.string(), extra...);
+        double checksum = 0.0;
+        while (auto t = src.next())
+            checksum += t->price().value();
+        const auto t1 = std::chrono::steady_clock::now();
+        report(name, src.stats(), std::chrono::duration<double>(t1 - t0).count(), file_mb, checksum);
+    }
+
+    // Same as run(), reading through next_batch().
+    template <class Source, class... Extra>
+    void run_batched(const char *name, const std::filesystem::path &path, double file_mb, Extra... extra)
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        Source src(path.string(), extra...);
+        fin::io::TickBatch batch;
+        double checksum = 0.0;
+        while (src.next_batch(batch))
+            for (std::size_t i = 0; i < batch.size(); ++i)
+                checksum += batch.price()[i];
+        const auto t1 = std::chrono::steady_clock::now();
+        report(name, src.stats(), std::chrono::duration<double>(t1 - t0).count(), file_mb, checksum);
+    }
+
+    // Raw separator scan over the mapped file in 64 KB blocks (no row parsing).
+    void run_scan(fin::io::ScanKernel kernel, const fin::io::MappedFile &file)
+    {
+        constexpr std::size_t kBlock = 1u << 16;
+        std::vector<std::uint32_t> seps(kBlock);
+        const auto scan = fin::io::scan_function(kernel);
+
+        std::size_t found = 0;
+        const auto t0 = std::chrono::steady_clock::now();
+        for (std::size_t off = 0; off < file.size(); off += kBlock)
+            found += scan(file.data() + off, std::min(kBlock, file.size() - off), ',', seps.data());
+        const auto t1 = std::chrono::steady_clock::now();
+
+        const double secs = std::chrono::duration<double>(t1 - t0).count();
+        std::cout << "scan " << std::left << std::setw(11) << fin::io::scan_kernel_name(kernel)
+                  << std::right << std::setw(12) << found << " seps"
+                  << std::setw(10) << std::fixed << std::setprecision(3) << secs << " s"
+                  << std::setw(10) << std::setprecision(2) << (static_cast<double>(file.size()) / secs / 1e9) << " GB/s\n";
+    }
+
+    void run_parallel(const std::filesystem::path &path, std::size_t threads, double file_mb, double &base_secs)
+    {
+        fin::io::ParallelIngestOptions popt{};
+        popt.threads = threads;
+        double checksum = 0.0;
+        const auto t0 = std::chrono::steady_clock::now();
+        auto st = fin::io::for_each_tick_chunk_parallel(path.string(), {}, popt, [&](const std::vector<fin::core::Tick> &ticks)
+                                                        {
+                                                            for (const auto &t : ticks)
+                                                                checksum += t.price().value(); });
+        const auto t1 = std::chrono::steady_clock::now();
+
+        const double secs = std::chrono::duration<double>(t1 - t0).count();
+        if (threads == 1)
+            base_secs = secs;
+        std::cout << "parallel x" << std::left << std::setw(6) << threads
+                  << std::right << std::setw(12) << st.parsed << " ticks"
+                  << std::setw(10) << std::fixed << std::setprecision(3) << secs << " s"
+                  << std::setw(10) << std::setprecision(2) << (static_cast<double>(st.parsed) / secs / 1e6) << " Mticks/s"
+                  << std::setw(10) << (file_mb / secs) << " MB/s"
+                  << std::setw(8) << (base_secs / secs) << "x\n";
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<std::string> args(argv + 1, argv + argc);
+    const std::size_t rows = std::stoull(arg_value(args, "--rows", "10000000"));
+    std::filesystem::path path = arg_value(args, "--file", "");
+    const bool generated = path.empty();
+
+    if (generated)
+    {
+        path = std::filesystem::temp_directory_path() / "aiquant_bench_ticks.csv";
+        std::cout << "Generating " << rows << " rows -> " << path.string() << "\n";
+        write_synthetic_ticks(path, rows);
+    }
+
+    const double file_mb = static_cast<double>(std::filesystem::file_size(path)) / (1024.0 * 1024.0);
+    std::cout << "File size: " << std::fixed << std::setprecision(1) << file_mb << " MB\n";
+
+    run<fin::io::FileTickSource>("FileTickSource", path, file_mb);
+    run<fin::io::MmapTickSource>("MmapTickSource", path, file_mb);
+    run_batched<fin::io::MmapTickSource>("Mmap/batched", path, file_mb);
+
+    std::cout << "\nBest scanner kernel: " << fin::io::scan_kernel_name(fin::io::best_scan_kernel()) << "\n";
+    {
+        fin::io::MappedFile file(path.string());
+        for (auto k : {fin::io::ScanKernel::Scalar, fin::io::ScanKernel::SSE2, fin::io::ScanKernel::AVX2})
+            if (fin::io::scan_kernel_supported(k))
+                run_scan(k, file);
+    }
+    for (auto k : {fin::io::ScanKernel::Scalar, fin::io::ScanKernel::SSE2, fin::io::ScanKernel::AVX2})
+    {
+        if (!fin::io::scan_kernel_supported(k))
+            continue;
+        const std::string name = std::string("Mmap/") + fin::io::scan_kernel_name(k);
+        run<fin::io::MmapTickSource>(name.c_str(), path, file_mb, fin::io::TickCsvOptions{}, k);
+    }
+
+    std::cout << "\n";
+    const std::size_t hw = std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t max_threads = std::stoull(arg_value(args, "--max-threads", std::to_string(hw)));
+    double base_secs = 0.0;
+    for (std::size_t t = 1; t <= max_threads; t *= 2)
+        run_parallel(path, t, file_mb, base_secs);
+
+    if (generated && !has_flag(args, "--keep"))
+        std::filesystem::remove(path);
+    return 0;
+}
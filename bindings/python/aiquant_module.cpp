@@ -1,10 +1,10 @@
 #include <optional>
 #include <string>
-#include <unordered_map>
 
 #include <pybind11/pybind11.h>
 
 #include "fin/api/ScenarioService.hpp"
+#include "fin/app/ScenarioUtils.hpp"
 
 namespace py = pybind11;
 
@@ -16,31 +16,6 @@ namespace
         return svc;
     }
 
-    const char *timeframe_to_str(fin::io::Timeframe tf)
-    {
-        switch (tf)
-        {
-        case fin::io::Timeframe::S1: return "S1";
-        case fin::io::Timeframe::S5: return "S5";
-        case fin::io::Timeframe::M5: return "M5";
-        case fin::io::Timeframe::H1: return "H1";
-        case fin::io::Timeframe::M1:
-        default:
-            return "M1";
-        }
-    }
-
-    std::optional<fin::io::Timeframe> parse_timeframe(const std::string &value)
-    {
-        static const std::unordered_map<std::string, fin::io::Timeframe> map{{"S1", fin::io::Timeframe::S1},
-                                                                             {"S5", fin::io::Timeframe::S5},
-                                                                             {"M1", fin::io::Timeframe::M1},
-                                                                             {"M5", fin::io::Timeframe::M5},
-                                                                             {"H1", fin::io::Timeframe::H1}};
-        auto it = map.find(value);
-        return it == map.end() ? std::nullopt : std::optional<fin::io::Timeframe>(it->second);
-    }
-
     py::object get_if_present(const py::dict &dict, const char *name, bool *present = nullptr)
     {
         py::str key(name);
@@ -159,7 +134,7 @@ namespace
                 return false;
             }
             std::string token = tf.cast<std::string>();
-            if (auto parsed = parse_timeframe(token))
+            if (auto parsed = fin::io::parse_timeframe(token))
                 cfg.timeframe = *parsed;
             else
             {
@@ -168,6 +143,46 @@ namespace
             }
         }
 
+        if (py::object lateness = get_if_present(dict, "max_lateness", &present); present)
+        {
+            if (!py::isinstance<py::str>(lateness))
+            {
+                error = "max_lateness must be string";
+                return false;
+            }
+            std::string token = lateness.cast<std::string>();
+            if (auto parsed = fin::app::parse_lateness_token(token))
+                cfg.max_lateness = *parsed;
+            else
+            {
+                error = "Invalid max_lateness: " + token;
+                return false;
+            }
+        }
+
+        if (py::object mode = get_if_present(dict, "mode", &present); present)
+        {
+            if (!py::isinstance<py::str>(mode))
+            {
+                error = "mode must be string";
+                return false;
+            }
+            std::string token = mode.cast<std::string>();
+            if (auto parsed = fin::app::parse_scenario_mode_token(token))
+                cfg.mode = *parsed;
+            else
+            {
+                error = "Unknown mode: " + token;
+                return false;
+            }
+        }
+
+        if (!set_size(dict, "ingest_threads", cfg.ingest_threads, error)) return false;
+        if (!set_size(dict, "stream_train_rows", cfg.stream_train_rows, error)) return false;
+        if (!set_size(dict, "walk_forward_train", cfg.walk_forward_train, error)) return false;
+        if (!set_size(dict, "walk_forward_test", cfg.walk_forward_test, error)) return false;
+        if (!set_bool(dict, "walk_forward_anchored", cfg.walk_forward_anchored, error)) return false;
+        if (!set_size(dict, "walk_forward_threads", cfg.walk_forward_threads, error)) return false;
         if (!set_double(dict, "train_ratio", cfg.train_ratio, error)) return false;
         if (!set_double(dict, "ridge_lambda", cfg.ridge_lambda, error)) return false;
         if (!set_size(dict, "ema_fast", cfg.ema_fast, error)) return false;
@@ -201,6 +216,61 @@ namespace
             }
         }
 
+        if (py::object features = get_if_present(dict, "features", &present); present)
+        {
+            // A list of feature tokens or one comma-separated string; empty => defaults.
+            std::string text;
+            if (py::isinstance<py::str>(features))
+            {
+                text = features.cast<std::string>();
+            }
+            else if (py::isinstance<py::list>(features) || py::isinstance<py::tuple>(features))
+            {
+                for (py::handle item : features)
+                {
+                    if (!py::isinstance<py::str>(item))
+                    {
+                        error = "features must be a list of strings";
+                        return false;
+                    }
+                    text += item.cast<std::string>() + ',';
+                }
+            }
+            else if (!features.is_none())
+            {
+                error = "features must be a list of strings";
+                return false;
+            }
+            cfg.features.clear();
+            if (text.find_first_not_of(" ,") != std::string::npos)
+            {
+                auto specs = fin::indicators::parse_feature_specs(text);
+                if (!specs)
+                {
+                    error = "invalid features: " + text;
+                    return false;
+                }
+                cfg.features = std::move(*specs);
+            }
+        }
+
+        if (py::object features = get_if_present(dict, "features_output_path", &present); present)
+        {
+            if (features.is_none())
+            {
+                cfg.features_output_path.reset();
+            }
+            else if (py::isinstance<py::str>(features))
+            {
+                cfg.features_output_path = features.cast<std::string>();
+            }
+            else
+            {
+                error = "features_output_path must be string";
+                return false;
+            }
+        }
+
         return true;
     }
 
@@ -208,15 +278,27 @@ namespace
     {
         py::dict root;
         root["ticks_path"] = cfg.ticks_path;
-        root["timeframe"] = timeframe_to_str(cfg.timeframe);
+        root["timeframe"] = fin::io::to_string(cfg.timeframe);
+        root["mode"] = fin::app::scenario_mode_to_cstr(cfg.mode);
         root["candles"] = result.candles;
         root["warmup_candles"] = result.warmup_candles;
         root["feature_rows"] = result.feature_rows;
+        py::dict late;
+        late["merged"] = result.late_ticks.merged;
+        late["dropped"] = result.late_ticks.dropped;
+        root["late_ticks"] = std::move(late);
         root["training_samples"] = result.training.samples;
         root["validation_samples"] = result.validation_samples;
         root["training_mse"] = result.training.mse;
         root["validation_rmse"] = result.validation_rmse;
         root["model_saved"] = result.model_saved;
+        py::list feature_columns;
+        if (result.feature_schema)
+            for (const auto &name : result.feature_schema->names())
+                feature_columns.append(name);
+        root["feature_columns"] = std::move(feature_columns);
+        root["features_saved"] = result.features_saved;
+        root["peak_rss_bytes"] = result.peak_rss_bytes;
 
         py::dict metrics;
         metrics["final_cash"] = result.metrics.final_cash;
@@ -238,6 +320,25 @@ namespace
             preview.append(std::move(entry));
         }
         root["validation_preview"] = std::move(preview);
+
+        py::list folds;
+        for (const auto &f : result.folds)
+        {
+            py::dict fold;
+            fold["train_begin"] = f.train_begin;
+            fold["train_end"] = f.train_end;
+            fold["test_begin"] = f.test_begin;
+            fold["test_end"] = f.test_end;
+            fold["test_start_ms"] = f.test_start_ms;
+            fold["test_end_ms"] = f.test_end_ms;
+            fold["validation_rmse"] = f.validation_rmse;
+            fold["pnl"] = f.metrics.pnl;
+            fold["return_pct"] = f.metrics.return_pct;
+            fold["trades"] = f.metrics.trades;
+            fold["max_drawdown"] = f.metrics.max_drawdown;
+            folds.append(std::move(fold));
+        }
+        root["walk_forward_folds"] = std::move(folds);
         return root;
     }
 
@@ -245,7 +346,15 @@ namespace
     {
         py::dict dict;
         dict["ticks_path"] = cfg.ticks_path;
-        dict["timeframe"] = timeframe_to_str(cfg.timeframe);
+        dict["timeframe"] = fin::io::to_string(cfg.timeframe);
+        dict["max_lateness"] = cfg.max_lateness.count() ? fin::io::to_string(fin::io::Timeframe(cfg.max_lateness)) : std::string("0");
+        dict["mode"] = fin::app::scenario_mode_to_cstr(cfg.mode);
+        dict["ingest_threads"] = cfg.ingest_threads;
+        dict["stream_train_rows"] = cfg.stream_train_rows;
+        dict["walk_forward_train"] = cfg.walk_forward_train;
+        dict["walk_forward_test"] = cfg.walk_forward_test;
+        dict["walk_forward_anchored"] = cfg.walk_forward_anchored;
+        dict["walk_forward_threads"] = cfg.walk_forward_threads;
         dict["train_ratio"] = cfg.train_ratio;
         dict["ridge_lambda"] = cfg.ridge_lambda;
         dict["ema_fast"] = cfg.ema_fast;
@@ -254,6 +363,10 @@ namespace
         dict["macd_fast"] = cfg.macd_fast;
         dict["macd_slow"] = cfg.macd_slow;
         dict["macd_signal"] = cfg.macd_signal;
+        py::list features;
+        for (const auto &spec : cfg.features)
+            features.append(fin::indicators::to_string(spec));
+        dict["features"] = std::move(features);
         dict["rsi_buy"] = cfg.rsi_buy;
         dict["rsi_sell"] = cfg.rsi_sell;
         dict["use_ema_crossover"] = cfg.use_ema_crossover;
@@ -266,6 +379,8 @@ namespace
         dict["validation_preview_limit"] = cfg.validation_preview_limit;
         if (cfg.model_output_path)
             dict["model_output_path"] = *cfg.model_output_path;
+        if (cfg.features_output_path)
+            dict["features_output_path"] = *cfg.features_output_path;
         return dict;
     }
 
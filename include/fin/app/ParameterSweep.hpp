@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "fin/app/ScenarioRunner.hpp"
+
+namespace fin::app
+{
+    /**
+     * @brief Parameter grid for a scenario sweep.
+     *
+     * Every non-empty axis lists the values to try; an empty axis keeps the
+     * base config's value. The sweep runs the cartesian product of all axes.
+     */
+    struct SweepGrid
+    {
+        std::vector<std::size_t> ema_fast;
+        std::vector<std::size_t> ema_slow;
+        std::vector<std::size_t> rsi_period;
+        std::vector<double> rsi_buy;
+        std::vector<double> rsi_sell;
+        std::vector<double> ridge_lambda;
+
+        std::size_t combinations() const;
+    };
+
+    enum class SweepRankBy
+    {
+        ReturnPct,     // backtest return, highest first
+        ValidationRmse // out-of-sample prediction error, lowest first
+    };
+
+    struct SweepOptions
+    {
+        std::size_t threads = 0; // scenario workers; 0 => all cores
+        SweepRankBy rank_by = SweepRankBy::ReturnPct;
+    };
+
+    struct SweepEntry
+    {
+        std::size_t index = 0; // position in expand_sweep_grid() order
+        ScenarioConfig config;
+        bool ok = false;
+        std::string error; // set when the scenario threw
+        ScenarioResult result;
+    };
+
+    struct SweepResult
+    {
+        std::size_t candles = 0;
+        fin::io::ReadStats stats{};
+        std::vector<SweepEntry> entries; // ranked; failed runs last
+    };
+
+    // Cartesian product of `grid` applied on top of `base`. The last axis
+    // (ridge_lambda) varies fastest.
+    std::vector<ScenarioConfig> expand_sweep_grid(const ScenarioConfig &base, const SweepGrid &grid);
+
+    // Runs every config against the shared read-only `bars` on a pool of
+    // options.threads workers and returns the entries ranked by
+    // options.rank_by. A scenario that throws is kept with ok == false.
+    std::vector<SweepEntry> run_sweep_on_candles(const std::vector<ScenarioConfig> &configs,
+                                                 const fin::core::CandleSeriesView &bars,
+                                                 const SweepOptions &options = {});
+
+    // Sorts entries by rank_by: failed runs last, NaN metrics after finite
+    // ones, ties broken by index.
+    void rank_sweep_entries(std::vector<SweepEntry> &entries, SweepRankBy rank_by);
+
+    // Loads and resamples base.ticks_path once, then sweeps the grid over it.
+    SweepResult run_sweep(const ScenarioConfig &base, const SweepGrid &grid, const SweepOptions &options = {});
+
+    // Parses a sweep axis: "a,b,c" lists values, "lo:hi:step" expands an
+    // inclusive range, and the two forms may be mixed ("5,10:20:5").
+    // Returns false on malformed input or a non-positive step.
+    bool parse_sweep_values(const std::string &text, std::vector<double> &out);
+    bool parse_sweep_values(const std::string &text, std::vector<std::size_t> &out);
+}
@@ -1,22 +1,42 @@
 #pragma once
 
+#include <chrono>
 #include <optional>
 #include <string>
 #include <vector>
 
+#include "fin/core/FeatureMatrix.hpp"
+#include "fin/indicators/FeatureSpec.hpp"
 #include "fin/io/Pipeline.hpp"
 #include "fin/ml/LinearTrainer.hpp"
 #include "fin/backtest/Backtester.hpp"
 
 namespace fin::app
 {
+    enum class ScenarioMode
+    {
+        Batch,    // resample everything, then features / training / backtest over the series
+        Streaming // ticks -> candles -> features -> backtest in one pass, O(1) memory in the file length
+    };
+
     struct ScenarioConfig
     {
         std::string ticks_path;
         fin::io::Timeframe timeframe = fin::io::Timeframe::M1;
+        std::chrono::nanoseconds max_lateness{}; // out-of-order ticks this far behind are still merged; 0 => dropped
+        std::size_t ingest_threads = 1; // CSV parse workers; 0 => all cores, 1 => sequential
+        ScenarioMode mode = ScenarioMode::Batch;
+        std::size_t stream_train_rows = 0; // streaming: feature rows to train on; 0 => from train_ratio (extra counting pass)
         double train_ratio = 0.7;
         double ridge_lambda = 1e-6;
 
+        // Walk-forward evaluation (batch mode), enabled by walk_forward_test > 0:
+        // train on a window of samples, trade the next walk_forward_test, roll on.
+        std::size_t walk_forward_train = 0;   // training window in feature rows; 0 => from train_ratio
+        std::size_t walk_forward_test = 0;    // out-of-sample rows per fold; 0 => single split
+        bool walk_forward_anchored = false;   // expanding window from the first row instead of rolling
+        std::size_t walk_forward_threads = 0; // fold workers; 0 => all cores
+
         std::size_t ema_fast = 12;
         std::size_t ema_slow = 26;
         std::size_t rsi_period = 14;
@@ -24,6 +44,11 @@ namespace fin::app
         std::size_t macd_slow = 26;
         std::size_t macd_signal = 9;
 
+        // Model inputs; empty => the default set from the periods above
+        // (default_feature_specs). Must include the `close` column, the
+        // regression target.
+        std::vector<fin::indicators::FeatureSpec> features;
+
         double rsi_buy = 30.0;
         double rsi_sell = 70.0;
         bool use_ema_crossover = true;
@@ -33,6 +58,7 @@ namespace fin::app
         std::optional<double> fee_per_trade;
 
         std::optional<std::string> model_output_path;
+        std::optional<std::string> features_output_path; // feature rows as CSV (see write_feature_matrix_csv)
         std::size_t validation_preview_limit = 3;
     };
 
@@ -43,11 +69,26 @@ namespace fin::app
         double actual_delta = 0.0;
     };
 
+    // One walk-forward fold. Ranges are feature-row (sample) indices, end exclusive.
+    struct WalkForwardFold
+    {
+        std::size_t train_begin = 0;
+        std::size_t train_end = 0;
+        std::size_t test_begin = 0;
+        std::size_t test_end = 0;
+        long long test_start_ms = 0; // first traded candle
+        long long test_end_ms = 0;   // last traded candle
+
+        double validation_rmse = 0.0;
+        fin::backtest::Metrics metrics; // fold traded on its own from initial cash
+    };
+
     struct ScenarioResult
     {
         std::size_t candles = 0;
         std::size_t warmup_candles = 0;
         std::size_t feature_rows = 0;
+        fin::io::LateTickStats late_ticks; // out-of-order ticks merged / dropped by the resampler
 
         std::size_t validation_samples = 0;
         double validation_rmse = 0.0;
@@ -56,7 +97,38 @@ namespace fin::app
         fin::ml::LinearTrainingSummary training;
         fin::backtest::Metrics metrics;
         bool model_saved = false;
+
+        fin::core::FeatureSchemaPtr feature_schema; // model input columns
+        bool features_saved = false;
+
+        std::vector<WalkForwardFold> folds; // walk-forward only, in time order
+
+        std::size_t peak_rss_bytes = 0; // process high-water mark after the run (0 if unavailable)
     };
 
+    // Reads and resamples config.ticks_path (CSV or tick store) at config.timeframe.
+    fin::io::SeriesPipelineResult load_scenario_candles(const ScenarioConfig &config);
+
+    // Features, training, validation and backtest over already resampled bars;
+    // ticks_path, timeframe and ingest_threads are ignored. Only reads `bars`,
+    // so several calls may share one series across threads. Runs a
+    // walk-forward evaluation (see WalkForward.hpp) when walk_forward_test > 0.
+    ScenarioResult run_scenario_on_candles(const ScenarioConfig &config, const fin::core::CandleSeriesView &bars);
+
+    /**
+     * @brief One-pass scenario that never holds the candle series.
+     *
+     * Ticks flow through the resampler, FeatureBus and backtester as they
+     * are read. The first N feature rows train the model through running
+     * normal equations; the rows after that are validated exactly as in
+     * batch mode. N is config.stream_train_rows, or the batch split derived
+     * from train_ratio, which costs one extra counting pass over the file.
+     * Unlike batch mode, bars inside the training window are backtested
+     * without model predictions (the model does not exist yet).
+     */
+    ScenarioResult run_scenario_streaming(const ScenarioConfig &config);
+
+    // Dispatches on config.mode: load_scenario_candles() followed by
+    // run_scenario_on_candles(), or run_scenario_streaming().
     ScenarioResult run_scenario(const ScenarioConfig &config);
 }
@@ -1,12 +1,22 @@
 #pragma once
 
+#include <ostream>
+#include <span>
 #include <string>
 
 #include "fin/app/ScenarioRunner.hpp"
+#include "fin/core/FeatureMatrix.hpp"
 
 namespace fin::app
 {
     std::string scenario_result_to_json(const ScenarioConfig &cfg, const ScenarioResult &result);
     bool write_validation_preview_csv(const ScenarioResult &result, const std::string &path);
+
+    // Feature CSV: a ts_ms column followed by one column per schema name.
+    // The header/row pair lets streaming runs write rows as they appear;
+    // the header also sets `out` to 12 significant digits.
+    void write_feature_csv_header(std::ostream &out, const fin::core::FeatureSchema &schema);
+    void write_feature_csv_row(std::ostream &out, fin::core::Timestamp ts, std::span<const double> values);
+    bool write_feature_matrix_csv(const fin::core::FeatureMatrixView &features, const std::string &path);
 }
 
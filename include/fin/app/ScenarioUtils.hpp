@@ -1,12 +1,40 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <optional>
 #include <string>
+#include <vector>
 
+#include "fin/app/ScenarioRunner.hpp"
 #include "fin/io/Pipeline.hpp"
 
 namespace fin::app
 {
     std::optional<fin::io::Timeframe> parse_timeframe_token(const std::string &token);
+
+    // Comma-separated timeframe tokens ("M1,M5,H1"); nullopt if any is invalid.
+    std::optional<std::vector<fin::io::Timeframe>> parse_timeframe_list(const std::string &list);
+
+    // Lateness bound for out-of-order ticks: "0" or a duration token as in
+    // parse_timeframe_token ("500ms", "2s").
+    std::optional<std::chrono::nanoseconds> parse_lateness_token(const std::string &token);
+
+    // "batch" or "streaming".
+    std::optional<ScenarioMode> parse_scenario_mode_token(const std::string &token);
+    const char *scenario_mode_to_cstr(ScenarioMode mode);
+
+    // Training rows for a train/validation split: total_rows * ratio with the
+    // ratio clamped to [0.1, 0.95], leaving at least one validation row.
+    // Throws std::runtime_error below three rows.
+    std::size_t clamp_training_rows(std::size_t total_rows, double ratio);
+
+    // Signal engine + backtester configured from the scenario's strategy keys.
+    fin::backtest::Backtester make_scenario_backtester(const ScenarioConfig &config);
+
+    // Peak resident set size of this process so far, in bytes (0 when the
+    // platform does not expose it). A process-wide high-water mark: compare
+    // modes in separate processes.
+    std::size_t peak_rss_bytes();
 }
 
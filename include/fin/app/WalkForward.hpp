@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "fin/app/ScenarioRunner.hpp"
+#include "fin/core/FeatureMatrix.hpp"
+
+namespace fin::app
+{
+    // Fold ranges over `samples` feature-row samples: each fold trains on
+    // `train` samples (or everything before it when `anchored`) and tests the
+    // next `test`; the last fold may be shorter. Throws std::invalid_argument
+    // when train < 2 or test == 0.
+    std::vector<WalkForwardFold> plan_walk_forward(std::size_t samples, std::size_t train, std::size_t test, bool anchored);
+
+    /**
+     * @brief Walk-forward evaluation over already resampled bars and their
+     * features (FeatureBus rows of `bars`, computed once for the series).
+     *
+     * Fold accumulators are
+     * derived from the previous fold's by adding the samples that entered the
+     * window and removing the ones that left it, so no fold re-reads its
+     * training window. Folds are then solved, validated and backtested
+     * independently on config.walk_forward_threads workers: each fold warms
+     * the backtester's indicators over its training candles and trades its
+     * test candles from initial cash.
+     *
+     * In the result, `folds` holds the per-fold RMSE and metrics; the
+     * top-level RMSE pools every out-of-sample prediction, `metrics` sums the
+     * folds' PnL and trades (max drawdown is the worst fold's), and
+     * `training` is the last fold's model, which is the one saved to
+     * model_output_path.
+     */
+    ScenarioResult run_walk_forward_on_candles(const ScenarioConfig &config, const fin::core::CandleSeriesView &bars,
+                                               const fin::core::FeatureMatrixView &features);
+}
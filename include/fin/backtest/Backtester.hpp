@@ -2,14 +2,21 @@
 #ifndef FIN_BACKTEST_BACKTESTER_HPP
 #define FIN_BACKTEST_BACKTESTER_HPP
 
+#include <span>
 #include <vector>
 #include <optional>
 #include <string>
 
 #include "fin/core/Candle.hpp"
+#include "fin/core/CandleSeries.hpp"
 #include "fin/indicators/adapters/CandleAdapters.hpp" // EMAFromCandle, RSIFromCandle
 #include "fin/signal/SignalEngine.hpp"
 
+namespace fin::indicators
+{
+    class IndicatorGraph;
+}
+
 namespace fin::backtest
 {
     struct Trade
@@ -53,6 +60,20 @@ namespace fin::backtest
         // Feed one candle; applies strategy and updates positions
         void on_candle(const fin::core::Candle &c, std::optional<double> prediction = std::nullopt);
 
+        // Reads the EMAs/RSI from `graph` (registering them there, shared with
+        // any identical feature nodes) instead of computing its own. The caller
+        // then updates the graph with each candle before on_candle(), and
+        // warm_up() has nothing left to do. `graph` must outlive the backtester.
+        void share_indicators(fin::indicators::IndicatorGraph &graph);
+
+        // Advances the indicators only: no signal, no trade, no drawdown.
+        // Lets a backtest that starts mid-series begin with warm EMAs/RSI.
+        void warm_up(const fin::core::Candle &c);
+
+        // Feeds every bar of `bars`; predictions[i] (if given) goes with bar i.
+        void on_candles(const fin::core::CandleSeriesView &bars,
+                        std::span<const std::optional<double>> predictions = {});
+
         // Close any open position at last price and compute metrics
         Metrics finalize();
 
@@ -79,6 +100,10 @@ namespace fin::backtest
         fin::indicators::EMAFromCandle ema_slow_;
         fin::indicators::RSIFromCandle rsi_;
 
+        // Set by share_indicators(): node ids for ema_fast, ema_slow, rsi.
+        const fin::indicators::IndicatorGraph *graph_ = nullptr;
+        std::size_t graph_nodes_[3] = {};
+
         fin::signal::IndicatorsSnapshot make_snapshot(const fin::core::Candle &c) const;
         void apply_signal(const fin::core::Candle &c, const fin::signal::Signal &sig);
         void update_drawdown(const fin::core::Candle &c);
@@ -4,32 +4,54 @@
 
 #include "Timestamp.hpp"
 #include "Price.hpp"
+#include "FixedPrice.hpp"
 #include "Volume.hpp"
 #include <string>
+#include <type_traits>
 
 namespace fin::core
 {
-    class Candle
+    // OHLCV bar over a price representation P (Price or FixedPrice).
+    template <class P>
+    class BasicCandle
     {
     public:
-        Candle(Timestamp start, Price open, Price high, Price low, Price close, Volume vol);
+        using price_type = P;
 
-        Timestamp start_time() const;
-        Price open() const;
-        Price high() const;
-        Price low() const;
-        Price close() const;
-        Volume volume() const;
+        constexpr BasicCandle(Timestamp start, P open, P high, P low, P close, Volume vol) noexcept
+            : start_(start), open_(open), high_(high), low_(low), close_(close), volume_(vol) {}
+
+        constexpr Timestamp start_time() const noexcept { return start_; }
+        constexpr P open() const noexcept { return open_; }
+        constexpr P high() const noexcept { return high_; }
+        constexpr P low() const noexcept { return low_; }
+        constexpr P close() const noexcept { return close_; }
+        constexpr Volume volume() const noexcept { return volume_; }
+
+        // Same start and OHLC; exact for FixedPrice. Volume is not compared.
+        constexpr bool same_bar(const BasicCandle &other) const noexcept
+        {
+            return start_ == other.start_ && open_ == other.open_ && high_ == other.high_ &&
+                   low_ == other.low_ && close_ == other.close_;
+        }
 
     private:
         Timestamp start_;
-        Price open_;
-        Price high_;
-        Price low_;
-        Price close_;
+        P open_;
+        P high_;
+        P low_;
+        P close_;
         Volume volume_;
     };
 
+    using Candle = BasicCandle<Price>;
+    using FixedCandle = BasicCandle<FixedPrice>;
+
+    static_assert(std::is_trivially_copyable_v<Candle>, "Candle must stay trivially copyable");
+    static_assert(std::is_trivially_copyable_v<FixedCandle>, "FixedCandle must stay trivially copyable");
+
+    Candle to_double(const FixedCandle &c, PriceScale scale);
+
 } // namespace fin::core
 
 #endif /* FIN_CORE_CANDLE_HPP */
@@ -0,0 +1,75 @@
+#pragma once
+#ifndef FIN_CORE_CANDLE_SERIES_HPP
+#define FIN_CORE_CANDLE_SERIES_HPP
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "Candle.hpp"
+#include "Timestamp.hpp"
+
+namespace fin::core
+{
+    /**
+     * @brief Non-owning view of a CandleSeries: one contiguous span per field.
+     *
+     * Cheap to copy and slice. Batch indicators take the columns directly
+     * (e.g. SMA::compute(view.close, n)); per-bar consumers can rebuild a
+     * Candle with candle(i).
+     */
+    struct CandleSeriesView
+    {
+        std::span<const Timestamp> ts;
+        std::span<const double> open, high, low, close, volume;
+
+        std::size_t size() const noexcept { return ts.size(); }
+        bool empty() const noexcept { return ts.empty(); }
+
+        Candle candle(std::size_t i) const;
+
+        // Bars [offset, offset + count), clamped to the view.
+        CandleSeriesView subview(std::size_t offset, std::size_t count = static_cast<std::size_t>(-1)) const;
+    };
+
+    /**
+     * @brief Structure-of-arrays candle container.
+     *
+     * Timestamps, OHLC and volume live in separate contiguous arrays, so scans
+     * over one field (the common case in sweeps) touch only that field's cache
+     * lines and vectorize. The resampler can append into it directly.
+     */
+    class CandleSeries
+    {
+    public:
+        CandleSeries() = default;
+        explicit CandleSeries(const std::vector<Candle> &candles);
+
+        void reserve(std::size_t n);
+        void clear();
+
+        void push_back(const Candle &c);
+        void push_back(Timestamp ts, double open, double high, double low, double close, double volume);
+
+        std::size_t size() const noexcept { return ts_.size(); }
+        bool empty() const noexcept { return ts_.empty(); }
+
+        Candle operator[](std::size_t i) const;
+        CandleSeriesView view() const;
+        std::vector<Candle> to_candles() const;
+
+        std::span<const Timestamp> ts() const noexcept { return ts_; }
+        std::span<const double> open() const noexcept { return open_; }
+        std::span<const double> high() const noexcept { return high_; }
+        std::span<const double> low() const noexcept { return low_; }
+        std::span<const double> close() const noexcept { return close_; }
+        std::span<const double> volume() const noexcept { return volume_; }
+
+    private:
+        std::vector<Timestamp> ts_;
+        std::vector<double> open_, high_, low_, close_, volume_;
+    };
+
+} // namespace fin::core
+
+#endif // FIN_CORE_CANDLE_SERIES_HPP
@@ -0,0 +1,153 @@
+#pragma once
+#ifndef FIN_CORE_DYNAMIC_RINGBUFFER_HPP
+#define FIN_CORE_DYNAMIC_RINGBUFFER_HPP
+
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace fin::core
+{
+    /**
+     * @brief Double-ended FIFO over one contiguous, power-of-two sized array.
+     *
+     * Capacity is chosen at runtime (rounded up to a power of two so wrapping
+     * is a mask). push_back() only allocates when the buffer is full, doubling
+     * the capacity; rolling windows reserve `period + 1` slots up front so
+     * their steady-state updates never allocate. Indexing is from the front.
+     */
+    template <typename T>
+    class DynamicRingBuffer
+    {
+    public:
+        explicit DynamicRingBuffer(std::size_t min_capacity = 0);
+
+        DynamicRingBuffer(const DynamicRingBuffer &other);
+        DynamicRingBuffer &operator=(const DynamicRingBuffer &other);
+        DynamicRingBuffer(DynamicRingBuffer &&other) noexcept;
+        DynamicRingBuffer &operator=(DynamicRingBuffer &&other) noexcept;
+
+        void reserve(std::size_t min_capacity);
+
+        void push_back(const T &value);
+        void pop_front();
+        void pop_back();
+
+        const T &front() const { return data_[head_]; }
+        const T &back() const { return data_[(head_ + count_ - 1) & mask_]; }
+        const T &operator[](std::size_t index) const { return data_[(head_ + index) & mask_]; }
+
+        std::size_t size() const noexcept { return count_; }
+        bool empty() const noexcept { return count_ == 0; }
+        bool full() const noexcept { return count_ == capacity(); }
+        std::size_t capacity() const noexcept { return data_ ? mask_ + 1 : 0; }
+
+        void clear() noexcept
+        {
+            head_ = 0;
+            count_ = 0;
+        }
+
+    private:
+        void grow(std::size_t new_capacity);
+
+        std::unique_ptr<T[]> data_;
+        std::size_t mask_ = 0;
+        std::size_t head_ = 0;
+        std::size_t count_ = 0;
+    };
+
+    // === Implementation ===
+    template <typename T>
+    DynamicRingBuffer<T>::DynamicRingBuffer(std::size_t min_capacity)
+    {
+        if (min_capacity > 0)
+            grow(std::bit_ceil(min_capacity));
+    }
+
+    template <typename T>
+    DynamicRingBuffer<T>::DynamicRingBuffer(const DynamicRingBuffer &other)
+    {
+        if (other.capacity() > 0)
+            grow(other.capacity());
+        for (std::size_t i = 0; i < other.size(); ++i)
+            push_back(other[i]);
+    }
+
+    template <typename T>
+    DynamicRingBuffer<T> &DynamicRingBuffer<T>::operator=(const DynamicRingBuffer &other)
+    {
+        if (this != &other)
+        {
+            DynamicRingBuffer tmp(other);
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+
+    template <typename T>
+    DynamicRingBuffer<T>::DynamicRingBuffer(DynamicRingBuffer &&other) noexcept
+        : data_(std::move(other.data_)),
+          mask_(std::exchange(other.mask_, 0)),
+          head_(std::exchange(other.head_, 0)),
+          count_(std::exchange(other.count_, 0))
+    {
+    }
+
+    template <typename T>
+    DynamicRingBuffer<T> &DynamicRingBuffer<T>::operator=(DynamicRingBuffer &&other) noexcept
+    {
+        if (this != &other)
+        {
+            data_ = std::move(other.data_);
+            mask_ = std::exchange(other.mask_, 0);
+            head_ = std::exchange(other.head_, 0);
+            count_ = std::exchange(other.count_, 0);
+        }
+        return *this;
+    }
+
+    template <typename T>
+    void DynamicRingBuffer<T>::reserve(std::size_t min_capacity)
+    {
+        if (min_capacity > capacity())
+            grow(std::bit_ceil(min_capacity));
+    }
+
+    template <typename T>
+    void DynamicRingBuffer<T>::grow(std::size_t new_capacity)
+    {
+        auto next = std::make_unique<T[]>(new_capacity);
+        for (std::size_t i = 0; i < count_; ++i)
+            next[i] = std::move(data_[(head_ + i) & mask_]);
+        data_ = std::move(next);
+        mask_ = new_capacity - 1;
+        head_ = 0;
+    }
+
+    template <typename T>
+    void DynamicRingBuffer<T>::push_back(const T &value)
+    {
+        if (count_ == capacity())
+            grow(capacity() ? capacity() * 2 : 1);
+        data_[(head_ + count_) & mask_] = value;
+        ++count_;
+    }
+
+    template <typename T>
+    void DynamicRingBuffer<T>::pop_front()
+    {
+        head_ = (head_ + 1) & mask_;
+        --count_;
+    }
+
+    template <typename T>
+    void DynamicRingBuffer<T>::pop_back()
+    {
+        --count_;
+    }
+
+} // namespace fin::core
+
+#endif // FIN_CORE_DYNAMIC_RINGBUFFER_HPP
@@ -0,0 +1,106 @@
+#pragma once
+#ifndef FIN_CORE_FEATURE_MATRIX_HPP
+#define FIN_CORE_FEATURE_MATRIX_HPP
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Timestamp.hpp"
+
+namespace fin::core
+{
+    /**
+     * @brief Ordered feature names, shared by every row that uses them.
+     *
+     * Held through FeatureSchemaPtr so matrices, feature vectors and bound
+     * models point at one copy of the names instead of carrying their own.
+     */
+    class FeatureSchema
+    {
+    public:
+        // Throws std::invalid_argument on empty or duplicate names.
+        explicit FeatureSchema(std::vector<std::string> names);
+
+        static std::shared_ptr<const FeatureSchema> make(std::vector<std::string> names);
+
+        std::size_t size() const noexcept { return names_.size(); }
+        const std::vector<std::string> &names() const noexcept { return names_; }
+        const std::string &name(std::size_t i) const { return names_[i]; }
+
+        // Column of `name`, if present.
+        std::optional<std::size_t> index_of(std::string_view name) const noexcept;
+
+        bool operator==(const FeatureSchema &other) const noexcept { return names_ == other.names_; }
+
+    private:
+        std::vector<std::string> names_;
+    };
+
+    using FeatureSchemaPtr = std::shared_ptr<const FeatureSchema>;
+
+    /**
+     * @brief Non-owning view of a FeatureMatrix.
+     *
+     * Cheap to copy and slice; row(i) is a contiguous span of cols() values.
+     */
+    struct FeatureMatrixView
+    {
+        const FeatureSchema *schema = nullptr;
+        std::span<const Timestamp> ts;  // one per row
+        std::span<const double> values; // rows() * cols(), row-major
+
+        std::size_t rows() const noexcept { return ts.size(); }
+        std::size_t cols() const noexcept { return schema ? schema->size() : 0; }
+        bool empty() const noexcept { return ts.empty(); }
+
+        std::span<const double> row(std::size_t i) const { return values.subspan(i * cols(), cols()); }
+        double at(std::size_t r, std::size_t c) const { return values[r * cols() + c]; }
+
+        // Rows [offset, offset + count), clamped to the view.
+        FeatureMatrixView subview(std::size_t offset, std::size_t count = static_cast<std::size_t>(-1)) const;
+    };
+
+    /**
+     * @brief Row-major feature matrix: 8 * cols() bytes of values plus one
+     * timestamp per row, all in contiguous arrays.
+     *
+     * FeatureBus appends into it; trainers and models read it through
+     * view() without per-row allocations or name lookups.
+     */
+    class FeatureMatrix
+    {
+    public:
+        // Throws std::invalid_argument when `schema` is null.
+        explicit FeatureMatrix(FeatureSchemaPtr schema);
+
+        const FeatureSchemaPtr &schema() const noexcept { return schema_; }
+        std::size_t rows() const noexcept { return ts_.size(); }
+        std::size_t cols() const noexcept { return schema_->size(); }
+        bool empty() const noexcept { return ts_.empty(); }
+
+        void reserve(std::size_t rows);
+        void clear();
+
+        // Throws std::invalid_argument unless values.size() == cols().
+        void append(Timestamp ts, std::span<const double> values);
+
+        std::span<const Timestamp> ts() const noexcept { return ts_; }
+        std::span<const double> values() const noexcept { return values_; }
+        std::span<const double> row(std::size_t i) const { return std::span<const double>(values_).subspan(i * cols(), cols()); }
+
+        FeatureMatrixView view() const noexcept { return {schema_.get(), ts_, values_}; }
+
+    private:
+        FeatureSchemaPtr schema_;
+        std::vector<Timestamp> ts_;
+        std::vector<double> values_;
+    };
+
+} // namespace fin::core
+
+#endif // FIN_CORE_FEATURE_MATRIX_HPP
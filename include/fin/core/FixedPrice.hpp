@@ -0,0 +1,69 @@
+#pragma once
+#ifndef FIN_CORE_FIXED_PRICE_HPP
+#define FIN_CORE_FIXED_PRICE_HPP
+
+#include <cmath>
+#include <compare>
+#include <cstdint>
+
+#include "Price.hpp"
+#include "Symbol.hpp"
+
+namespace fin::core
+{
+    // Number of integer ticks per 1.0 of price, e.g. 100 for a 0.01 tick size.
+    struct PriceScale
+    {
+        std::int64_t ticks_per_unit = 100;
+
+        constexpr bool operator==(const PriceScale &other) const noexcept { return ticks_per_unit == other.ticks_per_unit; }
+    };
+
+    /**
+     * @brief Integer-ticks price: an int64 mantissa in units of the symbol's
+     * tick size.
+     *
+     * The scale is not stored in the value; it is a per-symbol property kept in
+     * a process-wide registry (set_price_scale / price_scale). Comparisons and
+     * OHLC aggregation on FixedPrice are exact integer operations.
+     */
+    class FixedPrice
+    {
+    public:
+        constexpr FixedPrice() noexcept = default;
+        constexpr explicit FixedPrice(std::int64_t ticks) noexcept : ticks_(ticks) {}
+
+        // Rounds to the nearest tick.
+        static FixedPrice from_double(double v, PriceScale scale)
+        {
+            return FixedPrice(std::llround(v * static_cast<double>(scale.ticks_per_unit)));
+        }
+
+        constexpr std::int64_t ticks() const noexcept { return ticks_; }
+        constexpr double to_double(PriceScale scale) const noexcept
+        {
+            return static_cast<double>(ticks_) / static_cast<double>(scale.ticks_per_unit);
+        }
+
+        constexpr auto operator<=>(const FixedPrice &other) const noexcept = default;
+
+        constexpr FixedPrice operator-() const noexcept { return FixedPrice(-ticks_); }
+        constexpr FixedPrice operator+(FixedPrice other) const noexcept { return FixedPrice(ticks_ + other.ticks_); }
+        constexpr FixedPrice operator-(FixedPrice other) const noexcept { return FixedPrice(ticks_ - other.ticks_); }
+        constexpr FixedPrice operator*(std::int64_t k) const noexcept { return FixedPrice(ticks_ * k); }
+        friend constexpr FixedPrice operator*(std::int64_t k, FixedPrice p) noexcept { return FixedPrice(k * p.ticks_); }
+
+        constexpr FixedPrice &operator+=(FixedPrice other) noexcept { ticks_ += other.ticks_; return *this; }
+        constexpr FixedPrice &operator-=(FixedPrice other) noexcept { ticks_ -= other.ticks_; return *this; }
+
+    private:
+        std::int64_t ticks_ = 0;
+    };
+
+    // Per-symbol scale registry; unset symbols use PriceScale{} (0.01 ticks).
+    void set_price_scale(Symbol sym, PriceScale scale);
+    PriceScale price_scale(Symbol sym);
+
+} // namespace fin::core
+
+#endif // FIN_CORE_FIXED_PRICE_HPP
@@ -0,0 +1,68 @@
+#pragma once
+#ifndef FIN_CORE_MONOTONIC_DEQUE_HPP
+#define FIN_CORE_MONOTONIC_DEQUE_HPP
+
+#include <cstddef>
+#include <functional>
+
+#include "DynamicRingBuffer.hpp"
+
+namespace fin::core
+{
+    /**
+     * @brief Sliding-window extremum in amortized O(1) per sample.
+     *
+     * Keeps (value, index) pairs whose values are strictly ordered by
+     * `Compare` from front to back, so front() is the window's max
+     * (std::greater) or min (std::less). Samples are pushed with increasing
+     * indices and evicted by index; storage is a DynamicRingBuffer, so a
+     * deque reserved for `window + 1` entries never allocates afterwards.
+     */
+    template <typename T, typename Compare>
+    class MonotonicDeque
+    {
+    public:
+        explicit MonotonicDeque(std::size_t window = 0) : buf_(window + 1) {}
+
+        void reserve(std::size_t window) { buf_.reserve(window + 1); }
+
+        // Drops dominated entries from the back, then appends (value, index).
+        void push(const T &value, std::size_t index)
+        {
+            while (!buf_.empty() && !cmp_(buf_.back().value, value))
+                buf_.pop_back();
+            buf_.push_back(Node{value, index});
+        }
+
+        // Removes entries whose index is below `window_start`.
+        void evict_before(std::size_t window_start)
+        {
+            while (!buf_.empty() && buf_.front().index < window_start)
+                buf_.pop_front();
+        }
+
+        const T &front() const { return buf_.front().value; }
+        bool empty() const noexcept { return buf_.empty(); }
+        std::size_t size() const noexcept { return buf_.size(); }
+        void clear() noexcept { buf_.clear(); }
+
+    private:
+        struct Node
+        {
+            T value{};
+            std::size_t index = 0;
+        };
+
+        DynamicRingBuffer<Node> buf_;
+        Compare cmp_{};
+    };
+
+    template <typename T>
+    using RollingMax = MonotonicDeque<T, std::greater<T>>;
+
+    template <typename T>
+    using RollingMin = MonotonicDeque<T, std::less<T>>;
+
+} // namespace fin::core
+
+#endif // FIN_CORE_MONOTONIC_DEQUE_HPP
@@ -2,22 +2,41 @@
 #ifndef FIN_CORE_PRICE_HPP
 #define FIN_CORE_PRICE_HPP
 
+#include <compare>
+#include <type_traits>
+
 namespace fin::core
 {
+    // Floating price strong type. Header-only and constexpr so accessors
+    // inline into the resampler / indicator / backtest loops without LTO.
     class Price
     {
     public:
-        explicit Price(double v);
-        double value() const;
+        constexpr Price() noexcept = default;
+        constexpr explicit Price(double v) noexcept : val_(v) {}
+
+        constexpr double value() const noexcept { return val_; }
+
+        constexpr auto operator<=>(const Price &other) const noexcept = default;
 
-        bool operator==(const Price &other) const;
-        bool operator<(const Price &other) const;
-        Price operator-(const Price &other) const;
-        Price operator+(const Price &other) const;
+        constexpr Price operator-() const noexcept { return Price(-val_); }
+        constexpr Price operator+(Price other) const noexcept { return Price(val_ + other.val_); }
+        constexpr Price operator-(Price other) const noexcept { return Price(val_ - other.val_); }
+        constexpr Price operator*(double k) const noexcept { return Price(val_ * k); }
+        constexpr Price operator/(double k) const noexcept { return Price(val_ / k); }
+        constexpr double operator/(Price other) const noexcept { return val_ / other.val_; } // ratio
+        friend constexpr Price operator*(double k, Price p) noexcept { return Price(k * p.val_); }
+
+        constexpr Price &operator+=(Price other) noexcept { val_ += other.val_; return *this; }
+        constexpr Price &operator-=(Price other) noexcept { val_ -= other.val_; return *this; }
+        constexpr Price &operator*=(double k) noexcept { val_ *= k; return *this; }
+        constexpr Price &operator/=(double k) noexcept { val_ /= k; return *this; }
 
     private:
-        double val_;
+        double val_ = 0.0;
     };
+
+    static_assert(std::is_trivially_copyable_v<Price> && sizeof(Price) == sizeof(double));
 } // namespace fin::core
 
 #endif // FIN_CORE_PRICE_HPP
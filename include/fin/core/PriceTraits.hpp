@@ -0,0 +1,36 @@
+#pragma once
+#ifndef FIN_CORE_PRICE_TRAITS_HPP
+#define FIN_CORE_PRICE_TRAITS_HPP
+
+#include <cstdint>
+
+#include "Price.hpp"
+#include "FixedPrice.hpp"
+
+namespace fin::core
+{
+    // Compile-time price policy: the raw representation aggregations work on
+    // and the conversions to/from the wrapper type. Specialized for the
+    // floating (Price) and integer-ticks (FixedPrice) representations.
+    template <class P>
+    struct PriceTraits;
+
+    template <>
+    struct PriceTraits<Price>
+    {
+        using rep = double;
+        static rep raw(Price p) { return p.value(); }
+        static Price make(rep v) { return Price{v}; }
+    };
+
+    template <>
+    struct PriceTraits<FixedPrice>
+    {
+        using rep = std::int64_t;
+        static rep raw(FixedPrice p) { return p.ticks(); }
+        static FixedPrice make(rep v) { return FixedPrice{v}; }
+    };
+
+} // namespace fin::core
+
+#endif // FIN_CORE_PRICE_TRAITS_HPP
@@ -2,20 +2,39 @@
 #ifndef FIN_CORE_SYMBOL_HPP
 #define FIN_CORE_SYMBOL_HPP
 
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <string_view>
+
 namespace fin::core
 {
+    // Interned symbol: a 32-bit id into the process-wide SymbolTable, so
+    // copies, equality and hashing are integer operations. The default value
+    // is the empty symbol (id 0).
     class Symbol
     {
     public:
-        explicit Symbol(const std::string &v);
+        Symbol() = default;
+        explicit Symbol(std::string_view v);
+
+        static Symbol from_id(std::uint32_t id);
+
+        constexpr std::uint32_t id() const noexcept { return id_; }
         const std::string &value() const;
+        constexpr bool empty() const noexcept { return id_ == 0; }
 
-        bool operator==(const Symbol &other) const;
+        constexpr bool operator==(const Symbol &other) const noexcept = default;
 
     private:
-        std::string val_;
+        std::uint32_t id_ = 0;
     };
 } // namespace fin::core
 
+template <>
+struct std::hash<fin::core::Symbol>
+{
+    std::size_t operator()(const fin::core::Symbol &s) const noexcept { return s.id(); }
+};
+
 #endif // FIN_CORE_SYMBOL_HPP
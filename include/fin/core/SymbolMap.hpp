@@ -0,0 +1,101 @@
+#pragma once
+#ifndef FIN_CORE_SYMBOL_MAP_HPP
+#define FIN_CORE_SYMBOL_MAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "Symbol.hpp"
+
+namespace fin::core
+{
+    /**
+     * @brief Per-symbol state keyed by interned symbol id.
+     *
+     * Interned ids are small and dense, so lookups go through a flat
+     * id -> slot table instead of hashing: find() is two array reads.
+     * Entries are stored contiguously in first-seen order. Inserting may
+     * move entries, so references from find()/operator[] are only valid
+     * until the next insertion.
+     */
+    template <typename T>
+    class SymbolMap
+    {
+    public:
+        using value_type = std::pair<Symbol, T>;
+        using iterator = typename std::vector<value_type>::iterator;
+        using const_iterator = typename std::vector<value_type>::const_iterator;
+
+        T *find(Symbol sym) noexcept;
+        const T *find(Symbol sym) const noexcept;
+
+        // Returns the state for `sym`, constructing it from `args` when absent.
+        template <typename... Args>
+        T &try_emplace(Symbol sym, Args &&...args);
+
+        T &operator[](Symbol sym) { return try_emplace(sym); }
+
+        std::size_t size() const noexcept { return entries_.size(); }
+        bool empty() const noexcept { return entries_.empty(); }
+        void reserve(std::size_t n) { entries_.reserve(n); }
+        void clear() noexcept;
+
+        iterator begin() noexcept { return entries_.begin(); }
+        iterator end() noexcept { return entries_.end(); }
+        const_iterator begin() const noexcept { return entries_.begin(); }
+        const_iterator end() const noexcept { return entries_.end(); }
+
+    private:
+        std::vector<value_type> entries_;
+        std::vector<std::uint32_t> slot_; // id -> entry index + 1, 0 = absent
+    };
+
+    // === Implementation ===
+
+    template <typename T>
+    T *SymbolMap<T>::find(Symbol sym) noexcept
+    {
+        const std::uint32_t id = sym.id();
+        if (id >= slot_.size() || slot_[id] == 0)
+            return nullptr;
+        return &entries_[slot_[id] - 1].second;
+    }
+
+    template <typename T>
+    const T *SymbolMap<T>::find(Symbol sym) const noexcept
+    {
+        const std::uint32_t id = sym.id();
+        if (id >= slot_.size() || slot_[id] == 0)
+            return nullptr;
+        return &entries_[slot_[id] - 1].second;
+    }
+
+    template <typename T>
+    template <typename... Args>
+    T &SymbolMap<T>::try_emplace(Symbol sym, Args &&...args)
+    {
+        if (T *found = find(sym))
+            return *found;
+
+        const std::uint32_t id = sym.id();
+        if (id >= slot_.size())
+            slot_.resize(static_cast<std::size_t>(id) + 1 + slot_.size() / 2, 0);
+        entries_.emplace_back(std::piecewise_construct, std::forward_as_tuple(sym),
+                              std::forward_as_tuple(std::forward<Args>(args)...));
+        slot_[id] = static_cast<std::uint32_t>(entries_.size());
+        return entries_.back().second;
+    }
+
+    template <typename T>
+    void SymbolMap<T>::clear() noexcept
+    {
+        entries_.clear();
+        slot_.clear();
+    }
+
+} // namespace fin::core
+
+#endif // FIN_CORE_SYMBOL_MAP_HPP
@@ -0,0 +1,45 @@
+#pragma once
+#ifndef FIN_CORE_SYMBOL_TABLE_HPP
+#define FIN_CORE_SYMBOL_TABLE_HPP
+
+#include <cstdint>
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace fin::core
+{
+    /**
+     * @brief Process-wide symbol interning table.
+     *
+     * Maps each distinct symbol name to a dense 32-bit id, assigned in first-
+     * seen order; id 0 is the empty name. Ids and the names they refer to are
+     * never released, so references returned by name() stay valid for the
+     * lifetime of the process. intern() and name() are thread-safe (readers
+     * take a shared lock, only a new name takes the exclusive one).
+     */
+    class SymbolTable
+    {
+    public:
+        static SymbolTable &instance();
+
+        std::uint32_t intern(std::string_view name);
+
+        // Name of a previously interned id; throws std::out_of_range otherwise.
+        const std::string &name(std::uint32_t id) const;
+
+        std::size_t size() const;
+
+    private:
+        SymbolTable();
+
+        mutable std::shared_mutex mutex_;
+        std::deque<std::string> names_;                           // stable addresses
+        std::unordered_map<std::string_view, std::uint32_t> ids_; // views into names_
+    };
+
+} // namespace fin::core
+
+#endif // FIN_CORE_SYMBOL_TABLE_HPP
@@ -5,27 +5,47 @@
 #include "Timestamp.hpp"
 #include "Symbol.hpp"
 #include "Price.hpp"
+#include "FixedPrice.hpp"
 #include "Volume.hpp"
 
+#include <type_traits>
+
 namespace fin::core
 {
-    class Tick
+    // Price representation is a template parameter: Tick uses the floating
+    // Price, FixedTick the integer-ticks FixedPrice (see PriceTraits.hpp).
+    template <class P>
+    class BasicTick
     {
     public:
-        Tick(Timestamp ts, Symbol sym, Price p, Volume v);
+        using price_type = P;
+
+        constexpr BasicTick(Timestamp ts, Symbol sym, P p, Volume v) noexcept
+            : ts_(ts), symbol_(sym), price_(p), volume_(v) {}
 
-        Timestamp timestamp() const;
-        const Symbol &symbol() const;
-        Price price() const;
-        Volume volume() const;
+        constexpr Timestamp timestamp() const noexcept { return ts_; }
+        constexpr Symbol symbol() const noexcept { return symbol_; }
+        constexpr P price() const noexcept { return price_; }
+        constexpr Volume volume() const noexcept { return volume_; }
 
     private:
         Timestamp ts_;
         Symbol symbol_;
-        Price price_;
+        P price_;
         Volume volume_;
     };
 
+    using Tick = BasicTick<Price>;
+    using FixedTick = BasicTick<FixedPrice>;
+
+    // Conversions use the symbol's registered PriceScale.
+    FixedTick to_fixed(const Tick &t);
+    Tick to_double(const FixedTick &t);
+
+    // Ticks are copied through parse buffers and chunk queues by value.
+    static_assert(std::is_trivially_copyable_v<Tick>, "Tick must stay trivially copyable");
+    static_assert(std::is_trivially_copyable_v<FixedTick>, "FixedTick must stay trivially copyable");
+
 } // namespace fin::core
 
 #endif // FIN_CORE_TICK_HPP
@@ -2,19 +2,39 @@
 #ifndef FIN_CORE_VOLUME_HPP
 #define FIN_CORE_VOLUME_HPP
 
+#include <compare>
+#include <type_traits>
+
 namespace fin::core
 {
+    // Traded quantity strong type; header-only like Price.
     class Volume
     {
     public:
-        explicit Volume(double v);
-        double value() const;
+        constexpr Volume() noexcept = default;
+        constexpr explicit Volume(double v) noexcept : val_(v) {}
+
+        constexpr double value() const noexcept { return val_; }
+
+        constexpr auto operator<=>(const Volume &other) const noexcept = default;
 
-        Volume operator+(const Volume &other) const;
+        constexpr Volume operator+(Volume other) const noexcept { return Volume(val_ + other.val_); }
+        constexpr Volume operator-(Volume other) const noexcept { return Volume(val_ - other.val_); }
+        constexpr Volume operator*(double k) const noexcept { return Volume(val_ * k); }
+        constexpr Volume operator/(double k) const noexcept { return Volume(val_ / k); }
+        constexpr double operator/(Volume other) const noexcept { return val_ / other.val_; } // ratio
+        friend constexpr Volume operator*(double k, Volume v) noexcept { return Volume(k * v.val_); }
+
+        constexpr Volume &operator+=(Volume other) noexcept { val_ += other.val_; return *this; }
+        constexpr Volume &operator-=(Volume other) noexcept { val_ -= other.val_; return *this; }
+        constexpr Volume &operator*=(double k) noexcept { val_ *= k; return *this; }
+        constexpr Volume &operator/=(double k) noexcept { val_ /= k; return *this; }
 
     private:
-        double val_;
+        double val_ = 0.0;
     };
+
+    static_assert(std::is_trivially_copyable_v<Volume> && sizeof(Volume) == sizeof(double));
 }
 
 #endif // FIN_CORE_VOLUME_HPP
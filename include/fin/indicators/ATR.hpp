@@ -4,6 +4,7 @@
 
 #include <cstddef>
 #include <optional>
+#include <span>
 #include <vector>
 #include <cmath>
 #include <limits>
@@ -38,9 +39,9 @@ namespace fin::indicators
 
         // Batch helper with same warmup semantics.
         static std::vector<std::optional<double>>
-        compute(const std::vector<double> &highs,
-                const std::vector<double> &lows,
-                const std::vector<double> &closes,
+        compute(std::span<const double> highs,
+                std::span<const double> lows,
+                std::span<const double> closes,
                 std::size_t period = 14);
 
     private:
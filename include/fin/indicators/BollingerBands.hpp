@@ -3,9 +3,11 @@
 #define FIN_INDICATORS_BBANDS_HPP
 
 #include <cstddef>
-#include <deque>
 #include <optional>
+#include <span>
 #include <vector>
+
+#include "fin/core/DynamicRingBuffer.hpp"
 #include <cmath>
 
 namespace fin::indicators
@@ -18,7 +20,8 @@ namespace fin::indicators
      * Lower = SMA - k * stddev
      *
      * - Streaming API: update(x) -> optional<Bands>
-     * - Batch API: compute(vector<double>, period, k) -> vector<optional<Bands>>
+     * - Batch API: compute(span<const double>, period, k) -> vector<optional<Bands>>
+     * - Batch kernel: compute_into(values, middle, upper, lower, period, k) -> valid-from index
      * - Warmup: returns nullopt until enough samples
      *
      */
@@ -44,12 +47,18 @@ namespace fin::indicators
         std::optional<Bands> value() const { return current_; }
 
         static std::vector<std::optional<Bands>>
-        compute(const std::vector<double> &values, std::size_t period = 20, double k = 2.0);
+        compute(std::span<const double> values, std::size_t period = 20, double k = 2.0);
+
+        // Batch kernel into three caller buffers; same contract as
+        // SMA::compute_into (each buffer at least values.size() long).
+        static std::size_t
+        compute_into(std::span<const double> values, std::span<double> middle, std::span<double> upper,
+                     std::span<double> lower, std::size_t period = 20, double k = 2.0);
 
     private:
         std::size_t period_;
         double k_;
-        std::deque<double> buf_;
+        fin::core::DynamicRingBuffer<double> buf_; // period + 1 slots
         double sum_;
         double sumsq_;
         std::optional<Bands> current_;
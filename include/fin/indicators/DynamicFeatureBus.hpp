@@ -0,0 +1,71 @@
+#pragma once
+#ifndef FIN_INDICATORS_DYNAMIC_FEATURE_BUS_HPP
+#define FIN_INDICATORS_DYNAMIC_FEATURE_BUS_HPP
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "fin/core/Candle.hpp"
+#include "fin/core/CandleSeries.hpp"
+#include "fin/core/FeatureMatrix.hpp"
+#include "fin/indicators/FeatureSpec.hpp"
+#include "fin/indicators/IndicatorGraph.hpp"
+
+namespace fin::indicators
+{
+    /**
+     * @brief Feature bus over a feature set chosen at runtime.
+     *
+     * Columns follow feature_columns(specs) and are read from an
+     * IndicatorGraph, so indicators shared between features (MACD's EMAs and
+     * an EMA column) or with other readers of the same graph (a Backtester
+     * after share_indicators()) are computed once per candle.
+     */
+    class DynamicFeatureBus
+    {
+    public:
+        // Owns its graph. Throws std::invalid_argument on an empty set or
+        // duplicate column names.
+        explicit DynamicFeatureBus(std::vector<FeatureSpec> specs);
+
+        // Registers its nodes in `graph`, which must outlive the bus. update()
+        // advances the whole graph, so once per candle serves every reader.
+        DynamicFeatureBus(std::vector<FeatureSpec> specs, IndicatorGraph &graph);
+
+        DynamicFeatureBus(DynamicFeatureBus &&) noexcept = default;
+        DynamicFeatureBus &operator=(DynamicFeatureBus &&) noexcept = default;
+
+        const fin::core::FeatureSchemaPtr &schema() const noexcept { return schema_; }
+        std::size_t width() const noexcept { return schema_->size(); }
+        const std::vector<FeatureSpec> &specs() const noexcept { return specs_; }
+        IndicatorGraph &graph() noexcept { return *graph_; }
+
+        // Resets the graph, including nodes other readers registered.
+        void reset() { graph_->reset(); }
+
+        // Feeds one bar to the graph; true (with `out` filled) once every
+        // column is ready. `out` must hold width() values.
+        bool update(const FeatureInput &in, std::span<double> out);
+        bool update(const fin::core::Candle &c, std::span<double> out) { return update(FeatureInput::from(c), out); }
+
+        // The current row without advancing the graph.
+        bool read(std::span<double> out) const;
+
+        // Appends a row per ready bar of `bars`; returns the rows appended.
+        std::size_t update(const fin::core::CandleSeriesView &bars, fin::core::FeatureMatrix &out);
+
+    private:
+        void build();
+
+        std::vector<FeatureSpec> specs_;
+        fin::core::FeatureSchemaPtr schema_;
+        std::unique_ptr<IndicatorGraph> owned_;
+        IndicatorGraph *graph_ = nullptr;
+        std::vector<std::pair<IndicatorGraph::NodeId, std::size_t>> columns_; // node, output
+    };
+}
+
+#endif // FIN_INDICATORS_DYNAMIC_FEATURE_BUS_HPP
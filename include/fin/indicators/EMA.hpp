@@ -4,6 +4,7 @@
 
 #include <cstddef>
 #include <optional>
+#include <span>
 #include <vector>
 
 namespace fin::indicators
@@ -21,6 +22,7 @@ namespace fin::indicators
      *
      * Batch API:
      *   compute(values, period) -> vector<optional<double>>
+     *   compute_into(values, out, period) -> valid-from index (see SMA)
      */
     class EMA
     {
@@ -40,7 +42,11 @@ namespace fin::indicators
 
         // Batch helper: compute EMA series with same warmup semantics.
         static std::vector<std::optional<double>>
-        compute(const std::vector<double> &values, std::size_t period = 14);
+        compute(std::span<const double> values, std::size_t period = 14);
+
+        // Batch kernel into a caller buffer; same contract as SMA::compute_into.
+        static std::size_t
+        compute_into(std::span<const double> values, std::span<double> out, std::size_t period = 14);
 
     private:
         std::size_t period_;
@@ -1,12 +1,13 @@
 #pragma once
+#include <array>
 #include <optional>
 #include <vector>
 
 #include "fin/core/Candle.hpp"
+#include "fin/core/CandleSeries.hpp"
+#include "fin/core/FeatureMatrix.hpp"
 
-#include "fin/indicators/EMA.hpp"
-#include "fin/indicators/RSI.hpp"
-#include "fin/indicators/MACD.hpp"
+#include "fin/indicators/StaticFeatureBus.hpp"
 
 // Your adapters (close price from Candle, etc.)
 #include "fin/indicators/adapters/CandleAdapters.hpp"
@@ -25,6 +26,8 @@ namespace fin::indicators
         double macd_hist;
     };
 
+    // The default feature set (close, EMA, RSI, MACD) as a FeatureRow
+    // stream. Configured sets use StaticFeatureBus / DynamicFeatureBus directly.
     class FeatureBus
     {
     public:
@@ -36,11 +39,27 @@ namespace fin::indicators
 
         // Emits a row only when *all* indicators are ready
         std::optional<FeatureRow> update(const fin::core::Candle &c);
+        std::optional<FeatureRow> update(fin::core::Timestamp ts, double close);
+
+        // Feeds every bar of `bars` (close column only); returns the emitted rows.
+        std::vector<FeatureRow> update(const fin::core::CandleSeriesView &bars);
+
+        // Same, appending each emitted row's row_values() to `out` (whose
+        // schema must equal schema(), std::invalid_argument otherwise).
+        // Returns the number of rows appended.
+        std::size_t update(const fin::core::CandleSeriesView &bars, fin::core::FeatureMatrix &out);
+
+        // Column layout of the rows: close, ema_fast, rsi, macd, macd_signal, macd_hist.
+        using RowValues = std::array<double, 6>;
+        static const fin::core::FeatureSchemaPtr &schema();
+        static RowValues row_values(const FeatureRow &row) noexcept;
+
+        // The compile-time bus underneath; same columns as schema().
+        using Static = StaticFeatureBus<features::Close, features::Ema, features::Rsi, features::Macd>;
+        Static &bus() noexcept { return bus_; }
 
     private:
-        EMA ema_;
-        RSI rsi_;
-        MACD macd_;
+        Static bus_;
     };
 
 }
@@ -0,0 +1,240 @@
+#pragma once
+#ifndef FIN_INDICATORS_FEATURE_NODES_HPP
+#define FIN_INDICATORS_FEATURE_NODES_HPP
+
+#include <cstddef>
+#include <optional>
+
+#include "fin/core/Candle.hpp"
+#include "fin/core/CandleSeries.hpp"
+#include "fin/core/Price.hpp"
+#include "fin/indicators/ADX.hpp"
+#include "fin/indicators/ATR.hpp"
+#include "fin/indicators/BollingerBands.hpp"
+#include "fin/indicators/EMA.hpp"
+#include "fin/indicators/MACD.hpp"
+#include "fin/indicators/Momentum.hpp"
+#include "fin/indicators/RSI.hpp"
+#include "fin/indicators/SMA.hpp"
+#include "fin/indicators/Stochastic.hpp"
+#include "fin/indicators/VWAP.hpp"
+#include "fin/indicators/ZScore.hpp"
+
+namespace fin::indicators
+{
+    // The bar fields feature nodes read.
+    struct FeatureInput
+    {
+        double high = 0.0;
+        double low = 0.0;
+        double close = 0.0;
+        double volume = 0.0;
+
+        static FeatureInput from(const fin::core::Candle &c) noexcept
+        {
+            return {c.high().value(), c.low().value(), c.close().value(), c.volume().value()};
+        }
+        static FeatureInput from(const fin::core::CandleSeriesView &bars, std::size_t i) noexcept
+        {
+            return {bars.high[i], bars.low[i], bars.close[i], bars.volume[i]};
+        }
+    };
+
+    /**
+     * Feature nodes: one indicator each, writing `outputs` columns.
+     *
+     * update() feeds one bar and returns true once the indicator is ready,
+     * in which case out[0 .. outputs) hold its values. Nodes are plain
+     * non-virtual types so StaticFeatureBus can inline them; the runtime
+     * DynamicFeatureBus wraps the same types.
+     */
+    namespace features
+    {
+        struct Close
+        {
+            static constexpr std::size_t outputs = 1;
+            bool update(const FeatureInput &in, double *out) noexcept
+            {
+                out[0] = in.close;
+                return true;
+            }
+            void reset() noexcept {}
+        };
+
+        struct Sma
+        {
+            static constexpr std::size_t outputs = 1;
+            explicit Sma(std::size_t period = 14) : sma(period) {}
+            bool update(const FeatureInput &in, double *out)
+            {
+                const auto v = sma.update(in.close);
+                if (v)
+                    out[0] = *v;
+                return v.has_value();
+            }
+            void reset() { sma.reset(); }
+            SMA sma;
+        };
+
+        struct Ema
+        {
+            static constexpr std::size_t outputs = 1;
+            explicit Ema(std::size_t period = 12) : ema(period) {}
+            bool update(const FeatureInput &in, double *out)
+            {
+                const auto v = ema.update(in.close);
+                if (v)
+                    out[0] = *v;
+                return v.has_value();
+            }
+            void reset() { ema.reset(); }
+            EMA ema;
+        };
+
+        struct Rsi
+        {
+            static constexpr std::size_t outputs = 1;
+            explicit Rsi(std::size_t period = 14) : rsi(period) {}
+            bool update(const FeatureInput &in, double *out)
+            {
+                rsi.update(fin::core::Price(in.close));
+                if (!rsi.is_ready())
+                    return false;
+                out[0] = rsi.value();
+                return true;
+            }
+            void reset() { rsi.reset(); }
+            RSI rsi;
+        };
+
+        // macd, signal, hist
+        struct Macd
+        {
+            static constexpr std::size_t outputs = 3;
+            Macd(std::size_t fast = 12, std::size_t slow = 26, std::size_t signal = 9) : macd(fast, slow, signal) {}
+            bool update(const FeatureInput &in, double *out)
+            {
+                const auto v = macd.update(in.close);
+                if (!v)
+                    return false;
+                out[0] = v->macd;
+                out[1] = v->signal;
+                out[2] = v->hist;
+                return true;
+            }
+            void reset() { macd.reset(); }
+            MACD macd;
+        };
+
+        // middle, upper, lower
+        struct Bollinger
+        {
+            static constexpr std::size_t outputs = 3;
+            Bollinger(std::size_t period = 20, double k = 2.0) : bb(period, k) {}
+            bool update(const FeatureInput &in, double *out)
+            {
+                const auto v = bb.update(in.close);
+                if (!v)
+                    return false;
+                out[0] = v->middle;
+                out[1] = v->upper;
+                out[2] = v->lower;
+                return true;
+            }
+            void reset() { bb.reset(); }
+            BollingerBands bb;
+        };
+
+        struct Atr
+        {
+            static constexpr std::size_t outputs = 1;
+            explicit Atr(std::size_t period = 14) : atr(period) {}
+            bool update(const FeatureInput &in, double *out)
+            {
+                const auto v = atr.update(in.high, in.low, in.close);
+                if (v)
+                    out[0] = *v;
+                return v.has_value();
+            }
+            void reset() { atr.reset(); }
+            ATR atr;
+        };
+
+        struct Adx
+        {
+            static constexpr std::size_t outputs = 1;
+            explicit Adx(std::size_t period = 14) : adx(period) {}
+            bool update(const FeatureInput &in, double *out)
+            {
+                const auto v = adx.update(in.high, in.low, in.close);
+                if (v)
+                    out[0] = v->adx;
+                return v.has_value();
+            }
+            void reset() { adx.reset(); }
+            ADX adx;
+        };
+
+        // %K, %D
+        struct Stoch
+        {
+            static constexpr std::size_t outputs = 2;
+            Stoch(std::size_t k = 14, std::size_t d = 3) : st(k, d) {}
+            bool update(const FeatureInput &in, double *out)
+            {
+                const auto v = st.update(in.high, in.low, in.close);
+                if (!v)
+                    return false;
+                out[0] = v->k;
+                out[1] = v->d;
+                return true;
+            }
+            void reset() { st.reset(); }
+            Stochastic st;
+        };
+
+        struct Vwap
+        {
+            static constexpr std::size_t outputs = 1;
+            bool update(const FeatureInput &in, double *out)
+            {
+                out[0] = vwap.update(in.high, in.low, in.close, in.volume);
+                return true;
+            }
+            void reset() { vwap.reset_session(); }
+            VWAP vwap;
+        };
+
+        struct ZScoreOf
+        {
+            static constexpr std::size_t outputs = 1;
+            explicit ZScoreOf(std::size_t period = 20) : zs(period) {}
+            bool update(const FeatureInput &in, double *out)
+            {
+                const auto v = zs.update(in.close);
+                if (v)
+                    out[0] = *v;
+                return v.has_value();
+            }
+            void reset() { zs.reset(); }
+            ZScore zs;
+        };
+
+        struct MomentumOf
+        {
+            static constexpr std::size_t outputs = 1;
+            explicit MomentumOf(std::size_t period = 10) : mom(period) {}
+            bool update(const FeatureInput &in, double *out)
+            {
+                const auto v = mom.update(in.close);
+                if (v)
+                    out[0] = *v;
+                return v.has_value();
+            }
+            void reset() { mom.reset(); }
+            Momentum mom;
+        };
+    } // namespace features
+}
+
+#endif // FIN_INDICATORS_FEATURE_NODES_HPP
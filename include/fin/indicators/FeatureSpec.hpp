@@ -0,0 +1,72 @@
+#pragma once
+#ifndef FIN_INDICATORS_FEATURE_SPEC_HPP
+#define FIN_INDICATORS_FEATURE_SPEC_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fin::indicators
+{
+    enum class FeatureKind
+    {
+        Close,      // close price
+        Sma,        // period
+        Ema,        // period
+        Rsi,        // period
+        Macd,       // fast, slow, signal -> macd, _signal, _hist
+        Bollinger,  // period, k -> middle, _upper, _lower
+        Atr,        // period
+        Adx,        // period
+        Stochastic, // k period, d period -> %K, _d
+        Vwap,       // session VWAP of the typical price
+        ZScore,     // period
+        Momentum    // period (difference mode)
+    };
+
+    /**
+     * @brief One entry of a configurable feature set.
+     *
+     * Token grammar: `[name=]kind[:p1[:p2[:p3]]]`, kinds close, sma, ema,
+     * rsi, macd, bbands, atr, adx, stoch, vwap, zscore, momentum; omitted
+     * parameters take the indicator defaults. Without `name=` the column is
+     * named after the kind and parameters (`ema_12`, `macd_12_26_9`); extra
+     * outputs append a suffix (`macd_signal`, `macd_hist`).
+     */
+    struct FeatureSpec
+    {
+        FeatureKind kind = FeatureKind::Close;
+        std::string name;           // first column; see feature_columns()
+        std::vector<double> params; // all parameters, defaults filled in
+
+        std::size_t period(std::size_t i) const { return static_cast<std::size_t>(params.at(i)); }
+    };
+
+    // nullopt on an unknown kind, bad or out-of-range parameters (periods
+    // are whole numbers up to 1e9), or a `close=` alias on another kind.
+    std::optional<FeatureSpec> parse_feature_spec(std::string_view token);
+
+    // Comma-separated tokens; nullopt if any token is invalid, the list is
+    // empty or feature_spec_error() rejects it.
+    std::optional<std::vector<FeatureSpec>> parse_feature_specs(std::string_view list);
+
+    // Why `specs` cannot build a feature bus: two columns share a name, or a
+    // non-close spec is named "close". nullopt when the set is usable.
+    std::optional<std::string> feature_spec_error(const std::vector<FeatureSpec> &specs);
+
+    // Canonical token, parseable by parse_feature_spec().
+    std::string to_string(const FeatureSpec &spec);
+
+    // Output columns of `spec`, in the order a feature bus writes them.
+    std::vector<std::string> feature_columns(const FeatureSpec &spec);
+    std::vector<std::string> feature_columns(const std::vector<FeatureSpec> &specs);
+
+    // The fixed FeatureBus set: close, ema_fast, rsi, macd (+ _signal, _hist).
+    std::vector<FeatureSpec> default_feature_specs(std::size_t ema_fast = 12, std::size_t rsi_period = 14,
+                                                   std::size_t macd_fast = 12, std::size_t macd_slow = 26,
+                                                   std::size_t macd_signal = 9);
+}
+
+#endif // FIN_INDICATORS_FEATURE_SPEC_HPP
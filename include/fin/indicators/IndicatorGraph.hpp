@@ -0,0 +1,118 @@
+#pragma once
+#ifndef FIN_INDICATORS_INDICATOR_GRAPH_HPP
+#define FIN_INDICATORS_INDICATOR_GRAPH_HPP
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <variant>
+#include <vector>
+
+#include "fin/core/Candle.hpp"
+#include "fin/indicators/EMA.hpp"
+#include "fin/indicators/FeatureNodes.hpp"
+#include "fin/indicators/FeatureSpec.hpp"
+#include "fin/indicators/RSI.hpp"
+#include "fin/indicators/SMA.hpp"
+
+namespace fin::indicators
+{
+    /**
+     * @brief Per-candle indicator DAG with deduplicated nodes.
+     *
+     * Every consumer (feature bus, backtester, ...) registers the indicators
+     * it needs; asking twice for the same (indicator, parameters, input)
+     * returns the existing node, so each is computed once per candle however
+     * many readers it has. MACD is built from its EMAs rather than owning
+     * them, so `macd:12:26:9` next to `ema:12` costs one 12-period EMA.
+     *
+     * The owner calls update() once per candle, then readers call ready() /
+     * value(). Nodes are evaluated in registration order, which is always a
+     * topological order since inputs must exist before their consumers.
+     */
+    class IndicatorGraph
+    {
+    public:
+        using NodeId = std::size_t;
+
+        struct MacdNodes
+        {
+            NodeId macd;
+            NodeId signal;
+            NodeId hist;
+        };
+
+        IndicatorGraph();
+        ~IndicatorGraph();
+        IndicatorGraph(IndicatorGraph &&) noexcept;
+        IndicatorGraph &operator=(IndicatorGraph &&) noexcept;
+
+        // The candle close; ready on every update.
+        NodeId close() const noexcept { return 0; }
+
+        // Moving averages of `input` (default close), fed only while it is ready.
+        NodeId ema(std::size_t period) { return ema(period, close()); }
+        NodeId ema(std::size_t period, NodeId input);
+        NodeId sma(std::size_t period) { return sma(period, close()); }
+        NodeId sma(std::size_t period, NodeId input);
+
+        // RSI of the close.
+        NodeId rsi(std::size_t period);
+
+        // a - b, ready once both are.
+        NodeId diff(NodeId a, NodeId b);
+
+        // ema(fast) - ema(slow), its signal EMA and the histogram; same values as MACD.
+        MacdNodes macd(std::size_t fast, std::size_t slow, std::size_t signal);
+
+        // Any spec kind the nodes above do not cover (bbands, atr, stoch, ...),
+        // as one node with feature_columns(spec).size() outputs. Composable kinds
+        // (close, ema, sma, rsi, macd) map to the nodes above instead.
+        NodeId feature(const FeatureSpec &spec);
+
+        void update(const FeatureInput &in);
+        void update(const fin::core::Candle &c) { update(FeatureInput::from(c)); }
+        void reset();
+
+        // Distinct nodes, i.e. indicators computed per update().
+        std::size_t size() const noexcept { return nodes_.size(); }
+
+        bool ready(NodeId id) const { return ready_[id] != 0; }
+        double value(NodeId id, std::size_t output = 0) const { return values_[nodes_[id].slot + output]; }
+        std::optional<double> get(NodeId id) const
+        {
+            return ready(id) ? std::optional<double>(value(id)) : std::nullopt;
+        }
+
+        struct Opaque;
+
+    private:
+        enum class Op
+        {
+            Close,
+            Ema,
+            Sma,
+            Rsi,
+            Diff,
+            Feature
+        };
+
+        struct Node
+        {
+            Op op = Op::Close;
+            FeatureKind kind = FeatureKind::Close; // Feature nodes only
+            NodeId a = 0, b = 0;                   // inputs
+            std::vector<double> params;
+            std::size_t slot = 0; // first output in values_
+            std::variant<std::monostate, EMA, SMA, RSI, std::unique_ptr<Opaque>> state;
+        };
+
+        NodeId find_or_add(Node node, std::size_t outputs);
+
+        std::vector<Node> nodes_;
+        std::vector<double> values_;
+        std::vector<char> ready_;
+    };
+}
+
+#endif // FIN_INDICATORS_INDICATOR_GRAPH_HPP
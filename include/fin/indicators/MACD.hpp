@@ -4,6 +4,7 @@
 
 #include <cstddef>
 #include <optional>
+#include <span>
 #include <vector>
 #include "fin/indicators/EMA.hpp"
 
@@ -28,7 +29,7 @@ namespace fin::indicators
         std::optional<MACDValue> update(double close);
 
         static std::vector<std::optional<MACDValue>>
-        compute(const std::vector<double> &closes,
+        compute(std::span<const double> closes,
                 std::size_t fast = 12, std::size_t slow = 26, std::size_t signal = 9);
 
         std::size_t fast_period() const noexcept { return fast_; }
@@ -3,9 +3,11 @@
 #define FIN_INDICATORS_MOMENTUM_HPP
 
 #include <cstddef>
-#include <deque>
 #include <optional>
+#include <span>
 #include <vector>
+
+#include "fin/core/DynamicRingBuffer.hpp"
 #include <cmath>
 
 namespace fin::indicators
@@ -39,14 +41,14 @@ namespace fin::indicators
         std::optional<double> value() const { return current_; }
 
         static std::vector<std::optional<double>>
-        compute(const std::vector<double> &closes,
+        compute(std::span<const double> closes,
                 std::size_t period = 10,
                 Mode mode = Mode::Difference);
 
     private:
         std::size_t period_;
         Mode mode_;
-        std::deque<double> buf_;
+        fin::core::DynamicRingBuffer<double> buf_; // period + 1 slots
         std::optional<double> current_;
     };
 
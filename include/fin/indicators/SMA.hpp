@@ -3,10 +3,12 @@
 #define FIN_INDICATORS_SMA_CPP
 
 #include <cstddef>
-#include <deque>
 #include <optional>
+#include <span>
 #include <vector>
 
+#include "fin/core/DynamicRingBuffer.hpp"
+
 namespace fin::indicators
 {
 
@@ -14,7 +16,8 @@ namespace fin::indicators
      * @brief Simple Moving Average (SMA)
      *
      * - Streaming API: update(x) -> optional<double>
-     * - Batch API: compute(vector<double>, period) -> vector<optional<double>>
+     * - Batch API: compute(span<const double>, period) -> vector<optional<double>>
+     * - Batch kernel: compute_into(values, out, period) -> valid-from index
      * - Warmup: returns std::nullopt until enough samples are available
      * - O(1) per update, O(period) space
      */
@@ -35,11 +38,18 @@ namespace fin::indicators
 
         // Batch mode: compute SMA series for a full vector
         static std::vector<std::optional<double>>
-        compute(const std::vector<double> &values, std::size_t period = 14);
+        compute(std::span<const double> values, std::size_t period = 14);
+
+        // Batch kernel over a caller buffer (out.size() >= values.size(), no
+        // overlap with values). Writes SMA(i) to out[i] for every i >= the
+        // returned valid-from index (period - 1, or values.size() if the window
+        // never fills); earlier entries are NaN. Same arithmetic as update().
+        static std::size_t
+        compute_into(std::span<const double> values, std::span<double> out, std::size_t period = 14);
 
     private:
         std::size_t period_;
-        std::deque<double> buf_;
+        fin::core::DynamicRingBuffer<double> buf_; // period + 1 slots
         double sum_;
         std::optional<double> current_;
     };
@@ -0,0 +1,104 @@
+#pragma once
+#ifndef FIN_INDICATORS_STATIC_FEATURE_BUS_HPP
+#define FIN_INDICATORS_STATIC_FEATURE_BUS_HPP
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "fin/core/CandleSeries.hpp"
+#include "fin/core/FeatureMatrix.hpp"
+#include "fin/indicators/FeatureNodes.hpp"
+
+namespace fin::indicators
+{
+    /**
+     * @brief Feature bus over a compile-time set of feature nodes.
+     *
+     * update() is a fold over the node tuple, so every indicator is called
+     * directly and can be inlined; no virtual dispatch and no per-node loop.
+     * Use it when the set is fixed in code (FeatureBus is one); runtime
+     * configured sets go through DynamicFeatureBus, which has the same
+     * update()/schema() surface.
+     */
+    template <class... Features>
+    class StaticFeatureBus
+    {
+    public:
+        static constexpr std::size_t kWidth = (Features::outputs + ... + 0);
+        using Row = std::array<double, kWidth>;
+
+        // `schema` names the kWidth columns (std::invalid_argument otherwise).
+        explicit StaticFeatureBus(fin::core::FeatureSchemaPtr schema, Features... features)
+            : schema_(std::move(schema)), features_(std::move(features)...)
+        {
+            if (!schema_ || schema_->size() != kWidth)
+                throw std::invalid_argument("StaticFeatureBus: schema width does not match the features");
+        }
+
+        const fin::core::FeatureSchemaPtr &schema() const noexcept { return schema_; }
+        static constexpr std::size_t width() noexcept { return kWidth; }
+
+        void reset()
+        {
+            std::apply([](auto &...f)
+                       { (f.reset(), ...); },
+                       features_);
+        }
+
+        // Feeds one bar to every node; true (with `out` filled) once all are ready.
+        bool update(const FeatureInput &in, std::span<double, kWidth> out)
+        {
+            return update_all(in, out.data(), std::index_sequence_for<Features...>{});
+        }
+
+        std::optional<Row> update(const FeatureInput &in)
+        {
+            Row row;
+            if (!update(in, row))
+                return std::nullopt;
+            return row;
+        }
+
+        // Appends a row per ready bar of `bars`; returns the rows appended.
+        std::size_t update(const fin::core::CandleSeriesView &bars, fin::core::FeatureMatrix &out)
+        {
+            if (!(*out.schema() == *schema_))
+                throw std::invalid_argument("StaticFeatureBus::update() matrix schema does not match the bus");
+            const std::size_t before = out.rows();
+            Row row;
+            for (std::size_t i = 0; i < bars.size(); ++i)
+                if (update(FeatureInput::from(bars, i), row))
+                    out.append(bars.ts[i], row);
+            return out.rows() - before;
+        }
+
+    private:
+        static constexpr std::array<std::size_t, sizeof...(Features) + 1> offsets()
+        {
+            std::array<std::size_t, sizeof...(Features) + 1> o{};
+            std::size_t i = 0;
+            ((o[i + 1] = o[i] + Features::outputs, ++i), ...);
+            return o;
+        }
+        static constexpr auto kOffsets = offsets();
+
+        template <std::size_t... I>
+        bool update_all(const FeatureInput &in, double *out, std::index_sequence<I...>)
+        {
+            // `&` rather than `&&`: every node must see every bar.
+            bool ready = true;
+            ((ready &= std::get<I>(features_).update(in, out + kOffsets[I])), ...);
+            return ready;
+        }
+
+        fin::core::FeatureSchemaPtr schema_;
+        std::tuple<Features...> features_;
+    };
+}
+
+#endif // FIN_INDICATORS_STATIC_FEATURE_BUS_HPP
@@ -3,11 +3,14 @@
 #define FIN_INDICATORS_STOCHASTIC_HPP
 
 #include <cstddef>
-#include <deque>
 #include <optional>
+#include <span>
 #include <vector>
 #include <cmath>
 
+#include "fin/core/DynamicRingBuffer.hpp"
+#include "fin/core/MonotonicDeque.hpp"
+
 namespace fin::indicators
 {
     struct StochOut
@@ -18,7 +21,7 @@ namespace fin::indicators
 
     /**
      * @brief Stochastic Oscillator (%K, %D)
-     * - Rolling HH/LL in O(1) via deques monotónicas
+     * - Rolling HH/LL in amortized O(1) via monotonic deques
      * - %K = 100 * (close - LL) / (HH - LL); if HH==LL => %K = 50
      * - %D = SMA(%K, dPeriod).
      * - update(high, low, close) returns std::nullopt until both (K and D) having warmup
@@ -42,38 +45,27 @@ namespace fin::indicators
 
         // Batch helper (same semantics for warmup)
         static std::vector<std::optional<StochOut>>
-        compute(const std::vector<double> &highs,
-                const std::vector<double> &lows,
-                const std::vector<double> &closes,
+        compute(std::span<const double> highs,
+                std::span<const double> lows,
+                std::span<const double> closes,
                 std::size_t kPeriod = 14, std::size_t dPeriod = 3);
 
     private:
-        struct Node
-        {
-            double v;
-            std::size_t idx;
-        };
-
-        // Keep the maximum (descending) and the minimum (increasing) in O(1)
-        void push_high(double h);
-        void push_low(double l);
-        void evict_old(std::size_t window_start);
-
-        double highest_high() const { return dqHigh_.empty() ? NAN : dqHigh_.front().v; }
-        double lowest_low() const { return dqLow_.empty() ? NAN : dqLow_.front().v; }
+        double highest_high() const { return dqHigh_.empty() ? NAN : dqHigh_.front(); }
+        double lowest_low() const { return dqLow_.empty() ? NAN : dqLow_.front(); }
 
         std::size_t kPeriod_;
         std::size_t dPeriod_;
 
-        // Monothonics Deques to HH/LL
-        std::deque<Node> dqHigh_; // descending values (front = greatest)
-        std::deque<Node> dqLow_;  // ascending values (front = minor)
+        // Monotonic deques for HH/LL
+        fin::core::RollingMax<double> dqHigh_; // descending values (front = greatest)
+        fin::core::RollingMin<double> dqLow_;  // ascending values (front = smallest)
 
         // Current Index (0-based)
         std::size_t idx_ = 0;
 
         // For %D (SMA of %k)
-        std::deque<double> kBuf_;
+        fin::core::DynamicRingBuffer<double> kBuf_; // dPeriod + 1 slots
         double kSum_ = 0.0;
 
         std::optional<StochOut> current_;
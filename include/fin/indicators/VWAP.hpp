@@ -4,6 +4,7 @@
 
 #include <cstddef>
 #include <optional>
+#include <span>
 #include <vector>
 #include <cmath>
 #include <limits>
@@ -44,14 +45,14 @@ namespace fin::indicators
 
         // Batch helpers (direct price/volume)
         static std::vector<double>
-        compute(const std::vector<double> &prices,
-                const std::vector<double> &volumes);
+        compute(std::span<const double> prices,
+                std::span<const double> volumes);
 
         static std::vector<double>
-        compute(const std::vector<double> &highs,
-                const std::vector<double> &lows,
-                const std::vector<double> &closes,
-                const std::vector<double> &volumes);
+        compute(std::span<const double> highs,
+                std::span<const double> lows,
+                std::span<const double> closes,
+                std::span<const double> volumes);
 
     private:
         double cum_pv_;
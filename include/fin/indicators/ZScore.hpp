@@ -3,9 +3,11 @@
 #define FIN_INDICATORS_ZSCORE_HPP
 
 #include <cstddef>
-#include <deque>
 #include <optional>
+#include <span>
 #include <vector>
+
+#include "fin/core/DynamicRingBuffer.hpp"
 #include <cmath>
 
 namespace fin::indicators
@@ -34,11 +36,22 @@ namespace fin::indicators
 
         // Batch convenience with same warmup semantics.
         static std::vector<std::optional<double>>
-        compute(const std::vector<double> &values, std::size_t period = 20);
+        compute(std::span<const double> values, std::size_t period = 20);
+
+        // Batch kernel into a caller buffer; same contract as SMA::compute_into.
+        // Allocates one values.size() scratch buffer per call.
+        static std::size_t
+        compute_into(std::span<const double> values, std::span<double> out, std::size_t period = 20);
+
+        // Same, with caller-owned scratch (at least values.size()) so repeated
+        // calls do not allocate; its contents on return are unspecified.
+        static std::size_t
+        compute_into(std::span<const double> values, std::span<double> out, std::span<double> scratch,
+                     std::size_t period = 20);
 
     private:
         std::size_t period_;
-        std::deque<double> buf_;
+        fin::core::DynamicRingBuffer<double> buf_; // period + 1 slots
         double sum_;
         double sumsq_;
         std::optional<double> current_;
@@ -0,0 +1,49 @@
+#pragma once
+#ifndef FIN_IO_CSV_SCAN_HPP
+#define FIN_IO_CSV_SCAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace fin::io
+{
+    /**
+     * @brief Structural-character scanner for delimited text.
+     *
+     * scan_separators() records the offset of every delimiter and '\n' byte in
+     * a block, so a reader can slice rows and fields without looking at the
+     * remaining bytes again. Vector kernels compare 16 (SSE2) or 32 (AVX2)
+     * bytes per step and turn the match mask into offsets; the scalar kernel
+     * walks one byte at a time and is always available. The best kernel the
+     * CPU supports is picked once at runtime.
+     */
+    enum class ScanKernel
+    {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    // Writes the offset (relative to `data`) of each `delim` / '\n' byte into
+    // `out`, in increasing order, and returns how many were written. `out` must
+    // hold at least `size` entries; `size` must fit in 32 bits.
+    using ScanFn = std::size_t (*)(const char *data, std::size_t size, char delim, std::uint32_t *out);
+
+    // Fastest kernel supported by the running CPU (detected once).
+    ScanKernel best_scan_kernel() noexcept;
+
+    bool scan_kernel_supported(ScanKernel kernel) noexcept;
+
+    const char *scan_kernel_name(ScanKernel kernel) noexcept;
+
+    // Kernel entry point; unsupported kernels resolve to the scalar one.
+    ScanFn scan_function(ScanKernel kernel) noexcept;
+
+    inline std::size_t scan_separators(const char *data, std::size_t size, char delim, std::uint32_t *out)
+    {
+        return scan_function(best_scan_kernel())(data, size, delim, out);
+    }
+
+} // namespace fin::io
+
+#endif // FIN_IO_CSV_SCAN_HPP
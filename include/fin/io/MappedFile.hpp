@@ -0,0 +1,55 @@
+#pragma once
+#ifndef FIN_IO_MAPPED_FILE_HPP
+#define FIN_IO_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace fin::io
+{
+    /**
+     * @brief Read-only view of a whole file.
+     *
+     * On POSIX the file is mmap'ed (MAP_PRIVATE, sequential advice) so readers
+     * can tokenize it in place without copying. Other platforms fall back to a
+     * single heap buffer holding the file contents. Move-only.
+     */
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        explicit MappedFile(const std::string &path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+        MappedFile(MappedFile &&other) noexcept;
+        MappedFile &operator=(MappedFile &&other) noexcept;
+
+        // False when the file could not be opened (missing, unreadable, ...).
+        // An empty file is open but has size() == 0.
+        bool is_open() const noexcept { return open_; }
+
+        const char *data() const noexcept { return data_; }
+        std::size_t size() const noexcept { return size_; }
+        std::string_view view() const noexcept { return {data_, size_}; }
+
+        // Drops the resident pages fully inside [offset, offset + length) so
+        // sequential readers do not accumulate the whole file in RSS; the
+        // bytes stay readable (they fault back in from the file). No-op for
+        // the heap fallback.
+        void release_pages(std::size_t offset, std::size_t length) const noexcept;
+
+    private:
+        void release() noexcept;
+
+        const char *data_ = nullptr;
+        std::size_t size_ = 0;
+        bool open_ = false;
+        bool mapped_ = false; // true => munmap on release, false => delete[]
+    };
+
+} // namespace fin::io
+
+#endif // FIN_IO_MAPPED_FILE_HPP
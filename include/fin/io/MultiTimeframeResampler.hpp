@@ -0,0 +1,79 @@
+#pragma once
+#ifndef FIN_IO_MULTI_TIMEFRAME_RESAMPLER_HPP
+#define FIN_IO_MULTI_TIMEFRAME_RESAMPLER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include "fin/core/CandleSeries.hpp"
+#include "fin/core/Tick.hpp"
+#include "fin/io/Options.hpp"
+#include "fin/io/Resampler.hpp"
+#include "fin/io/TickBatch.hpp"
+
+namespace fin::io
+{
+    /**
+     * @brief One pass over the ticks, candles for several timeframes.
+     *
+     * Ticks only go through a TickToCandleResampler for the smallest
+     * timeframe; every larger one is folded from the finished bars of the
+     * next smaller one (M1 bars -> M5 bars -> H1 bars), so adding a timeframe
+     * costs a little work per lower bar rather than per tick.
+     *
+     * Bars match a separate TickToCandleResampler per timeframe (same bucket
+     * starts, OHLC, out-of-order drops); volume is summed per lower bar, so
+     * it can differ from a direct pass in the last bit for fractional sizes.
+     */
+    class MultiTimeframeResampler
+    {
+    public:
+        // Timeframes in any order, duplicates ignored. Each must be a whole
+        // multiple of the next smaller one; throws std::invalid_argument if
+        // not or if the list is empty. `max_lateness` goes to the base
+        // resampler (see BasicTickToCandleResampler).
+        explicit MultiTimeframeResampler(std::vector<Timeframe> timeframes,
+                                         std::chrono::nanoseconds max_lateness = {});
+
+        void update(const fin::core::Tick &t);
+        void update_batch(const TickBatch &batch);
+
+        // Closes the partial bar of every timeframe.
+        void flush();
+
+        // Ascending by duration.
+        const std::vector<Timeframe> &timeframes() const noexcept { return timeframes_; }
+
+        // Bars so far for `tf`; throws std::out_of_range for a timeframe not configured.
+        const fin::core::CandleSeries &series(Timeframe tf) const;
+
+        // Moves the bars of `tf` out, leaving an empty series that keeps filling.
+        fin::core::CandleSeries take(Timeframe tf);
+
+        const LateTickStats &late_stats() const noexcept { return base_.late_stats(); }
+
+    private:
+        // Candle -> candle aggregation for one timeframe above the base.
+        struct Level
+        {
+            std::chrono::nanoseconds dur{};
+            std::size_t fed = 0; // bars of the level below folded in so far
+            bool has_open = false;
+            fin::core::Timestamp start{}, end{};
+            double open = 0, high = 0, low = 0, close = 0, vol = 0;
+        };
+
+        std::size_t index_of(Timeframe tf) const;
+        void cascade();
+        void fold(Level &level, const fin::core::CandleSeriesView &below, fin::core::CandleSeries &out);
+
+        std::vector<Timeframe> timeframes_;
+        std::vector<fin::core::CandleSeries> series_; // one per timeframe
+        TickToCandleResampler base_;
+        std::vector<Level> levels_; // levels_[k] builds series_[k]; levels_[0] is unused
+    };
+
+} // namespace fin::io
+
+#endif // FIN_IO_MULTI_TIMEFRAME_RESAMPLER_HPP
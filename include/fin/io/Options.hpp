@@ -1,6 +1,8 @@
 #pragma once
 #include <string>
 
+#include "fin/io/Timeframe.hpp"
+
 namespace fin::io
 {
     enum class TimeFormat
@@ -21,13 +23,4 @@ namespace fin::io
         std::string volume_col = "volume";
     };
 
-    enum class Timeframe
-    {
-        S1,
-        S5,
-        M1,
-        M5,
-        H1
-    }; // add as needed M5, H1,
-
 } // namespace fin::io
@@ -0,0 +1,44 @@
+#pragma once
+#ifndef FIN_IO_PARALLEL_INGEST_HPP
+#define FIN_IO_PARALLEL_INGEST_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "fin/io/Options.hpp"
+#include "fin/io/Sources.hpp" // ReadStats
+#include "fin/core/Tick.hpp"
+
+namespace fin::io
+{
+    struct ParallelIngestOptions
+    {
+        std::size_t threads = 0;               // 0 => std::thread::hardware_concurrency()
+        std::size_t chunk_bytes = 8u << 20;    // target byte range per task (newline-aligned)
+        std::size_t max_chunks_in_flight = 0;  // parsed-but-unconsumed cap; 0 => 2 * threads
+    };
+
+    // Receives the ticks of one chunk, in file order.
+    using TickChunkSink = std::function<void(const std::vector<fin::core::Tick> &)>;
+
+    /**
+     * @brief Parses a tick CSV on several threads and replays it in order.
+     *
+     * The mapped file is split into newline-aligned byte ranges after the
+     * header row; worker threads parse ranges independently while the calling
+     * thread hands finished chunks to `sink` strictly in file order. At most
+     * `max_chunks_in_flight` parsed chunks are buffered, so memory stays
+     * bounded on large files. Returned ReadStats are the exact sums of the
+     * per-chunk counts (header row included), identical to a sequential read.
+     * Exceptions thrown by `sink` stop the workers and are rethrown.
+     */
+    ReadStats for_each_tick_chunk_parallel(const std::string &path,
+                                           const TickCsvOptions &opt,
+                                           const ParallelIngestOptions &popt,
+                                           const TickChunkSink &sink);
+
+} // namespace fin::io
+
+#endif // FIN_IO_PARALLEL_INGEST_HPP
@@ -1,11 +1,17 @@
 #pragma once
+#include <chrono>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "fin/io/Options.hpp"   // for TickCsvOptions (complete type for default arg)
-#include "fin/io/Sources.hpp"   // FileTickSource
+#include "fin/io/Sources.hpp"   // MmapTickSource
 #include "fin/io/Resampler.hpp" // TickToCandleResampler
+#include "fin/io/MultiTimeframeResampler.hpp"
+#include "fin/io/ParallelIngest.hpp"
+#include "fin/io/TickStore.hpp"   // TickStoreSource
 #include "fin/core/Candle.hpp"
+#include "fin/core/CandleSeries.hpp"
 
 namespace fin::io
 {
@@ -13,50 +19,226 @@ namespace fin::io
     {
         std::vector<fin::core::Candle> candles;
         ReadStats stats; // rows/parsed/skipped from the source
+        LateTickStats late; // out-of-order ticks seen by the resampler
     };
 
-    // Reads ticks from CSV and returns M1 candles (UTC, no gap fill)
+    // Same as PipelineResult, with the candles in structure-of-arrays form.
+    struct SeriesPipelineResult
+    {
+        fin::core::CandleSeries candles;
+        ReadStats stats;
+        LateTickStats late;
+    };
 
-    inline PipelineResult
-    resample_csv_m1_with_stats(const std::string &path, const TickCsvOptions &opt = TickCsvOptions{})
+    // One series per timeframe from a single read (see MultiTimeframeResampler).
+    struct TimeframeSeries
+    {
+        Timeframe tf;
+        fin::core::CandleSeries candles;
+    };
+
+    struct MultiSeriesPipelineResult
     {
-        FileTickSource src(path, opt);
-        TickToCandleResampler res(Timeframe::M1);
+        std::vector<TimeframeSeries> series; // ascending timeframe
+        ReadStats stats;
+        LateTickStats late;
+    };
+
+    // Drains any tick source through the resampler; tick sources are read a
+    // TickBatch at a time. Every helper below takes an optional lateness
+    // bound for out-of-order ticks (0 => drop them; see TickToCandleResampler).
+    template <class Source>
+    PipelineResult resample_source_with_stats(Source &src, Timeframe tf,
+                                              std::chrono::nanoseconds max_lateness = {})
+    {
+        TickToCandleResampler res(tf, max_lateness);
 
         PipelineResult r{};
-        while (auto t = src.next())
+        if constexpr (std::is_base_of_v<ITickSource, Source>)
+        {
+            TickBatch batch;
+            fin::core::CandleSeries bars;
+            while (src.next_batch(batch))
+            {
+                res.update_batch(batch, bars);
+                const auto view = bars.view();
+                for (std::size_t i = 0; i < view.size(); ++i)
+                    r.candles.push_back(view.candle(i));
+                bars.clear();
+            }
+        }
+        else
         {
-            if (auto c = res.update(*t))
-                r.candles.push_back(*c);
+            while (auto t = src.next())
+            {
+                if (auto c = res.update(*t))
+                    r.candles.push_back(*c);
+            }
         }
-        if (auto c = res.flush())
+        while (auto c = res.flush())
             r.candles.push_back(*c);
 
         r.stats = src.stats();
+        r.late = res.late_stats();
         return r;
     }
 
+    // Reads ticks from CSV and returns M1 candles (UTC, no gap fill).
+    // Both helpers use the memory-mapped reader; FileTickSource stays available
+    // for stream-style reads.
+
+    inline PipelineResult
+    resample_csv_m1_with_stats(const std::string &path, const TickCsvOptions &opt = TickCsvOptions{},
+                               std::chrono::nanoseconds max_lateness = {})
+    {
+        MmapTickSource src(path, opt);
+        return resample_source_with_stats(src, Timeframe::M1, max_lateness);
+    }
+
     // Generic timeframe version for CLI (MVP)
     inline PipelineResult
     resample_csv_with_stats(const std::string &path,
                             Timeframe tf,
-                            const TickCsvOptions &opt = TickCsvOptions{})
+                            const TickCsvOptions &opt = TickCsvOptions{},
+                            std::chrono::nanoseconds max_lateness = {})
     {
-        FileTickSource src(path, opt);
-        TickToCandleResampler res(tf);
+        MmapTickSource src(path, opt);
+        return resample_source_with_stats(src, tf, max_lateness);
+    }
 
-        PipelineResult r{};
-        while (auto t = src.next())
+    // Accepts a tick CSV or a binary tick store (detected by magic header);
+    // `opt` only applies to CSV input.
+    inline PipelineResult
+    resample_ticks_with_stats(const std::string &path,
+                              Timeframe tf,
+                              const TickCsvOptions &opt = TickCsvOptions{},
+                              std::chrono::nanoseconds max_lateness = {})
+    {
+        if (is_tick_store_file(path))
         {
-            if (auto c = res.update(*t))
-                r.candles.push_back(*c);
+            TickStoreSource src(path);
+            return resample_source_with_stats(src, tf, max_lateness);
         }
-        if (auto c = res.flush())
+        return resample_csv_with_stats(path, tf, opt, max_lateness);
+    }
+
+    // Parallel ingest: ranges are parsed on worker threads, ticks reach the
+    // resampler in file order, stats are the exact per-chunk sums.
+    inline PipelineResult
+    resample_csv_parallel_with_stats(const std::string &path,
+                                     Timeframe tf,
+                                     const TickCsvOptions &opt = TickCsvOptions{},
+                                     const ParallelIngestOptions &popt = ParallelIngestOptions{},
+                                     std::chrono::nanoseconds max_lateness = {})
+    {
+        TickToCandleResampler res(tf, max_lateness);
+
+        PipelineResult r{};
+        r.stats = for_each_tick_chunk_parallel(path, opt, popt, [&](const std::vector<fin::core::Tick> &ticks)
+                                               {
+                                                   for (const auto &t : ticks)
+                                                       if (auto c = res.update(t))
+                                                           r.candles.push_back(*c); });
+        while (auto c = res.flush())
             r.candles.push_back(*c);
-        
+        r.late = res.late_stats();
+        return r;
+    }
+
+    // Series variants: the resampler appends bars straight into a CandleSeries.
+
+    template <class Source>
+    SeriesPipelineResult resample_source_to_series(Source &src, Timeframe tf,
+                                                   std::chrono::nanoseconds max_lateness = {})
+    {
+        TickToCandleResampler res(tf, max_lateness);
+
+        SeriesPipelineResult r{};
+        if constexpr (std::is_base_of_v<ITickSource, Source>)
+        {
+            TickBatch batch;
+            while (src.next_batch(batch))
+                res.update_batch(batch, r.candles);
+        }
+        else
+        {
+            while (auto t = src.next())
+                res.update(*t, r.candles);
+        }
+        res.flush(r.candles);
+
+        r.stats = src.stats();
+        r.late = res.late_stats();
+        return r;
+    }
+
+    // CSV or tick store input (see resample_ticks_with_stats).
+    inline SeriesPipelineResult
+    resample_ticks_to_series(const std::string &path,
+                             Timeframe tf,
+                             const TickCsvOptions &opt = TickCsvOptions{},
+                             std::chrono::nanoseconds max_lateness = {})
+    {
+        if (is_tick_store_file(path))
+        {
+            TickStoreSource src(path);
+            return resample_source_to_series(src, tf, max_lateness);
+        }
+        MmapTickSource src(path, opt);
+        return resample_source_to_series(src, tf, max_lateness);
+    }
+
+    inline SeriesPipelineResult
+    resample_csv_parallel_to_series(const std::string &path,
+                                    Timeframe tf,
+                                    const TickCsvOptions &opt = TickCsvOptions{},
+                                    const ParallelIngestOptions &popt = ParallelIngestOptions{},
+                                    std::chrono::nanoseconds max_lateness = {})
+    {
+        TickToCandleResampler res(tf, max_lateness);
+
+        SeriesPipelineResult r{};
+        r.stats = for_each_tick_chunk_parallel(path, opt, popt, [&](const std::vector<fin::core::Tick> &ticks)
+                                               {
+                                                   for (const auto &t : ticks)
+                                                       res.update(t, r.candles); });
+        res.flush(r.candles);
+        r.late = res.late_stats();
+        return r;
+    }
+
+    // Reads the ticks once and builds every timeframe in `tfs` (ascending in
+    // the result). CSV or tick store input, like resample_ticks_to_series.
+    template <class Source>
+    MultiSeriesPipelineResult resample_source_multi(Source &src, std::vector<Timeframe> tfs,
+                                                    std::chrono::nanoseconds max_lateness = {})
+    {
+        MultiTimeframeResampler res(std::move(tfs), max_lateness);
+        TickBatch batch;
+        while (src.next_batch(batch))
+            res.update_batch(batch);
+        res.flush();
+
+        MultiSeriesPipelineResult r{};
+        for (const Timeframe tf : res.timeframes())
+            r.series.push_back({tf, res.take(tf)});
         r.stats = src.stats();
+        r.late = res.late_stats();
         return r;
     }
 
-    // (duplicate removed)
+    inline MultiSeriesPipelineResult
+    resample_ticks_multi(const std::string &path,
+                         std::vector<Timeframe> tfs,
+                         const TickCsvOptions &opt = TickCsvOptions{},
+                         std::chrono::nanoseconds max_lateness = {})
+    {
+        if (is_tick_store_file(path))
+        {
+            TickStoreSource src(path);
+            return resample_source_multi(src, std::move(tfs), max_lateness);
+        }
+        MmapTickSource src(path, opt);
+        return resample_source_multi(src, std::move(tfs), max_lateness);
+    }
 }
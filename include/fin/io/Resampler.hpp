@@ -4,39 +4,468 @@
 
 #include <optional>
 #include <chrono>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
 
 #include "fin/io/Options.hpp"
 #include "fin/io/Sources.hpp"
+#include "fin/io/TickBatch.hpp"
 #include "fin/core/Tick.hpp"
 #include "fin/core/Candle.hpp"
+#include "fin/core/CandleSeries.hpp"
+#include "fin/core/PriceTraits.hpp"
 
 namespace fin::io
 {
-    class TickToCandleResampler
+    // Bucket width policies for BasicTickToCandleResampler.
+
+    // Width chosen at run time from a Timeframe.
+    struct DynamicWidth
+    {
+        static constexpr bool is_static = false;
+        std::chrono::nanoseconds width{std::chrono::minutes(1)};
+        constexpr std::chrono::nanoseconds get() const noexcept { return width; }
+    };
+
+    // Width fixed at compile time: bucket flooring divides by a constant.
+    template <std::int64_t Nanos>
+    struct StaticWidth
+    {
+        static_assert(Nanos > 0, "bucket width must be positive");
+        static constexpr bool is_static = true;
+        static constexpr std::chrono::nanoseconds get() noexcept { return std::chrono::nanoseconds(Nanos); }
+    };
+
+    // Ticks that arrived behind the newest timestamp seen so far.
+    struct LateTickStats
+    {
+        std::size_t merged = 0;  // within the lateness bound, folded into their bucket
+        std::size_t dropped = 0; // too late, ignored
+    };
+
+    // Aggregates BasicTick<P> into BasicCandle<P>. OHLC state is kept in the
+    // raw representation of P (PriceTraits<P>::rep): double for Price, int64
+    // ticks for FixedPrice, where aggregation is exact.
+    //
+    // The end of the open bucket is cached, so a tick inside it costs one
+    // timestamp compare; the bucket floor (a division by the width) runs only
+    // when a bucket rolls, and with StaticWidth the divisor is a constant.
+    //
+    // With max_lateness == 0 (the default) a tick older than the newest one
+    // seen is dropped. A positive bound enables watermark mode: the
+    // watermark trails the newest timestamp by max_lateness, ticks at or
+    // after it are merged into their bucket (open/close follow timestamps,
+    // not arrival order), older ones are dropped, and a bar is emitted once
+    // the watermark passes its end. The bars still open sit in a small ring
+    // of about max_lateness / width + 2 buckets; in-order ticks only touch
+    // the newest one. After flush() the bars equal those of the same ticks
+    // sorted by timestamp (stable), minus the dropped ones.
+    template <class P, class Width = DynamicWidth>
+    class BasicTickToCandleResampler
     {
     public:
-        explicit TickToCandleResampler(Timeframe tf = Timeframe::M1);
+        using tick_type = fin::core::BasicTick<P>;
+        using candle_type = fin::core::BasicCandle<P>;
+
+        // Throws std::invalid_argument for a non-positive width or a
+        // negative lateness bound.
+        explicit BasicTickToCandleResampler(Timeframe tf = Timeframe::M1,
+                                            std::chrono::nanoseconds max_lateness = {})
+            requires(!Width::is_static)
+            : width_{tf.duration()}, lateness_(max_lateness)
+        {
+            if (tf.duration() <= std::chrono::nanoseconds::zero())
+                throw std::invalid_argument("Resampler timeframe must be positive");
+            check_lateness();
+        }
+
+        explicit BasicTickToCandleResampler(std::chrono::nanoseconds max_lateness = {})
+            requires Width::is_static
+            : lateness_(max_lateness)
+        {
+            check_lateness();
+        }
+
+        Timeframe timeframe() const noexcept { return Timeframe(width_.get()); }
+        std::chrono::nanoseconds max_lateness() const noexcept { return lateness_; }
+        const LateTickStats &late_stats() const noexcept { return late_; }
+
+        // Feed a tick; emits a finished Candle when the time bucket rolls.
+        // In watermark mode one tick can finish several bars: the extra ones
+        // are queued and returned by the following update()/flush() calls.
+        std::optional<candle_type> update(const tick_type &t);
+
+        // Close the current partial candle (if any). In watermark mode, call
+        // until it returns nullopt to drain every open bar.
+        std::optional<candle_type> flush();
 
-        // Feed a tick; emits a finished Candle when the time bucket rolls
-        std::optional<fin::core::Candle> update(const fin::core::Tick &t);
+        // Double path only: finished bars are appended straight into `out`
+        // (no Candle is materialized). Return true when a bar was appended.
+        bool update(const tick_type &t, fin::core::CandleSeries &out)
+            requires std::is_same_v<P, fin::core::Price>;
+        bool flush(fin::core::CandleSeries &out)
+            requires std::is_same_v<P, fin::core::Price>;
 
-        // Close the current partial candle (if any).
-        std::optional<fin::core::Candle> flush();
+        // Same result as update(batch.tick(i), out) for every i, in one pass
+        // over the columns with the bucket state in locals. Returns the
+        // number of bars appended.
+        std::size_t update_batch(const TickBatch &batch, fin::core::CandleSeries &out)
+            requires std::is_same_v<P, fin::core::Price>;
 
     private:
-        Timeframe tf_;
+        using rep = typename fin::core::PriceTraits<P>::rep;
+
+        // No open bucket: every tick compares past the end and opens one.
+        static constexpr fin::core::Timestamp kClosed = fin::core::Timestamp::min();
+
+        // One open bar in watermark mode; open_ts/close_ts order late ticks.
+        struct Bucket
+        {
+            fin::core::Timestamp start, end, open_ts, close_ts;
+            rep open, high, low, close;
+            double vol;
+        };
+
+        [[no_unique_address]] Width width_{};
+        std::chrono::nanoseconds lateness_{};
+        LateTickStats late_{};
         bool has_open_ = false;
 
         fin::core::Timestamp bucket_start_{};
-        double open_ = 0, high_ = 0, low_ = 0, close_ = 0;
+        fin::core::Timestamp bucket_end_ = kClosed;
+        rep open_ = 0, high_ = 0, low_ = 0, close_ = 0;
         double vol_ = 0;
 
-        std::optional<fin::core::Timestamp> last_ts_;
+        fin::core::Timestamp last_ts_ = fin::core::Timestamp::min();
+
+        // Watermark mode: open bars by start time, and the bars finished
+        // between two calls of the Candle-returning API.
+        std::deque<Bucket> ring_;
+        fin::core::Timestamp watermark_ = fin::core::Timestamp::min();
+        std::deque<candle_type> ready_;
 
+        void check_lateness() const
+        {
+            if (lateness_ < std::chrono::nanoseconds::zero())
+                throw std::invalid_argument("Resampler max_lateness must not be negative");
+        }
+
+        template <class Emit>
+        bool advance(const tick_type &t, Emit &&emit);
+        template <class Emit>
+        std::size_t advance_late(fin::core::Timestamp ts, rep p, double v, Emit &&emit);
+        template <class Emit>
+        std::size_t drain(Emit &&emit);
+
+        candle_type make_candle() const;
         fin::core::Timestamp bucket_floor(fin::core::Timestamp ts) const;
-        fin::core::Timestamp bucket_end(fin::core::Timestamp ts) const;
     };
 
+    template <class P, class Width>
+    fin::core::Timestamp BasicTickToCandleResampler<P, Width>::bucket_floor(fin::core::Timestamp ts) const
+    {
+        const auto d = width_.get();
+        const auto ns = ts.time_since_epoch();
+        return fin::core::Timestamp(ns - (ns % d));
+    }
+
+    template <class P, class Width>
+    typename BasicTickToCandleResampler<P, Width>::candle_type BasicTickToCandleResampler<P, Width>::make_candle() const
+    {
+        using T = fin::core::PriceTraits<P>;
+        return candle_type{bucket_start_, T::make(open_), T::make(high_), T::make(low_), T::make(close_), fin::core::Volume{vol_}};
+    }
+
+    // Shared tick step: calls emit() (with the finished bucket still in the
+    // state fields) when `t` rolls the bucket, then folds `t` in.
+    template <class P, class Width>
+    template <class Emit>
+    bool BasicTickToCandleResampler<P, Width>::advance(const tick_type &t, Emit &&emit)
+    {
+        const auto ts = t.timestamp();
+
+        // out-of-order? drop (no lateness bound)
+        if (ts < last_ts_)
+        {
+            ++late_.dropped;
+            return false;
+        }
+        last_ts_ = ts;
+
+        const rep p = fin::core::PriceTraits<P>::raw(t.price());
+
+        // Same bucket -> aggregate
+        if (ts < bucket_end_)
+        {
+            if (p > high_)
+                high_ = p;
+            if (p < low_)
+                low_ = p;
+            close_ = p;
+            vol_ += t.volume().value();
+            return false;
+        }
+
+        // New bucket (or the first one)
+        const bool rolled = has_open_;
+        if (rolled)
+            emit();
+        bucket_start_ = bucket_floor(ts);
+        bucket_end_ = bucket_start_ + width_.get();
+        open_ = high_ = low_ = close_ = p;
+        vol_ = t.volume().value();
+        has_open_ = true;
+        return rolled;
+    }
+
+    // Watermark-mode tick step: calls emit(bucket) for every bar the
+    // watermark has passed and returns how many.
+    template <class P, class Width>
+    template <class Emit>
+    std::size_t BasicTickToCandleResampler<P, Width>::advance_late(fin::core::Timestamp ts, rep p, double v, Emit &&emit)
+    {
+        if (ts >= last_ts_)
+        {
+            // In order: extend the newest bar or open the next one.
+            last_ts_ = ts;
+            if (!ring_.empty() && ts < ring_.back().end)
+            {
+                Bucket &b = ring_.back();
+                if (p > b.high)
+                    b.high = p;
+                if (p < b.low)
+                    b.low = p;
+                b.close = p;
+                b.close_ts = ts;
+                b.vol += v;
+            }
+            else
+            {
+                const auto start = bucket_floor(ts);
+                ring_.push_back(Bucket{start, start + width_.get(), ts, ts, p, p, p, p, v});
+            }
+
+            watermark_ = ts - lateness_;
+            std::size_t emitted = 0;
+            while (ring_.front().end <= watermark_)
+            {
+                emit(ring_.front());
+                ring_.pop_front();
+                ++emitted;
+            }
+            return emitted;
+        }
+
+        if (ts < watermark_)
+        {
+            ++late_.dropped;
+            return 0;
+        }
+        ++late_.merged;
+
+        // Late but inside the bound: its bar is still in the ring (or was
+        // never opened); search from the newest end, the ring is short.
+        const auto start = bucket_floor(ts);
+        auto it = ring_.end();
+        while (it != ring_.begin() && std::prev(it)->start > start)
+            --it;
+        if (it != ring_.begin() && std::prev(it)->start == start)
+        {
+            Bucket &b = *std::prev(it);
+            if (p > b.high)
+                b.high = p;
+            if (p < b.low)
+                b.low = p;
+            if (ts < b.open_ts)
+            {
+                b.open = p;
+                b.open_ts = ts;
+            }
+            if (ts >= b.close_ts)
+            {
+                b.close = p;
+                b.close_ts = ts;
+            }
+            b.vol += v;
+        }
+        else
+        {
+            ring_.insert(it, Bucket{start, start + width_.get(), ts, ts, p, p, p, p, v});
+        }
+        return 0;
+    }
+
+    template <class P, class Width>
+    template <class Emit>
+    std::size_t BasicTickToCandleResampler<P, Width>::drain(Emit &&emit)
+    {
+        const std::size_t n = ring_.size();
+        for (const Bucket &b : ring_)
+            emit(b);
+        ring_.clear();
+        return n;
+    }
+
+    template <class P, class Width>
+    std::optional<typename BasicTickToCandleResampler<P, Width>::candle_type>
+    BasicTickToCandleResampler<P, Width>::update(const tick_type &t)
+    {
+        std::optional<candle_type> out;
+        if (lateness_ == std::chrono::nanoseconds::zero())
+        {
+            advance(t, [&]
+                    { out = make_candle(); });
+            return out;
+        }
+
+        using T = fin::core::PriceTraits<P>;
+        advance_late(t.timestamp(), T::raw(t.price()), t.volume().value(), [&](const Bucket &b)
+                     { ready_.push_back(candle_type{b.start, T::make(b.open), T::make(b.high), T::make(b.low), T::make(b.close),
+                                                    fin::core::Volume{b.vol}}); });
+        if (!ready_.empty())
+        {
+            out = ready_.front();
+            ready_.pop_front();
+        }
+        return out;
+    }
+
+    template <class P, class Width>
+    std::optional<typename BasicTickToCandleResampler<P, Width>::candle_type> BasicTickToCandleResampler<P, Width>::flush()
+    {
+        if (lateness_ == std::chrono::nanoseconds::zero())
+        {
+            if (!has_open_)
+                return std::nullopt;
+            has_open_ = false;
+            bucket_end_ = kClosed;
+            return make_candle();
+        }
+
+        using T = fin::core::PriceTraits<P>;
+        drain([&](const Bucket &b)
+              { ready_.push_back(candle_type{b.start, T::make(b.open), T::make(b.high), T::make(b.low), T::make(b.close),
+                                             fin::core::Volume{b.vol}}); });
+        if (ready_.empty())
+            return std::nullopt;
+        candle_type c = ready_.front();
+        ready_.pop_front();
+        return c;
+    }
+
+    template <class P, class Width>
+    bool BasicTickToCandleResampler<P, Width>::update(const tick_type &t, fin::core::CandleSeries &out)
+        requires std::is_same_v<P, fin::core::Price>
+    {
+        if (lateness_ == std::chrono::nanoseconds::zero())
+            return advance(t, [&]
+                           { out.push_back(bucket_start_, open_, high_, low_, close_, vol_); });
+        return advance_late(t.timestamp(), t.price().value(), t.volume().value(), [&](const Bucket &b)
+                            { out.push_back(b.start, b.open, b.high, b.low, b.close, b.vol); }) != 0;
+    }
+
+    template <class P, class Width>
+    bool BasicTickToCandleResampler<P, Width>::flush(fin::core::CandleSeries &out)
+        requires std::is_same_v<P, fin::core::Price>
+    {
+        if (lateness_ != std::chrono::nanoseconds::zero())
+            return drain([&](const Bucket &b)
+                         { out.push_back(b.start, b.open, b.high, b.low, b.close, b.vol); }) != 0;
+        if (!has_open_)
+            return false;
+        has_open_ = false;
+        bucket_end_ = kClosed;
+        out.push_back(bucket_start_, open_, high_, low_, close_, vol_);
+        return true;
+    }
+
+    template <class P, class Width>
+    std::size_t BasicTickToCandleResampler<P, Width>::update_batch(const TickBatch &batch, fin::core::CandleSeries &out)
+        requires std::is_same_v<P, fin::core::Price>
+    {
+        const std::size_t n = batch.size();
+        const fin::core::Timestamp *ts = batch.ts();
+        const double *price = batch.price();
+        const double *volume = batch.volume();
+
+        if (lateness_ != std::chrono::nanoseconds::zero())
+        {
+            std::size_t emitted = 0;
+            for (std::size_t i = 0; i < n; ++i)
+                emitted += advance_late(ts[i], price[i], volume[i], [&](const Bucket &b)
+                                        { out.push_back(b.start, b.open, b.high, b.low, b.close, b.vol); });
+            return emitted;
+        }
+
+        const auto d = width_.get();
+
+        fin::core::Timestamp last = last_ts_;
+        fin::core::Timestamp start = bucket_start_, end = bucket_end_;
+        double open = open_, high = high_, low = low_, close = close_, vol = vol_;
+        std::size_t emitted = 0, dropped = 0;
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const fin::core::Timestamp t = ts[i];
+            if (t < last)
+            {
+                ++dropped; // out-of-order, as in advance()
+                continue;
+            }
+            last = t;
+
+            const double p = price[i];
+            if (t < end)
+            {
+                if (p > high)
+                    high = p;
+                if (p < low)
+                    low = p;
+                close = p;
+                vol += volume[i];
+                continue;
+            }
+
+            if (end != kClosed)
+            {
+                out.push_back(start, open, high, low, close, vol);
+                ++emitted;
+            }
+            const auto ns = t.time_since_epoch();
+            start = fin::core::Timestamp(ns - (ns % d));
+            end = start + d;
+            open = high = low = close = p;
+            vol = volume[i];
+        }
+
+        last_ts_ = last;
+        late_.dropped += dropped;
+        has_open_ = end != kClosed;
+        bucket_start_ = start;
+        bucket_end_ = end;
+        open_ = open;
+        high_ = high;
+        low_ = low;
+        close_ = close;
+        vol_ = vol;
+        return emitted;
+    }
+
+    extern template class BasicTickToCandleResampler<fin::core::Price>;
+    extern template class BasicTickToCandleResampler<fin::core::FixedPrice>;
+
+    using TickToCandleResampler = BasicTickToCandleResampler<fin::core::Price>;
+    using FixedTickToCandleResampler = BasicTickToCandleResampler<fin::core::FixedPrice>;
+
+    // Width as a chrono type, e.g. StaticTickToCandleResampler<std::chrono::minutes>
+    // or StaticTickToCandleResampler<std::chrono::duration<std::int64_t, std::ratio<15>>>.
+    template <class Duration, class P = fin::core::Price>
+    using StaticTickToCandleResampler =
+        BasicTickToCandleResampler<P, StaticWidth<std::chrono::nanoseconds(Duration(1)).count()>>;
+
 } // namespace fin::io
 
 #endif // FIN_IO_RESAMPLER_HPP
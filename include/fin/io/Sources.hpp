@@ -6,6 +6,8 @@
 #include <string>
 #include <memory>
 #include "fin/io/Options.hpp"
+#include "fin/io/CsvScan.hpp"
+#include "fin/io/TickBatch.hpp"
 #include "fin/core/Tick.hpp"
 
 namespace fin::io
@@ -22,12 +24,22 @@ namespace fin::io
         std::size_t rows = 0, parsed = 0, skipped = 0;
     };
 
-    class FileTickSource : public ISource<fin::core::Tick>
+    // Tick sources also hand out ticks a batch at a time: next_batch() clears
+    // `out` and fills it with up to out.capacity() ticks, returning how many
+    // (0 => EOF). One virtual call per batch instead of one per tick; next()
+    // and next_batch() read from the same position and may be mixed.
+    struct ITickSource : ISource<fin::core::Tick>
+    {
+        virtual std::size_t next_batch(TickBatch &out) = 0;
+    };
+
+    class FileTickSource : public ITickSource
     {
     public:
         FileTickSource(std::string path, TickCsvOptions opt = {});
         ~FileTickSource();
         std::optional<fin::core::Tick> next() override;
+        std::size_t next_batch(TickBatch &out) override;
         const ReadStats &stats() const { return stats_; }
 
     private:
@@ -36,6 +48,26 @@ namespace fin::io
         ReadStats stats_{};
     };
 
+    // Same contract as FileTickSource (options, skip rules, ReadStats), but the
+    // file is memory-mapped and fields are tokenized in place as string_views:
+    // no getline/istringstream and no per-row heap allocation while parsing.
+    // Rows are indexed a block at a time with the vectorized separator scanner
+    // (see CsvScan.hpp); `kernel` only exists to compare scanner paths.
+    class MmapTickSource : public ITickSource
+    {
+    public:
+        MmapTickSource(std::string path, TickCsvOptions opt = {}, ScanKernel kernel = best_scan_kernel());
+        ~MmapTickSource();
+        std::optional<fin::core::Tick> next() override;
+        std::size_t next_batch(TickBatch &out) override;
+        const ReadStats &stats() const { return stats_; }
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> impl_;
+        ReadStats stats_{};
+    };
+
 } // namespace fin::io
 
 #endif // FIN_IO_TICK_SOURCE_HPP
@@ -0,0 +1,119 @@
+#pragma once
+#ifndef FIN_IO_SYMBOL_PIPELINE_HPP
+#define FIN_IO_SYMBOL_PIPELINE_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "fin/io/Options.hpp"
+#include "fin/io/ParallelIngest.hpp"
+#include "fin/io/Resampler.hpp"
+#include "fin/core/CandleSeries.hpp"
+#include "fin/core/FeatureMatrix.hpp"
+#include "fin/core/SymbolMap.hpp"
+#include "fin/core/Tick.hpp"
+#include "fin/indicators/DynamicFeatureBus.hpp"
+#include "fin/indicators/FeatureSpec.hpp"
+
+namespace fin::io
+{
+    // Candles of one symbol.
+    struct SymbolSeries
+    {
+        fin::core::Symbol symbol;
+        fin::core::CandleSeries candles;
+        std::size_t ticks = 0; // ticks routed to this symbol
+
+        // Feature rows of this symbol's candles; set when features were requested.
+        std::optional<fin::core::FeatureMatrix> features;
+    };
+
+    struct MultiSymbolResult
+    {
+        std::vector<SymbolSeries> symbols; // sorted by symbol name
+        ReadStats stats;
+
+        // nullptr when `sym` never appeared in the input.
+        const SymbolSeries *find(fin::core::Symbol sym) const;
+    };
+
+    /**
+     * @brief Routes ticks to one resampler per symbol.
+     *
+     * Each symbol gets its own TickToCandleResampler and CandleSeries, looked
+     * up by interned id, so interleaved symbols never share a bucket. With a
+     * non-empty `features` set each symbol also gets its own
+     * DynamicFeatureBus, fed every bar as it closes, and a FeatureMatrix of
+     * its rows. Ticks of one symbol must arrive in time order; the order
+     * across symbols does not matter.
+     */
+    class SymbolDemuxResampler
+    {
+    public:
+        // Throws std::invalid_argument for an unusable feature set (see
+        // feature_spec_error()).
+        explicit SymbolDemuxResampler(Timeframe tf = Timeframe::M1,
+                                      std::vector<fin::indicators::FeatureSpec> features = {});
+
+        void update(const fin::core::Tick &t);
+
+        // Closes every symbol's partial candle.
+        void flush();
+
+        std::size_t symbols() const noexcept { return parts_.size(); }
+
+        // Moves the per-symbol series out (first-seen order) and resets.
+        std::vector<SymbolSeries> take();
+
+    private:
+        struct Partition
+        {
+            Partition(Timeframe tf, const std::vector<fin::indicators::FeatureSpec> &features);
+
+            TickToCandleResampler resampler;
+            fin::core::CandleSeries candles;
+            std::size_t ticks = 0;
+
+            std::optional<fin::indicators::DynamicFeatureBus> bus;
+            std::optional<fin::core::FeatureMatrix> features;
+            std::size_t fed = 0;     // candles already passed to `bus`
+            std::vector<double> row; // reused feature row, bus->width() wide
+        };
+
+        static void feed(Partition &p);
+
+        Timeframe tf_;
+        std::vector<fin::indicators::FeatureSpec> features_;
+        fin::core::SymbolMap<Partition> parts_;
+    };
+
+    struct SymbolPipelineOptions
+    {
+        std::size_t ingest_threads = 1;    // CSV parse workers; 0 => all cores, ignored for tick stores
+        std::size_t partition_threads = 1; // resampling workers, symbols sharded by id; 0 => all cores
+        std::size_t max_batches_queued = 8; // per partition worker, bounds memory when resampling lags
+
+        // Per-symbol feature rows, computed on the partition workers; empty => candles only.
+        std::vector<fin::indicators::FeatureSpec> features;
+    };
+
+    /**
+     * @brief Resamples a multi-symbol tick file into per-symbol candle series.
+     *
+     * Accepts a tick CSV or a tick store. With partition_threads > 1 symbols
+     * are sharded across workers by interned id; the reading thread splits
+     * each batch of ticks by shard and queues it, so every worker sees its
+     * symbols' ticks in file order and owns their resamplers exclusively.
+     * The result does not depend on the thread counts. Worker exceptions are
+     * rethrown on the calling thread.
+     */
+    MultiSymbolResult resample_by_symbol(const std::string &path,
+                                         Timeframe tf,
+                                         const TickCsvOptions &opt = TickCsvOptions{},
+                                         const SymbolPipelineOptions &sopt = SymbolPipelineOptions{});
+
+} // namespace fin::io
+
+#endif // FIN_IO_SYMBOL_PIPELINE_HPP
@@ -0,0 +1,78 @@
+#pragma once
+#ifndef FIN_IO_TICK_BATCH_HPP
+#define FIN_IO_TICK_BATCH_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "fin/core/Tick.hpp"
+
+namespace fin::io
+{
+    /**
+     * @brief Caller-owned block of ticks in structure-of-arrays form.
+     *
+     * Sources fill it through next_batch() (see ITickSource) and consumers
+     * such as TickToCandleResampler::update_batch() walk the columns in a
+     * tight loop, so virtual dispatch and std::optional cost are paid once
+     * per batch instead of once per tick. Storage is allocated up front and
+     * reused across fills; clear() only resets the size.
+     */
+    class TickBatch
+    {
+    public:
+        static constexpr std::size_t kDefaultCapacity = 4096;
+
+        // Throws std::invalid_argument on zero capacity, which next_batch()
+        // could never fill and would read as end of input.
+        explicit TickBatch(std::size_t capacity = kDefaultCapacity)
+            : ts_(checked_capacity(capacity)), symbol_(capacity), price_(capacity), volume_(capacity) {}
+
+        std::size_t size() const noexcept { return size_; }
+        std::size_t capacity() const noexcept { return ts_.size(); }
+        bool empty() const noexcept { return size_ == 0; }
+        bool full() const noexcept { return size_ == ts_.size(); }
+        void clear() noexcept { size_ = 0; }
+
+        // Precondition: !full().
+        void push_back(fin::core::Timestamp ts, fin::core::Symbol sym, double price, double volume) noexcept
+        {
+            ts_[size_] = ts;
+            symbol_[size_] = sym;
+            price_[size_] = price;
+            volume_[size_] = volume;
+            ++size_;
+        }
+        void push_back(const fin::core::Tick &t) noexcept
+        {
+            push_back(t.timestamp(), t.symbol(), t.price().value(), t.volume().value());
+        }
+
+        const fin::core::Timestamp *ts() const noexcept { return ts_.data(); }
+        const fin::core::Symbol *symbol() const noexcept { return symbol_.data(); }
+        const double *price() const noexcept { return price_.data(); }
+        const double *volume() const noexcept { return volume_.data(); }
+
+        fin::core::Tick tick(std::size_t i) const
+        {
+            return fin::core::Tick(ts_[i], symbol_[i], fin::core::Price(price_[i]), fin::core::Volume(volume_[i]));
+        }
+
+    private:
+        static std::size_t checked_capacity(std::size_t capacity)
+        {
+            if (capacity == 0)
+                throw std::invalid_argument("TickBatch: capacity must be positive");
+            return capacity;
+        }
+
+        std::vector<fin::core::Timestamp> ts_;
+        std::vector<fin::core::Symbol> symbol_;
+        std::vector<double> price_;
+        std::vector<double> volume_;
+        std::size_t size_ = 0;
+    };
+} // namespace fin::io
+
+#endif // FIN_IO_TICK_BATCH_HPP
@@ -0,0 +1,94 @@
+#pragma once
+#ifndef FIN_IO_TICK_CSV_PARSER_HPP
+#define FIN_IO_TICK_CSV_PARSER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "fin/io/CsvScan.hpp"
+#include "fin/io/Options.hpp"
+#include "fin/io/Sources.hpp" // ReadStats
+#include "fin/io/TickBatch.hpp"
+#include "fin/core/Tick.hpp"
+
+namespace fin::io
+{
+    // Column positions of the tick fields within a CSV row (-1 => missing).
+    struct TickCsvLayout
+    {
+        int ts = -1, sym = -1, price = -1, vol = -1;
+
+        bool complete() const noexcept { return ts >= 0 && sym >= 0 && price >= 0 && vol >= 0; }
+        int max_index() const noexcept;
+
+        // Fixed order used for headerless files: ts, symbol, price, volume.
+        static TickCsvLayout positional() noexcept { return {0, 1, 2, 3}; }
+
+        // Resolves column names from a header line (first match wins).
+        static TickCsvLayout from_header(std::string_view line, const TickCsvOptions &opt);
+    };
+
+    /**
+     * @brief Zero-copy tick CSV parser over an in-memory byte range.
+     *
+     * Rows are indexed a block at a time with the separator scanner and
+     * sliced in place; skip rules match FileTickSource. The range must stay
+     * alive while the parser is used. MmapTickSource runs one parser over a
+     * whole mapped file; the parallel ingest runs one per newline-aligned
+     * chunk with a layout resolved up front.
+     */
+    class TickCsvParser
+    {
+    public:
+        // Reads the layout from the first row when `opt.has_header` is set.
+        TickCsvParser(const char *begin, const char *end, const TickCsvOptions &opt,
+                      ScanKernel kernel = best_scan_kernel());
+
+        // Range without a header row; every row is parsed with `layout`.
+        TickCsvParser(const char *begin, const char *end, const TickCsvOptions &opt,
+                      TickCsvLayout layout, ScanKernel kernel = best_scan_kernel());
+
+        // Next valid tick; counts rows / parsed / skipped into `stats`.
+        std::optional<fin::core::Tick> next(ReadStats &stats);
+
+        // Clears `out` and fills it with up to capacity() valid ticks; 0 => end of range.
+        std::size_t next_batch(TickBatch &out, ReadStats &stats);
+
+        // Every byte before this pointer has been parsed and is no longer read.
+        const char *consumed() const noexcept { return block_ ? block_ : cur_; }
+
+    private:
+        struct Row;
+
+        bool load_block();
+        bool next_row(Row &r);
+        bool parse_next(ReadStats &stats, fin::core::Timestamp &ts, fin::core::Symbol &sym, double &price, double &vol);
+        fin::core::Symbol intern_symbol(std::string_view name);
+
+        const char *cur_ = nullptr; // first byte not yet indexed
+        const char *end_ = nullptr;
+        char delim_ = ',';
+        ScanFn scan_ = nullptr;
+
+        const char *block_ = nullptr;
+        std::size_t block_size_ = 0;
+        std::vector<std::uint32_t> seps_;
+        std::size_t nseps_ = 0, sep_i_ = 0;
+        std::uint32_t row_ = 0; // next row start within block
+
+        TickCsvLayout layout_{};
+        int max_idx_ = -1;
+        std::size_t header_rows_ = 0; // header consumed in the ctor, counted on first next()
+
+        // Most files repeat one symbol row after row; skip the table lookup then.
+        std::string last_sym_name_;
+        fin::core::Symbol last_sym_{};
+    };
+
+} // namespace fin::io
+
+#endif // FIN_IO_TICK_CSV_PARSER_HPP
@@ -0,0 +1,118 @@
+#pragma once
+#ifndef FIN_IO_TICK_STORE_HPP
+#define FIN_IO_TICK_STORE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "fin/io/Options.hpp"
+#include "fin/io/ParallelIngest.hpp"
+#include "fin/io/Sources.hpp"
+#include "fin/core/Tick.hpp"
+
+namespace fin::io
+{
+    /**
+     * @brief Binary columnar tick file ("tick store").
+     *
+     * Layout (little-endian, version 1):
+     *   header   magic "AQTICKS\0", u32 version, u32 block_rows, u64 tick count,
+     *            u64 dictionary offset, u32 symbol count, u32 reserved
+     *   blocks   per block of n <= block_rows ticks, as separate columns:
+     *            i64 ts_ns[n], f64 price[n], f64 volume[n], u32 symbol_id[n]
+     *            (padded to 8 bytes)
+     *   symbols  per id: u32 length + bytes
+     *
+     * The symbol dictionary is written last so the writer can stream blocks
+     * without knowing the symbol set up front; the header is patched on
+     * finish(). Every block is 8-byte aligned within the file. Values are
+     * stored in host order, so the build requires a little-endian host.
+     */
+    inline constexpr char kTickStoreMagic[8] = {'A', 'Q', 'T', 'I', 'C', 'K', 'S', '\0'};
+    inline constexpr std::uint32_t kTickStoreVersion = 1;
+    inline constexpr std::uint32_t kTickStoreDefaultBlockRows = 64u << 10;
+
+    // True when `path` exists and starts with the tick store magic.
+    bool is_tick_store_file(const std::string &path);
+
+    class TickStoreWriter
+    {
+    public:
+        // Throws std::runtime_error when `path` cannot be created.
+        explicit TickStoreWriter(const std::string &path, std::uint32_t block_rows = kTickStoreDefaultBlockRows);
+        // Finishes the file if neither finish() nor abort() was called (errors
+        // swallowed). When destroyed by an exception it aborts instead, so a
+        // failed write never leaves a valid-looking truncated store.
+        ~TickStoreWriter();
+
+        TickStoreWriter(const TickStoreWriter &) = delete;
+        TickStoreWriter &operator=(const TickStoreWriter &) = delete;
+
+        void append(const fin::core::Tick &t);
+
+        // Flushes the last block, writes the dictionary and patches the header.
+        // On a write error the file is removed and std::runtime_error thrown.
+        void finish();
+
+        // Closes and removes the partial file; later finish() calls do nothing.
+        void abort() noexcept;
+
+        std::uint64_t ticks() const noexcept { return count_; }
+        std::size_t symbols() const noexcept { return names_.size(); }
+
+    private:
+        void flush_block();
+        void write_header();
+
+        std::string path_;
+        std::ofstream out_;
+        std::uint32_t block_rows_;
+        std::uint64_t count_ = 0;
+        bool finished_ = false;
+        int uncaught_ = 0; // std::uncaught_exceptions() at construction
+
+        std::vector<std::int64_t> ts_;
+        std::vector<double> price_, volume_;
+        std::vector<std::uint32_t> sym_;
+
+        std::unordered_map<fin::core::Symbol, std::uint32_t> ids_; // interned symbol -> file-local id
+        std::vector<fin::core::Symbol> names_;
+    };
+
+    // Reads a tick store through a memory map; columns are decoded in place.
+    // A missing file yields no ticks (like the CSV sources); a file with a bad
+    // magic, unknown version or truncated sections throws std::runtime_error.
+    // Every stored tick counts as a parsed row, nothing is skipped.
+    class TickStoreSource : public ITickSource
+    {
+    public:
+        explicit TickStoreSource(std::string path);
+        ~TickStoreSource();
+        std::optional<fin::core::Tick> next() override;
+        std::size_t next_batch(TickBatch &out) override; // copies columns block by block
+        const ReadStats &stats() const { return stats_; }
+
+        std::uint64_t size() const noexcept; // ticks in the file
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> impl_;
+        ReadStats stats_{};
+    };
+
+    // Parses `csv_path` (in parallel when popt.threads != 1) and writes it as a
+    // tick store; returns the CSV read stats. Throws std::runtime_error when the
+    // CSV cannot be opened; on any failure no store is left at `store_path`.
+    ReadStats convert_csv_to_tick_store(const std::string &csv_path,
+                                        const std::string &store_path,
+                                        const TickCsvOptions &opt = TickCsvOptions{},
+                                        const ParallelIngestOptions &popt = ParallelIngestOptions{});
+
+} // namespace fin::io
+
+#endif // FIN_IO_TICK_STORE_HPP
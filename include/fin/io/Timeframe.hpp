@@ -0,0 +1,53 @@
+#pragma once
+#ifndef FIN_IO_TIMEFRAME_HPP
+#define FIN_IO_TIMEFRAME_HPP
+
+#include <chrono>
+#include <compare>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace fin::io
+{
+    /**
+     * @brief Candle bucket width: any positive duration.
+     *
+     * Buckets are aligned to multiples of the width since the Unix epoch
+     * (UTC), so D1 bars start at midnight UTC. The named constants keep the
+     * old enumerator spelling (Timeframe::M1, ...).
+     */
+    class Timeframe
+    {
+    public:
+        constexpr Timeframe() noexcept : width_(std::chrono::minutes(1)) {}
+        constexpr explicit Timeframe(std::chrono::nanoseconds width) noexcept : width_(width) {}
+
+        constexpr std::chrono::nanoseconds duration() const noexcept { return width_; }
+
+        constexpr auto operator<=>(const Timeframe &other) const noexcept = default;
+
+        static const Timeframe S1, S5, M1, M5, H1;
+
+    private:
+        std::chrono::nanoseconds width_;
+    };
+
+    inline constexpr Timeframe Timeframe::S1{std::chrono::seconds(1)};
+    inline constexpr Timeframe Timeframe::S5{std::chrono::seconds(5)};
+    inline constexpr Timeframe Timeframe::M1{std::chrono::minutes(1)};
+    inline constexpr Timeframe Timeframe::M5{std::chrono::minutes(5)};
+    inline constexpr Timeframe Timeframe::H1{std::chrono::hours(1)};
+
+    // Accepts unit-first tokens (S15, M1, H4, D1) and count-first durations
+    // (250ms, 15s, 5m, 4h, 1d; also us and ns), case-insensitive. nullopt for
+    // anything else, including zero or more than 366 days.
+    std::optional<Timeframe> parse_timeframe(std::string_view token);
+
+    // Largest whole unit, unit first: S1, M5, H4, D1; sub-second widths as
+    // 250ms (or us / ns). parse_timeframe(to_string(tf)) == tf.
+    std::string to_string(Timeframe tf);
+
+} // namespace fin::io
+
+#endif // FIN_IO_TIMEFRAME_HPP
@@ -8,12 +8,9 @@
 #include <string_view>
 #include <vector>
 
+#include "fin/core/FeatureMatrix.hpp"
 #include "fin/core/Timestamp.hpp"
-
-namespace fin::indicators
-{
-    struct FeatureRow;
-}
+#include "fin/indicators/FeatureBus.hpp"
 
 namespace fin::ml
 {
@@ -21,24 +18,33 @@ namespace fin::ml
      * @brief LightWeight container for a single feature vector
      *
      * The vector keeps the chronological context (timestamp) and optionally a
-     * list of feature names so that models can either work by positional index
-     * or perform name-based lookups when the ordering is not guaranteed
+     * shared schema naming the values, so that models can either work by
+     * positional index or perform name-based lookups when the ordering is not
+     * guaranteed. The schema is shared, not copied, between vectors.
      */
     struct FeatureVector
     {
-        fin::core::Timestamp ts{};        // Feature timestamp (candle start)
-        std::vector<std::string> names{}; // Optional ordered feature names.
-        std::vector<double> values{};     // Feature values aligned with "names"
+        fin::core::Timestamp ts{};            // Feature timestamp (candle start)
+        fin::core::FeatureSchemaPtr schema{}; // Optional names of "values"
+        std::vector<double> values{};         // Feature values aligned with the schema
 
         [[nodiscard]] std::size_t size() const noexcept { return values.size(); }
         [[nodiscard]] bool empty() const noexcept { return values.empty(); }
         [[nodiscard]] double operator[](std::size_t idx) const noexcept { return values[idx]; }
 
+        // Schema names, or an empty list without a schema.
+        [[nodiscard]] const std::vector<std::string> &names() const noexcept;
+
         // Returns the value for the named feature if available
         std::optional<double> value_of(std::string_view name) const;
 
         // Helper used by the MVP feature pipeline (FeatureBus -> model input)
         static FeatureVector from_feature_row(const fin::indicators::FeatureRow &row);
+
+        // The same features without allocating, in feature_row_names() order.
+        using FeatureRowValues = fin::indicators::FeatureBus::RowValues;
+        static FeatureRowValues feature_row_values(const fin::indicators::FeatureRow &row) noexcept;
+        static const std::vector<std::string> &feature_row_names();
     };
 }
 
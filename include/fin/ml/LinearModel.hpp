@@ -3,11 +3,14 @@
 #define FIN_ML_LINEAR_MODEL_HPP
 
 #include <optional>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "fin/core/FeatureMatrix.hpp"
 #include "fin/ml/IModel.hpp"
+#include "fin/ml/RidgeAccumulator.hpp"
 
 namespace fin::ml
 {
@@ -23,6 +26,13 @@ namespace fin::ml
      *  2. Named weights, where each weight is bound to a specific feature
      *     name; missing features default to zero contribution
      *
+     * bind() resolves either kind against a feature schema once; after that
+     * predict_row()/predict_batch() run a dense dot product over plain
+     * doubles with no name lookups or allocations.
+     *
+     * fit()/partial_fit() train the weights with ridge regression through a
+     * RidgeAccumulator, so online updates cost O(features^2) plus a small
+     * solve instead of a refit over every sample seen so far.
      */
     class LinearModel final : public IModel
     {
@@ -34,6 +44,42 @@ namespace fin::ml
         [[nodiscard]] bool is_ready() const override;
         [[nodiscard]] double predict(const FeatureVector &features) const override;
 
+        // Replaces any online state with a ridge fit over `features`/`targets`.
+        void fit(std::span<const FeatureVector> features, std::span<const double> targets) override;
+
+        // Adds one sample to the online state and refits once there are more
+        // samples than features (before that the model stays not ready).
+        void partial_fit(const FeatureVector &features, double target) override;
+
+        // fit() over the rows of a feature matrix; the weights take the
+        // matrix's schema names.
+        void fit(const fin::core::FeatureMatrixView &features, std::span<const double> targets);
+
+        void set_ridge_lambda(double lambda) noexcept { ridge_lambda_ = lambda; }
+        [[nodiscard]] double ridge_lambda() const noexcept { return ridge_lambda_; }
+
+        // Maps the weights onto the columns `names` (a row layout such as
+        // FeatureVector::feature_row_names()). Named weights without a
+        // matching column are dropped and unweighted columns get 0;
+        // positional weights need names.size() == weights().size()
+        // (std::invalid_argument otherwise). The binding survives later
+        // set_*weights()/fit() calls, which re-resolve it, until reset().
+        void bind(std::span<const std::string> names);
+        void bind(const fin::core::FeatureSchema &schema) { bind(schema.names()); }
+        [[nodiscard]] bool is_bound() const noexcept { return bound_; }
+        [[nodiscard]] std::size_t bound_features() const noexcept { return bound_names_.size(); }
+
+        // Prediction for one row laid out as the bound schema.
+        [[nodiscard]] double predict_row(std::span<const double> row) const;
+
+        // out[i] = prediction for row i of the row-major matrix `rows`
+        // (out.size() rows of bound_features() columns).
+        void predict_batch(std::span<const double> rows, std::span<double> out) const;
+
+        // Same over a matrix, whose schema must match the bound names
+        // (std::invalid_argument otherwise); out.size() == features.rows().
+        void predict_batch(const fin::core::FeatureMatrixView &features, std::span<double> out) const;
+
         void set_weights(std::vector<double> weights, double bias = 0.0);
         void set_named_weights(std::vector<std::pair<std::string, double>> weights, double bias = 0.0);
 
@@ -48,10 +94,21 @@ namespace fin::ml
         [[nodiscard]] const std::vector<std::pair<std::string, double>> &named_weights() const noexcept { return named_weights_; }
 
     private:
+        void apply_fit(RidgeSolution &&fit, const std::vector<std::string> &names);
+        void rebind();
+        void check_bound(const char *caller) const;
+
         double bias_ = 0.0;
         std::vector<double> weights_{};
         std::vector<std::pair<std::string, double>> named_weights_{};
         bool ready_ = false;
+
+        bool bound_ = false;
+        std::vector<std::string> bound_names_{}; // schema passed to bind()
+        std::vector<double> dense_weights_{};    // weights in bound_names_ order
+
+        double ridge_lambda_ = 1e-6;
+        std::optional<RidgeAccumulator> online_{}; // samples seen by fit()/partial_fit()
     };
 }
 
@@ -0,0 +1,40 @@
+#pragma once
+#ifndef FIN_ML_LINEAR_SOLVE_HPP
+#define FIN_ML_LINEAR_SOLVE_HPP
+
+#include <span>
+
+namespace fin::ml
+{
+    // Dense solvers for n x n systems A x = b, with A stored flat in
+    // row-major order (A.size() == b.size()^2, std::invalid_argument
+    // otherwise). On success b holds x; A may be overwritten.
+
+    /**
+     * @brief Blocked Cholesky (A = L L^T) for symmetric positive definite A.
+     *
+     * Only the lower triangle is read. Factorizes in 64-column panels so the
+     * trailing updates stream contiguous rows, which keeps a few hundred
+     * features in cache. Returns false when a pivot falls to
+     * epsilon * max|A_ii| or below, i.e. A is not numerically positive definite.
+     */
+    bool cholesky_solve(std::span<double> A, std::span<double> b);
+
+    /**
+     * @brief Householder QR with column pivoting.
+     *
+     * Rank-revealing: columns whose remaining norm drops below
+     * n * epsilon * |R_00| are treated as dependent and their unknowns set
+     * to zero, so singular and badly conditioned systems still get a basic
+     * least-squares solution. Factorizes a column-major copy; A is only
+     * read. Returns false only when A is zero.
+     */
+    bool qr_solve(std::span<const double> A, std::span<double> b);
+
+    // Cholesky, falling back to QR on the original system when the
+    // factorization breaks down. Returns false only if QR fails as well.
+    bool solve_spd(std::span<double> A, std::span<double> b);
+
+} // namespace fin::ml
+
+#endif // FIN_ML_LINEAR_SOLVE_HPP
@@ -2,11 +2,14 @@
 #ifndef FIN_ML_LINEAR_TRAINER_HPP
 #define FIN_ML_LINEAR_TRAINER_HPP
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
+#include "fin/core/FeatureMatrix.hpp"
 #include "fin/indicators/FeatureBus.hpp"
 #include "fin/ml/LinearModel.hpp"
+#include "fin/ml/RidgeAccumulator.hpp"
 
 namespace fin::ml
 {
@@ -24,8 +27,21 @@ namespace fin::ml
         std::size_t samples = 0;
     };
 
-    // Trains a linear model that predicts the next close-price delta
-    // using FeatureBus-produced rows. Throws std::runtime-error on failure.
+    // Solves the accumulated normal equations into a named-weight model;
+    // `names` must hold one name per feature. The MSE is derived from the
+    // accumulated sums. Throws std::runtime_error when the system is singular.
+    LinearTrainingSummary train_linear(const RidgeAccumulator &acc,
+                                       const std::vector<std::string> &names,
+                                       LinearTrainingOptions options = {});
+
+    // Trains a linear model that predicts the next close-price delta: row i
+    // of `features` pairs with close[i + 1] - close[i], where close is the
+    // schema's "close" column (std::invalid_argument if absent). The model
+    // comes back bound to the matrix schema. Throws std::runtime_error on failure.
+    LinearTrainingSummary train_linear_from_features(const fin::core::FeatureMatrixView &features,
+                                                     LinearTrainingOptions options = {});
+
+    // The same over FeatureBus-produced rows. Throws std::runtime-error on failure.
     LinearTrainingSummary
     train_linear_from_feature_rows(
         const std::vector<fin::indicators::FeatureRow> &rows,
@@ -0,0 +1,67 @@
+#pragma once
+#ifndef FIN_ML_RIDGE_ACCUMULATOR_HPP
+#define FIN_ML_RIDGE_ACCUMULATOR_HPP
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace fin::ml
+{
+    struct RidgeSolution
+    {
+        std::vector<double> weights; // one per feature
+        double bias = 0.0;
+    };
+
+    /**
+     * @brief Running normal equations for a ridge-regularized linear fit.
+     *
+     * Accumulates X'X, X'y and y'y (with an implicit bias column) in flat
+     * contiguous storage, so a model can be trained from a stream without
+     * keeping the samples. add_sample()/remove_sample() are O(features^2),
+     * which makes rolling-window and walk-forward refits cost one update
+     * plus one solve per step instead of a pass over the whole window.
+     */
+    class RidgeAccumulator
+    {
+    public:
+        explicit RidgeAccumulator(std::size_t features = 0);
+
+        // `x` must hold exactly features() values.
+        void add_sample(std::span<const double> x, double y);
+
+        // Retracts a sample previously added with the same values. Throws
+        // std::logic_error when the accumulator is empty.
+        void remove_sample(std::span<const double> x, double y);
+
+        // Drops every sample; the feature count is kept.
+        void clear() noexcept;
+
+        std::size_t features() const noexcept { return features_; }
+        std::size_t samples() const noexcept { return samples_; }
+        bool empty() const noexcept { return samples_ == 0; }
+
+        // Solves (X'X + lambda I) w = X'y; the bias is not regularized.
+        // Cholesky first, rank-revealing QR when the factorization breaks
+        // down (e.g. collinear features with lambda = 0). Throws
+        // std::runtime_error only when both fail.
+        RidgeSolution solve(double ridge_lambda) const;
+
+        // Sum of squared residuals of `fit` over the accumulated samples,
+        // evaluated from the sums (y'y - 2 w'X'y + w'X'Xw).
+        double sse(const RidgeSolution &fit) const;
+
+    private:
+        void accumulate(std::span<const double> x, double y, double sign);
+
+        std::size_t features_;
+        std::size_t samples_ = 0;
+        std::vector<double> xtx_; // (features + 1)^2 row-major, upper triangle only
+        std::vector<double> xty_;
+        double yty_ = 0.0;
+    };
+
+} // namespace fin::ml
+
+#endif // FIN_ML_RIDGE_ACCUMULATOR_HPP
@@ -6,6 +6,7 @@
 #include <optional>
 
 #include "fin/core/Timestamp.hpp"
+#include "fin/core/Symbol.hpp"
 
 namespace fin::signal
 {
@@ -19,7 +20,7 @@ namespace fin::signal
     struct Signal
     {
         fin::core::Timestamp ts{};
-        std::string symbol;    // optional; may be empty if unavailable
+        fin::core::Symbol symbol; // optional; may be empty if unavailable
         SignalType type = SignalType::Hold;
         double score = 0.0;    // positive -> buy bias; negative -> sell bias
         std::string source;    // short reason/strategy name
@@ -0,0 +1,239 @@
+#include "fin/app/ParameterSweep.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cmath>
+#include <exception>
+#include <string_view>
+#include <thread>
+
+namespace fin::app
+{
+    namespace
+    {
+        template <class T>
+        std::size_t axis_size(const std::vector<T> &axis)
+        {
+            return axis.empty() ? 1 : axis.size();
+        }
+
+        // Picks entry `digit` of `axis`, or keeps `value` when the axis is empty.
+        template <class T>
+        void apply_axis(const std::vector<T> &axis, std::size_t digit, T &value)
+        {
+            if (!axis.empty())
+                value = axis[digit];
+        }
+
+        bool parse_number(std::string_view s, double &v)
+        {
+            while (!s.empty() && s.front() == ' ')
+                s.remove_prefix(1);
+            while (!s.empty() && s.back() == ' ')
+                s.remove_suffix(1);
+            if (s.empty())
+                return false;
+            auto [p, ec] = std::from_chars(s.data(), s.data() + s.size(), v);
+            return ec == std::errc{} && p == s.data() + s.size() && std::isfinite(v);
+        }
+
+        bool parse_item(std::string_view item, std::vector<double> &out)
+        {
+            const auto c1 = item.find(':');
+            if (c1 == std::string_view::npos)
+            {
+                double v = 0.0;
+                if (!parse_number(item, v))
+                    return false;
+                out.push_back(v);
+                return true;
+            }
+
+            const auto c2 = item.find(':', c1 + 1);
+            if (c2 == std::string_view::npos)
+                return false;
+            double lo = 0.0, hi = 0.0, step = 0.0;
+            if (!parse_number(item.substr(0, c1), lo) || !parse_number(item.substr(c1 + 1, c2 - c1 - 1), hi) ||
+                !parse_number(item.substr(c2 + 1), step) || step <= 0.0 || hi < lo)
+                return false;
+
+            // Multiply rather than accumulate so long ranges do not drift.
+            const double slack = step * 1e-9;
+            for (std::size_t k = 0;; ++k)
+            {
+                const double v = lo + static_cast<double>(k) * step;
+                if (v > hi + slack)
+                    break;
+                out.push_back(v);
+            }
+            return true;
+        }
+
+        // NaN metrics rank after every finite value and tie among themselves,
+        // so the comparison stays a strict weak ordering.
+        bool better(const SweepEntry &a, const SweepEntry &b, SweepRankBy rank_by)
+        {
+            if (a.ok != b.ok)
+                return a.ok;
+            if (a.ok)
+            {
+                const bool by_rmse = rank_by == SweepRankBy::ValidationRmse;
+                const double x = by_rmse ? a.result.validation_rmse : a.result.metrics.return_pct;
+                const double y = by_rmse ? b.result.validation_rmse : b.result.metrics.return_pct;
+                const bool x_nan = std::isnan(x), y_nan = std::isnan(y);
+                if (x_nan != y_nan)
+                    return y_nan;
+                if (!x_nan && x != y)
+                    return by_rmse ? x < y : x > y;
+            }
+            return a.index < b.index; // stable, independent of thread timing
+        }
+    } // namespace
+
+    std::size_t SweepGrid::combinations() const
+    {
+        return axis_size(ema_fast) * axis_size(ema_slow) * axis_size(rsi_period) *
+               axis_size(rsi_buy) * axis_size(rsi_sell) * axis_size(ridge_lambda);
+    }
+
+    std::vector<ScenarioConfig> expand_sweep_grid(const ScenarioConfig &base, const SweepGrid &grid)
+    {
+        const std::size_t total = grid.combinations();
+        std::vector<ScenarioConfig> configs;
+        configs.reserve(total);
+
+        for (std::size_t i = 0; i < total; ++i)
+        {
+            // Mixed-radix decomposition of i, last axis fastest.
+            std::size_t rest = i;
+            auto next_digit = [&rest](std::size_t radix)
+            {
+                const std::size_t d = rest % radix;
+                rest /= radix;
+                return d;
+            };
+            const std::size_t d_ridge = next_digit(axis_size(grid.ridge_lambda));
+            const std::size_t d_sell = next_digit(axis_size(grid.rsi_sell));
+            const std::size_t d_buy = next_digit(axis_size(grid.rsi_buy));
+            const std::size_t d_rsi = next_digit(axis_size(grid.rsi_period));
+            const std::size_t d_slow = next_digit(axis_size(grid.ema_slow));
+            const std::size_t d_fast = next_digit(axis_size(grid.ema_fast));
+
+            ScenarioConfig cfg = base;
+            apply_axis(grid.ema_fast, d_fast, cfg.ema_fast);
+            apply_axis(grid.ema_slow, d_slow, cfg.ema_slow);
+            apply_axis(grid.rsi_period, d_rsi, cfg.rsi_period);
+            apply_axis(grid.rsi_buy, d_buy, cfg.rsi_buy);
+            apply_axis(grid.rsi_sell, d_sell, cfg.rsi_sell);
+            apply_axis(grid.ridge_lambda, d_ridge, cfg.ridge_lambda);
+            configs.push_back(std::move(cfg));
+        }
+        return configs;
+    }
+
+    std::vector<SweepEntry> run_sweep_on_candles(const std::vector<ScenarioConfig> &configs,
+                                                 const fin::core::CandleSeriesView &bars,
+                                                 const SweepOptions &options)
+    {
+        std::vector<SweepEntry> entries(configs.size());
+
+        std::size_t threads = options.threads ? options.threads : std::thread::hardware_concurrency();
+        threads = std::clamp<std::size_t>(threads, 1, std::max<std::size_t>(configs.size(), 1));
+
+        // Workers claim the next config from a shared counter; each entry is
+        // written by exactly one worker, so only the counter is shared.
+        std::atomic<std::size_t> next{0};
+        auto worker = [&]
+        {
+            for (std::size_t i = next.fetch_add(1); i < configs.size(); i = next.fetch_add(1))
+            {
+                SweepEntry &e = entries[i];
+                e.index = i;
+                e.config = configs[i];
+                e.config.model_output_path.reset(); // a sweep never persists models
+                e.config.features_output_path.reset();
+                if (threads > 1)
+                    e.config.walk_forward_threads = 1; // configs already run in parallel
+                try
+                {
+                    e.result = run_scenario_on_candles(e.config, bars);
+                    e.ok = true;
+                }
+                catch (const std::exception &ex)
+                {
+                    e.error = ex.what();
+                }
+            }
+        };
+
+        if (threads == 1)
+        {
+            worker();
+        }
+        else
+        {
+            std::vector<std::thread> pool;
+            pool.reserve(threads);
+            for (std::size_t t = 0; t < threads; ++t)
+                pool.emplace_back(worker);
+            for (auto &t : pool)
+                t.join();
+        }
+
+        rank_sweep_entries(entries, options.rank_by);
+        return entries;
+    }
+
+    void rank_sweep_entries(std::vector<SweepEntry> &entries, SweepRankBy rank_by)
+    {
+        std::sort(entries.begin(), entries.end(), [&](const SweepEntry &a, const SweepEntry &b)
+                  { return better(a, b, rank_by); });
+    }
+
+    SweepResult run_sweep(const ScenarioConfig &base, const SweepGrid &grid, const SweepOptions &options)
+    {
+        const auto loaded = load_scenario_candles(base);
+
+        SweepResult result{};
+        result.candles = loaded.candles.size();
+        result.stats = loaded.stats;
+        result.entries = run_sweep_on_candles(expand_sweep_grid(base, grid), loaded.candles.view(), options);
+        return result;
+    }
+
+    bool parse_sweep_values(const std::string &text, std::vector<double> &out)
+    {
+        std::vector<double> values;
+        std::string_view rest(text);
+        while (true)
+        {
+            const auto comma = rest.find(',');
+            if (!parse_item(rest.substr(0, comma), values))
+                return false;
+            if (comma == std::string_view::npos)
+                break;
+            rest.remove_prefix(comma + 1);
+        }
+        out = std::move(values);
+        return true;
+    }
+
+    bool parse_sweep_values(const std::string &text, std::vector<std::size_t> &out)
+    {
+        std::vector<double> values;
+        if (!parse_sweep_values(text, values))
+            return false;
+
+        std::vector<std::size_t> sizes;
+        sizes.reserve(values.size());
+        for (double v : values)
+        {
+            if (v < 0.0 || v != std::floor(v))
+                return false;
+            sizes.push_back(static_cast<std::size_t>(v));
+        }
+        out = std::move(sizes);
+        return true;
+    }
+}
@@ -5,6 +5,7 @@
 #include <charconv>
 #include <fstream>
 #include <optional>
+#include <utility>
 
 #include "fin/app/ScenarioUtils.hpp"
 
@@ -123,6 +124,86 @@ namespace fin::app
                     return false;
                 }
             }
+            else if (lowered == "lateness" || lowered == "max_lateness")
+            {
+                if (auto lateness = parse_lateness_token(value))
+                    cfg.max_lateness = *lateness;
+                else
+                {
+                    error = "Invalid max_lateness '" + value + "' at line " + std::to_string(line_no);
+                    return false;
+                }
+            }
+            else if (lowered == "threads" || lowered == "ingest_threads")
+            {
+                std::size_t v = 0;
+                if (!parse_size_value(value, v))
+                {
+                    error = "Invalid ingest_threads at line " + std::to_string(line_no);
+                    return false;
+                }
+                cfg.ingest_threads = v;
+            }
+            else if (lowered == "mode")
+            {
+                if (auto mode = parse_scenario_mode_token(value))
+                    cfg.mode = *mode;
+                else
+                {
+                    error = "Unknown mode '" + value + "' at line " + std::to_string(line_no);
+                    return false;
+                }
+            }
+            else if (lowered == "train_rows" || lowered == "stream_train_rows")
+            {
+                std::size_t v = 0;
+                if (!parse_size_value(value, v))
+                {
+                    error = "Invalid stream_train_rows at line " + std::to_string(line_no);
+                    return false;
+                }
+                cfg.stream_train_rows = v;
+            }
+            else if (lowered == "walk_forward_train" || lowered == "wf_train")
+            {
+                std::size_t v = 0;
+                if (!parse_size_value(value, v))
+                {
+                    error = "Invalid walk_forward_train at line " + std::to_string(line_no);
+                    return false;
+                }
+                cfg.walk_forward_train = v;
+            }
+            else if (lowered == "walk_forward_test" || lowered == "wf_test")
+            {
+                std::size_t v = 0;
+                if (!parse_size_value(value, v))
+                {
+                    error = "Invalid walk_forward_test at line " + std::to_string(line_no);
+                    return false;
+                }
+                cfg.walk_forward_test = v;
+            }
+            else if (lowered == "walk_forward_anchored" || lowered == "wf_anchored")
+            {
+                auto b = parse_bool_value(value);
+                if (!b)
+                {
+                    error = "Invalid boolean for walk_forward_anchored at line " + std::to_string(line_no);
+                    return false;
+                }
+                cfg.walk_forward_anchored = *b;
+            }
+            else if (lowered == "walk_forward_threads" || lowered == "wf_threads")
+            {
+                std::size_t v = 0;
+                if (!parse_size_value(value, v))
+                {
+                    error = "Invalid walk_forward_threads at line " + std::to_string(line_no);
+                    return false;
+                }
+                cfg.walk_forward_threads = v;
+            }
             else if (lowered == "train_ratio")
             {
                 double v = 0.0;
@@ -277,6 +358,20 @@ namespace fin::app
             {
                 cfg.model_output_path = value;
             }
+            else if (lowered == "features")
+            {
+                auto specs = fin::indicators::parse_feature_specs(value);
+                if (!specs)
+                {
+                    error = "Invalid features list at line " + std::to_string(line_no);
+                    return false;
+                }
+                cfg.features = std::move(*specs);
+            }
+            else if (lowered == "features_out" || lowered == "features_output")
+            {
+                cfg.features_output_path = value;
+            }
             else if (lowered == "preview" || lowered == "preview_limit")
             {
                 std::size_t v = 0;
@@ -1,147 +1,393 @@
 #include "fin/app/ScenarioRunner.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <fstream>
+#include <optional>
 #include <stdexcept>
 
+#include "fin/app/ScenarioSerialization.hpp"
+#include "fin/app/ScenarioUtils.hpp"
+#include "fin/app/WalkForward.hpp"
+#include "fin/indicators/DynamicFeatureBus.hpp"
+#include "fin/indicators/IndicatorGraph.hpp"
 #include "fin/indicators/FeatureBus.hpp"
-#include "fin/ml/FeatureVector.hpp"
-#include "fin/signal/SignalEngine.hpp"
+#include "fin/io/TickBatch.hpp"
 
 namespace fin::app
 {
     namespace
     {
-        std::size_t clamp_training_rows(std::size_t total_rows, double ratio)
+        long long to_ms(fin::core::Timestamp ts)
         {
-            if (total_rows < 3)
-                throw std::runtime_error("Need at least three feature rows to run scenario");
-
-            if (ratio < 0.1)
-                ratio = 0.1;
-            else if (ratio > 0.95)
-                ratio = 0.95;
-
-            std::size_t rows = static_cast<std::size_t>(ratio * static_cast<double>(total_rows));
-            if (rows < 2)
-                rows = 2;
-            if (rows >= total_rows)
-                rows = total_rows - 1;
-            return rows;
+            return std::chrono::duration_cast<std::chrono::milliseconds>(ts.time_since_epoch()).count();
         }
-    } // namespace
 
-    ScenarioResult run_scenario(const ScenarioConfig &config)
-    {
-        if (config.ticks_path.empty())
-            throw std::invalid_argument("ScenarioConfig.ticks_path is empty");
+        // config.features, or the default set built from the period keys.
+        std::vector<fin::indicators::FeatureSpec> scenario_feature_specs(const ScenarioConfig &config)
+        {
+            if (config.features.empty())
+                return fin::indicators::default_feature_specs(config.ema_fast, config.rsi_period,
+                                                              config.macd_fast, config.macd_slow, config.macd_signal);
+            const bool has_close = std::any_of(config.features.begin(), config.features.end(), [](const auto &f)
+                                               { return f.kind == fin::indicators::FeatureKind::Close && f.name == "close"; });
+            if (!has_close)
+                throw std::invalid_argument("ScenarioConfig.features must include \"close\" (the regression target)");
+            if (auto error = fin::indicators::feature_spec_error(config.features))
+                throw std::invalid_argument("ScenarioConfig.features: " + *error);
+            return config.features;
+        }
 
-        fin::io::TickCsvOptions csv_opt{};
-        auto res = fin::io::resample_csv_with_stats(config.ticks_path, config.timeframe, csv_opt);
+        // Calls fn(bus) with the scenario's feature bus: the compile-time
+        // default set when config.features is empty, a DynamicFeatureBus
+        // otherwise. Both expose schema(), update(FeatureInput, row) and
+        // update(bars, matrix).
+        template <class Fn>
+        auto with_feature_bus(const ScenarioConfig &config, Fn &&fn)
+        {
+            if (config.features.empty())
+            {
+                fin::indicators::FeatureBus bus(config.ema_fast, config.rsi_period,
+                                                config.macd_fast, config.macd_slow, config.macd_signal);
+                return fn(bus.bus());
+            }
+            fin::indicators::DynamicFeatureBus bus(scenario_feature_specs(config));
+            return fn(bus);
+        }
 
-        ScenarioResult result{};
-        result.candles = res.candles.size();
+        // A row buffer sized for `bus`.
+        template <class Bus>
+        auto make_feature_row(const Bus &bus)
+        {
+            if constexpr (requires { typename Bus::Row; })
+                return typename Bus::Row{};
+            else
+                return std::vector<double>(bus.width());
+        }
 
-        fin::indicators::FeatureBus feature_bus(config.ema_fast, config.rsi_period,
-                                                config.macd_fast, config.macd_slow, config.macd_signal);
-        std::vector<fin::indicators::FeatureRow> rows;
-        rows.reserve(res.candles.size());
-        for (const auto &c : res.candles)
+        // Replays every tick of config.ticks_path through `fn` a TickBatch at
+        // a time, in file order, with the same source selection as
+        // load_scenario_candles().
+        template <class Fn>
+        fin::io::ReadStats for_each_scenario_batch(const ScenarioConfig &config, Fn &&fn)
         {
-            if (auto row = feature_bus.update(c))
-                rows.push_back(*row);
+            fin::io::TickBatch batch;
+            if (fin::io::is_tick_store_file(config.ticks_path))
+            {
+                fin::io::TickStoreSource src(config.ticks_path);
+                while (src.next_batch(batch))
+                    fn(batch);
+                return src.stats();
+            }
+            if (config.ingest_threads == 1)
+            {
+                fin::io::MmapTickSource src(config.ticks_path);
+                while (src.next_batch(batch))
+                    fn(batch);
+                return src.stats();
+            }
+            fin::io::ParallelIngestOptions popt{};
+            popt.threads = config.ingest_threads;
+            auto stats = fin::io::for_each_tick_chunk_parallel(config.ticks_path, {}, popt, [&](const std::vector<fin::core::Tick> &ticks)
+                                                               {
+                                                                   for (const auto &t : ticks)
+                                                                   {
+                                                                       batch.push_back(t);
+                                                                       if (batch.full())
+                                                                       {
+                                                                           fn(batch);
+                                                                           batch.clear();
+                                                                       }
+                                                                   } });
+            if (!batch.empty())
+                fn(batch);
+            return stats;
         }
 
-        if (rows.size() < 3)
-            throw std::runtime_error("Insufficient data after indicator warmup");
+        // Feeds ticks -> candles -> `on_candle`, flushing the open bars.
+        template <class OnCandle>
+        fin::io::LateTickStats stream_candles(const ScenarioConfig &config, OnCandle &&on_candle)
+        {
+            fin::io::TickToCandleResampler res(config.timeframe, config.max_lateness);
+            fin::core::CandleSeries bars; // the few bars closed by one batch
+            for_each_scenario_batch(config, [&](const fin::io::TickBatch &batch)
+                                    {
+                                        res.update_batch(batch, bars);
+                                        const auto view = bars.view();
+                                        for (std::size_t i = 0; i < view.size(); ++i)
+                                            on_candle(view.candle(i));
+                                        bars.clear(); });
+            while (auto c = res.flush())
+                on_candle(*c);
+            return res.late_stats();
+        }
 
-        result.feature_rows = rows.size();
-        result.warmup_candles = result.candles - rows.size();
+        // Batch split for the streaming mode: counts feature rows in a pass
+        // that keeps nothing but the indicator state.
+        std::size_t streaming_train_rows(const ScenarioConfig &config)
+        {
+            if (config.stream_train_rows)
+                return config.stream_train_rows;
 
-        std::size_t train_rows = clamp_training_rows(rows.size(), config.train_ratio);
-        auto train_end = rows.begin() + static_cast<std::vector<fin::indicators::FeatureRow>::difference_type>(train_rows + 1);
-        std::vector<fin::indicators::FeatureRow> training(rows.begin(), train_end);
+            const std::size_t rows = with_feature_bus(config, [&](auto &bus)
+                                                      {
+                std::size_t n = 0;
+                auto row = make_feature_row(bus);
+                stream_candles(config, [&](const fin::core::Candle &c)
+                               {
+                                   if (bus.update(fin::indicators::FeatureInput::from(c), row))
+                                       ++n; });
+                return n; });
+            return clamp_training_rows(rows, config.train_ratio);
+        }
 
-        fin::ml::LinearTrainingOptions train_opts{};
-        train_opts.ridge_lambda = config.ridge_lambda;
+        // Train on the first train_ratio of `features`, validate on the rest
+        // and backtest every bar with the model's predictions.
+        ScenarioResult run_single_split(const ScenarioConfig &config, const fin::core::CandleSeriesView &bars,
+                                        const fin::core::FeatureMatrixView &features)
+        {
+            ScenarioResult result{};
+            result.candles = bars.size();
 
-        fin::ml::LinearTrainingSummary training_summary = fin::ml::train_linear_from_feature_rows(training, train_opts);
-        result.training = training_summary;
+            const std::size_t rows = features.rows();
+            result.feature_rows = rows;
+            result.warmup_candles = result.candles - rows;
+            const std::size_t close = features.schema->index_of("close").value();
 
-        double sse = 0.0;
-        std::size_t validation_samples = 0;
-        std::size_t preview_limit = config.validation_preview_limit;
-        if (preview_limit == 0)
-            preview_limit = 3;
+            const std::size_t train_rows = clamp_training_rows(rows, config.train_ratio);
 
-        for (std::size_t i = train_rows; i + 1 < rows.size(); ++i)
-        {
-            auto fv = fin::ml::FeatureVector::from_feature_row(rows[i]);
-            const double pred = training_summary.model.predict(fv);
-            const double target = rows[i + 1].close - rows[i].close;
-            const double err = pred - target;
-            sse += err * err;
-            ++validation_samples;
-
-            if (result.validation_preview.size() < preview_limit)
+            fin::ml::LinearTrainingOptions train_opts{};
+            train_opts.ridge_lambda = config.ridge_lambda;
+            result.training = fin::ml::train_linear_from_features(features.subview(0, train_rows + 1), train_opts);
+
+            // One dense pass predicts every row; row i closes candle warmup + i.
+            std::vector<double> predictions(rows);
+            result.training.model.predict_batch(features, predictions);
+
+            double sse = 0.0;
+            const std::size_t preview_limit = config.validation_preview_limit ? config.validation_preview_limit : 3;
+            for (std::size_t i = train_rows; i + 1 < rows; ++i)
             {
-                using namespace std::chrono;
-                const long long ts_ms = std::chrono::duration_cast<std::chrono::milliseconds>(rows[i + 1].ts.time_since_epoch()).count();
-                result.validation_preview.push_back({ts_ms, pred, target});
+                const double pred = predictions[i];
+                const double target = features.at(i + 1, close) - features.at(i, close);
+                const double err = pred - target;
+                sse += err * err;
+                ++result.validation_samples;
+
+                if (result.validation_preview.size() < preview_limit)
+                    result.validation_preview.push_back({to_ms(features.ts[i + 1]), pred, target});
             }
-        }
+            if (result.validation_samples > 0)
+                result.validation_rmse = std::sqrt(sse / static_cast<double>(result.validation_samples));
 
-        result.validation_samples = validation_samples;
-        if (validation_samples > 0)
-            result.validation_rmse = std::sqrt(sse / static_cast<double>(validation_samples));
+            if (config.model_output_path)
+            {
+                if (!fin::ml::save_linear_model(result.training.model, *config.model_output_path))
+                    throw std::runtime_error("Failed to persist linear model to " + *config.model_output_path);
+                result.model_saved = true;
+            }
 
-        if (config.model_output_path)
-        {
-            if (!fin::ml::save_linear_model(training_summary.model, *config.model_output_path))
-                throw std::runtime_error("Failed to persist linear model to " + *config.model_output_path);
-            result.model_saved = true;
+            fin::backtest::Backtester bt = make_scenario_backtester(config);
+
+            // Each prediction trades the candle after the one that produced it.
+            for (std::size_t i = 0; i < bars.size(); ++i)
+            {
+                std::optional<double> prediction;
+                if (i > result.warmup_candles)
+                    prediction = predictions[i - 1 - result.warmup_candles];
+                bt.on_candle(bars.candle(i), prediction);
+            }
+
+            result.metrics = bt.finalize();
+            return result;
         }
 
-        fin::signal::SignalEngineConfig scfg{};
-        scfg.rsi_buy_below = config.rsi_buy;
-        scfg.rsi_sell_above = config.rsi_sell;
-        scfg.use_ema_crossover = config.use_ema_crossover;
+        // Streaming scenario; see run_scenario_streaming().
+        ScenarioResult run_streaming(const ScenarioConfig &config, std::size_t train_rows)
+        {
+            const std::size_t preview_limit = config.validation_preview_limit ? config.validation_preview_limit : 3;
 
-        fin::signal::SignalEngine engine{scfg};
+            // Features and the backtester's EMAs/RSI share one graph, so an
+            // indicator both use is computed once per candle.
+            fin::indicators::IndicatorGraph graph;
+            fin::indicators::DynamicFeatureBus bus(scenario_feature_specs(config), graph);
+            fin::backtest::Backtester bt = make_scenario_backtester(config);
+            bt.share_indicators(graph);
 
-        fin::backtest::BacktestConfig btcfg{};
-        if (config.initial_cash)
-            btcfg.initial_cash = *config.initial_cash;
-        if (config.trade_qty)
-            btcfg.trade_qty = *config.trade_qty;
-        if (config.fee_per_trade)
-            btcfg.fee_per_trade = *config.fee_per_trade;
-        btcfg.ema_fast = config.ema_fast;
-        btcfg.ema_slow = config.ema_slow;
-        btcfg.rsi_period = config.rsi_period;
+            ScenarioResult result{};
+            result.feature_schema = bus.schema();
+            const fin::core::FeatureSchema &schema = *result.feature_schema;
+            const std::size_t close = schema.index_of("close").value();
+            fin::ml::RidgeAccumulator equations(schema.size());
+            std::optional<fin::ml::LinearModel> model;
 
-        fin::backtest::Backtester bt(btcfg, engine);
+            // Feature rows go straight to disk; nothing accumulates in memory.
+            std::ofstream features_out;
+            if (config.features_output_path)
+            {
+                features_out.open(*config.features_output_path);
+                if (!features_out)
+                    throw std::runtime_error("Failed to write features to " + *config.features_output_path);
+                write_feature_csv_header(features_out, schema);
+            }
 
-        fin::indicators::FeatureBus live_bus(config.ema_fast, config.rsi_period,
-                                             config.macd_fast, config.macd_slow, config.macd_signal);
-        std::optional<double> pending_prediction;
+            // Only the previous feature row is kept: its features pair with the
+            // next row's close delta as a training or validation sample.
+            std::vector<double> row(bus.width());
+            auto prev = row;
+            bool have_prev = false;
+            double prev_pred = 0.0;
+            std::optional<double> pending_prediction;
+            double sse = 0.0;
 
-        for (const auto &c : res.candles)
-        {
-            bt.on_candle(c, pending_prediction);
+            result.late_ticks = stream_candles(config, [&](const fin::core::Candle &c)
+                                               {
+                ++result.candles;
+                const bool ready = bus.update(fin::indicators::FeatureInput::from(c), row);
+                bt.on_candle(c, pending_prediction);
+                pending_prediction.reset();
+                if (!ready)
+                    return;
+                const std::size_t k = result.feature_rows++;
+                if (features_out.is_open())
+                    write_feature_csv_row(features_out, c.start_time(), row);
+
+                if (have_prev)
+                {
+                    const double target = row[close] - prev[close];
+                    if (k <= train_rows)
+                    {
+                        equations.add_sample(prev, target);
+                    }
+                    else
+                    {
+                        const double err = prev_pred - target;
+                        sse += err * err;
+                        ++result.validation_samples;
+                        if (result.validation_preview.size() < preview_limit)
+                            result.validation_preview.push_back({to_ms(c.start_time()), prev_pred, target});
+                    }
+                }
+
+                if (k == train_rows)
+                {
+                    fin::ml::LinearTrainingOptions train_opts{};
+                    train_opts.ridge_lambda = config.ridge_lambda;
+                    result.training = fin::ml::train_linear(equations, schema.names(), train_opts);
+                    model = result.training.model;
+                    model->bind(schema);
+                }
+                if (model)
+                {
+                    prev_pred = model->predict_row(row);
+                    pending_prediction = prev_pred;
+                }
+                prev = row;
+                have_prev = true; });
 
-            if (auto row = live_bus.update(c))
+            if (result.feature_rows < 3)
+                throw std::runtime_error("Insufficient data after indicator warmup");
+            if (!model)
+                throw std::runtime_error("Fewer feature rows than stream_train_rows");
+
+            result.warmup_candles = result.candles - result.feature_rows;
+            if (result.validation_samples > 0)
+                result.validation_rmse = std::sqrt(sse / static_cast<double>(result.validation_samples));
+
+            if (config.model_output_path)
             {
-                auto fv = fin::ml::FeatureVector::from_feature_row(*row);
-                pending_prediction = training_summary.model.predict(fv);
+                if (!fin::ml::save_linear_model(*model, *config.model_output_path))
+                    throw std::runtime_error("Failed to persist linear model to " + *config.model_output_path);
+                result.model_saved = true;
             }
-            else
+            if (features_out.is_open())
             {
-                pending_prediction.reset();
+                features_out.flush();
+                if (!features_out)
+                    throw std::runtime_error("Failed to write features to " + *config.features_output_path);
+                result.features_saved = true;
             }
+
+            result.metrics = bt.finalize();
+            return result;
+        }
+    } // namespace
+
+    fin::io::SeriesPipelineResult load_scenario_candles(const ScenarioConfig &config)
+    {
+        if (config.ticks_path.empty())
+            throw std::invalid_argument("ScenarioConfig.ticks_path is empty");
+
+        fin::io::TickCsvOptions csv_opt{};
+        fin::io::SeriesPipelineResult res;
+        // Tick stores skip text parsing altogether, so threads only matter for CSV.
+        if (config.ingest_threads == 1 || fin::io::is_tick_store_file(config.ticks_path))
+        {
+            res = fin::io::resample_ticks_to_series(config.ticks_path, config.timeframe, csv_opt, config.max_lateness);
+        }
+        else
+        {
+            fin::io::ParallelIngestOptions popt{};
+            popt.threads = config.ingest_threads;
+            res = fin::io::resample_csv_parallel_to_series(config.ticks_path, config.timeframe, csv_opt, popt, config.max_lateness);
+        }
+        return res;
+    }
+
+    ScenarioResult run_scenario_on_candles(const ScenarioConfig &config, const fin::core::CandleSeriesView &bars)
+    {
+        fin::core::FeatureMatrix matrix = with_feature_bus(config, [&](auto &bus)
+                                                           {
+            fin::core::FeatureMatrix m(bus.schema());
+            m.reserve(bars.size());
+            bus.update(bars, m);
+            return m; });
+        const fin::core::FeatureMatrixView features = matrix.view();
+
+        if (features.rows() < 3)
+            throw std::runtime_error("Insufficient data after indicator warmup");
+
+        ScenarioResult result = config.walk_forward_test > 0 ? run_walk_forward_on_candles(config, bars, features)
+                                                             : run_single_split(config, bars, features);
+        result.feature_schema = matrix.schema();
+        if (config.features_output_path)
+        {
+            if (!write_feature_matrix_csv(features, *config.features_output_path))
+                throw std::runtime_error("Failed to write features to " + *config.features_output_path);
+            result.features_saved = true;
         }
+        return result;
+    }
 
-        result.metrics = bt.finalize();
+    ScenarioResult run_scenario_streaming(const ScenarioConfig &config)
+    {
+        if (config.ticks_path.empty())
+            throw std::invalid_argument("ScenarioConfig.ticks_path is empty");
+        if (config.walk_forward_test > 0)
+            throw std::invalid_argument("walk-forward evaluation needs batch mode");
+
+        const std::size_t train_rows = streaming_train_rows(config);
+        if (train_rows < 2)
+            throw std::invalid_argument("ScenarioConfig.stream_train_rows must be at least 2");
+
+        return run_streaming(config, train_rows);
+    }
+
+    ScenarioResult run_scenario(const ScenarioConfig &config)
+    {
+        ScenarioResult result;
+        if (config.mode == ScenarioMode::Streaming)
+        {
+            result = run_scenario_streaming(config);
+        }
+        else
+        {
+            const auto res = load_scenario_candles(config);
+            result = run_scenario_on_candles(config, res.candles.view());
+            result.late_ticks = res.late;
+        }
+        result.peak_rss_bytes = peak_rss_bytes();
         return result;
     }
 }
@@ -1,31 +1,16 @@
 #include "fin/app/ScenarioSerialization.hpp"
 
+#include <chrono>
 #include <fstream>
 #include <iomanip>
 #include <sstream>
 
+#include "fin/app/ScenarioUtils.hpp"
+
 namespace fin::app
 {
     namespace
     {
-        const char *timeframe_to_cstr(fin::io::Timeframe tf)
-        {
-            switch (tf)
-            {
-            case fin::io::Timeframe::S1:
-                return "S1";
-            case fin::io::Timeframe::S5:
-                return "S5";
-            case fin::io::Timeframe::M5:
-                return "M5";
-            case fin::io::Timeframe::H1:
-                return "H1";
-            case fin::io::Timeframe::M1:
-            default:
-                return "M1";
-            }
-        }
-
         void append_metrics_json(std::ostream &out, const ScenarioResult &result)
         {
             out << "  \"metrics\": {\n"
@@ -38,6 +23,35 @@ namespace fin::app
                 << "    \"max_drawdown\": " << result.metrics.max_drawdown << "\n"
                 << "  },\n";
         }
+
+        void append_walk_forward_json(std::ostream &out, const ScenarioConfig &cfg, const ScenarioResult &result)
+        {
+            out << "  \"walk_forward\": {\n"
+                << "    \"train\": " << cfg.walk_forward_train << ",\n"
+                << "    \"test\": " << cfg.walk_forward_test << ",\n"
+                << "    \"anchored\": " << (cfg.walk_forward_anchored ? "true" : "false") << ",\n"
+                << "    \"folds\": [\n";
+            for (std::size_t i = 0; i < result.folds.size(); ++i)
+            {
+                const auto &f = result.folds[i];
+                out << "      {\"train_begin\": " << f.train_begin
+                    << ", \"train_end\": " << f.train_end
+                    << ", \"test_begin\": " << f.test_begin
+                    << ", \"test_end\": " << f.test_end
+                    << ", \"test_start_ms\": " << f.test_start_ms
+                    << ", \"test_end_ms\": " << f.test_end_ms
+                    << ", \"validation_rmse\": " << f.validation_rmse
+                    << ", \"pnl\": " << f.metrics.pnl
+                    << ", \"return_pct\": " << f.metrics.return_pct
+                    << ", \"trades\": " << f.metrics.trades
+                    << ", \"max_drawdown\": " << f.metrics.max_drawdown << "}";
+                if (i + 1 < result.folds.size())
+                    out << ',';
+                out << "\n";
+            }
+            out << "    ]\n"
+                << "  },\n";
+        }
     }
 
     std::string scenario_result_to_json(const ScenarioConfig &cfg, const ScenarioResult &result)
@@ -45,16 +59,30 @@ namespace fin::app
         std::ostringstream out;
         out << "{\n";
         out << "  \"ticks_path\": " << std::quoted(cfg.ticks_path) << ",\n";
-        out << "  \"timeframe\": \"" << timeframe_to_cstr(cfg.timeframe) << "\",\n";
+        out << "  \"timeframe\": \"" << fin::io::to_string(cfg.timeframe) << "\",\n";
+        out << "  \"mode\": \"" << scenario_mode_to_cstr(cfg.mode) << "\",\n";
         out << "  \"candles\": " << result.candles << ",\n";
         out << "  \"warmup_candles\": " << result.warmup_candles << ",\n";
         out << "  \"feature_rows\": " << result.feature_rows << ",\n";
+        out << "  \"late_ticks\": {\"merged\": " << result.late_ticks.merged
+            << ", \"dropped\": " << result.late_ticks.dropped << "},\n";
         out << "  \"training_samples\": " << result.training.samples << ",\n";
         out << "  \"validation_samples\": " << result.validation_samples << ",\n";
         out << "  \"training_mse\": " << result.training.mse << ",\n";
         out << "  \"validation_rmse\": " << result.validation_rmse << ",\n";
         append_metrics_json(out, result);
         out << "  \"model_saved\": " << (result.model_saved ? "true" : "false") << ",\n";
+        out << "  \"feature_columns\": [";
+        if (result.feature_schema)
+        {
+            for (std::size_t i = 0; i < result.feature_schema->size(); ++i)
+                out << (i ? ", " : "") << std::quoted(result.feature_schema->name(i));
+        }
+        out << "],\n";
+        out << "  \"features_saved\": " << (result.features_saved ? "true" : "false") << ",\n";
+        out << "  \"peak_rss_bytes\": " << result.peak_rss_bytes << ",\n";
+        if (!result.folds.empty())
+            append_walk_forward_json(out, cfg, result);
         out << "  \"validation_preview\": [\n";
         for (std::size_t i = 0; i < result.validation_preview.size(); ++i)
         {
@@ -82,4 +110,35 @@ namespace fin::app
             out << row.ts_ms << ',' << row.predicted_delta << ',' << row.actual_delta << '\n';
         return true;
     }
+
+    void write_feature_csv_header(std::ostream &out, const fin::core::FeatureSchema &schema)
+    {
+        out << "ts_ms";
+        for (const auto &name : schema.names())
+            out << ',' << name;
+        out << '\n';
+        out << std::setprecision(12);
+    }
+
+    void write_feature_csv_row(std::ostream &out, fin::core::Timestamp ts, std::span<const double> values)
+    {
+        out << std::chrono::duration_cast<std::chrono::milliseconds>(ts.time_since_epoch()).count();
+        for (double v : values)
+            out << ',' << v;
+        out << '\n';
+    }
+
+    bool write_feature_matrix_csv(const fin::core::FeatureMatrixView &features, const std::string &path)
+    {
+        if (!features.schema)
+            return false;
+        std::ofstream out(path);
+        if (!out)
+            return false;
+
+        write_feature_csv_header(out, *features.schema);
+        for (std::size_t i = 0; i < features.rows(); ++i)
+            write_feature_csv_row(out, features.ts[i], features.row(i));
+        return static_cast<bool>(out);
+    }
 }
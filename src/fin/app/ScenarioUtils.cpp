@@ -1,20 +1,136 @@
 #include "fin/app/ScenarioUtils.hpp"
 
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+#include "fin/signal/SignalEngine.hpp"
+
 namespace fin::app
 {
     std::optional<fin::io::Timeframe> parse_timeframe_token(const std::string &token)
     {
-        if (token == "S1")
-            return fin::io::Timeframe::S1;
-        if (token == "S5")
-            return fin::io::Timeframe::S5;
-        if (token == "M1")
-            return fin::io::Timeframe::M1;
-        if (token == "M5")
-            return fin::io::Timeframe::M5;
-        if (token == "H1")
-            return fin::io::Timeframe::H1;
+        return fin::io::parse_timeframe(token);
+    }
+
+    std::optional<std::chrono::nanoseconds> parse_lateness_token(const std::string &token)
+    {
+        if (token == "0")
+            return std::chrono::nanoseconds::zero();
+        if (auto tf = fin::io::parse_timeframe(token))
+            return tf->duration();
+        return std::nullopt;
+    }
+
+    std::optional<std::vector<fin::io::Timeframe>> parse_timeframe_list(const std::string &list)
+    {
+        std::vector<fin::io::Timeframe> out;
+        std::size_t pos = 0;
+        while (true)
+        {
+            const std::size_t comma = list.find(',', pos);
+            std::string token = list.substr(pos, comma == std::string::npos ? std::string::npos : comma - pos);
+            const auto first = token.find_first_not_of(" \t");
+            const auto last = token.find_last_not_of(" \t");
+            token = first == std::string::npos ? std::string{} : token.substr(first, last - first + 1);
+
+            auto tf = parse_timeframe_token(token);
+            if (!tf)
+                return std::nullopt;
+            out.push_back(*tf);
+            if (comma == std::string::npos)
+                return out;
+            pos = comma + 1;
+        }
+    }
+
+    std::optional<ScenarioMode> parse_scenario_mode_token(const std::string &token)
+    {
+        if (token == "batch")
+            return ScenarioMode::Batch;
+        if (token == "streaming" || token == "stream")
+            return ScenarioMode::Streaming;
         return std::nullopt;
     }
-}
 
+    const char *scenario_mode_to_cstr(ScenarioMode mode)
+    {
+        return mode == ScenarioMode::Streaming ? "streaming" : "batch";
+    }
+
+    std::size_t clamp_training_rows(std::size_t total_rows, double ratio)
+    {
+        if (total_rows < 3)
+            throw std::runtime_error("Need at least three feature rows to run scenario");
+
+        if (ratio < 0.1)
+            ratio = 0.1;
+        else if (ratio > 0.95)
+            ratio = 0.95;
+
+        std::size_t rows = static_cast<std::size_t>(ratio * static_cast<double>(total_rows));
+        if (rows < 2)
+            rows = 2;
+        if (rows >= total_rows)
+            rows = total_rows - 1;
+        return rows;
+    }
+
+    fin::backtest::Backtester make_scenario_backtester(const ScenarioConfig &config)
+    {
+        fin::signal::SignalEngineConfig scfg{};
+        scfg.rsi_buy_below = config.rsi_buy;
+        scfg.rsi_sell_above = config.rsi_sell;
+        scfg.use_ema_crossover = config.use_ema_crossover;
+
+        fin::backtest::BacktestConfig btcfg{};
+        if (config.initial_cash)
+            btcfg.initial_cash = *config.initial_cash;
+        if (config.trade_qty)
+            btcfg.trade_qty = *config.trade_qty;
+        if (config.fee_per_trade)
+            btcfg.fee_per_trade = *config.fee_per_trade;
+        btcfg.ema_fast = config.ema_fast;
+        btcfg.ema_slow = config.ema_slow;
+        btcfg.rsi_period = config.rsi_period;
+
+        return fin::backtest::Backtester(btcfg, fin::signal::SignalEngine{scfg});
+    }
+
+    std::size_t peak_rss_bytes()
+    {
+#if defined(__linux__)
+        if (std::FILE *f = std::fopen("/proc/self/status", "r"))
+        {
+            char line[256];
+            std::size_t kb = 0;
+            while (std::fgets(line, sizeof(line), f))
+                if (std::strncmp(line, "VmHWM:", 6) == 0)
+                {
+                    kb = std::strtoull(line + 6, nullptr, 10);
+                    break;
+                }
+            std::fclose(f);
+            if (kb)
+                return kb * 1024;
+        }
+#endif
+#if !defined(_WIN32)
+        struct rusage ru{};
+        if (::getrusage(RUSAGE_SELF, &ru) == 0)
+        {
+#if defined(__APPLE__)
+            return static_cast<std::size_t>(ru.ru_maxrss); // bytes
+#else
+            return static_cast<std::size_t>(ru.ru_maxrss) * 1024; // kilobytes
+#endif
+        }
+#endif
+        return 0;
+    }
+}
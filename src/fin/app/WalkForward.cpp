@@ -0,0 +1,208 @@
+#include "fin/app/WalkForward.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+#include "fin/app/ScenarioUtils.hpp"
+
+namespace fin::app
+{
+    namespace
+    {
+        long long to_ms(fin::core::Timestamp ts)
+        {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(ts.time_since_epoch()).count();
+        }
+
+        struct FoldOutput
+        {
+            fin::ml::LinearTrainingSummary training;
+            double sse = 0.0;
+            std::vector<ScenarioPreview> preview;
+        };
+
+        fin::backtest::Metrics sum_fold_metrics(const std::vector<WalkForwardFold> &folds)
+        {
+            fin::backtest::Metrics m{};
+            const double initial_cash = folds.front().metrics.final_cash - folds.front().metrics.pnl;
+            for (const auto &f : folds)
+            {
+                m.pnl += f.metrics.pnl;
+                m.return_pct += f.metrics.return_pct;
+                m.trades += f.metrics.trades;
+                m.wins += f.metrics.wins;
+                m.losses += f.metrics.losses;
+                m.max_drawdown = std::max(m.max_drawdown, f.metrics.max_drawdown);
+            }
+            m.final_cash = initial_cash + m.pnl;
+            return m;
+        }
+    } // namespace
+
+    std::vector<WalkForwardFold> plan_walk_forward(std::size_t samples, std::size_t train, std::size_t test, bool anchored)
+    {
+        if (train < 2)
+            throw std::invalid_argument("walk-forward training window must be at least 2 rows");
+        if (test == 0)
+            throw std::invalid_argument("walk-forward test window must be at least 1 row");
+
+        std::vector<WalkForwardFold> folds;
+        for (std::size_t begin = train; begin < samples; begin += test)
+        {
+            WalkForwardFold f{};
+            f.train_begin = anchored ? 0 : begin - train;
+            f.train_end = begin;
+            f.test_begin = begin;
+            f.test_end = std::min(begin + test, samples);
+            folds.push_back(f);
+        }
+        return folds;
+    }
+
+    ScenarioResult run_walk_forward_on_candles(const ScenarioConfig &config, const fin::core::CandleSeriesView &bars,
+                                               const fin::core::FeatureMatrixView &features)
+    {
+        ScenarioResult result{};
+        result.candles = bars.size();
+
+        const std::size_t rows = features.rows();
+        if (rows < 3)
+            throw std::runtime_error("Insufficient data after indicator warmup");
+        const auto close = features.schema->index_of("close");
+        if (!close)
+            throw std::invalid_argument("walk-forward features have no \"close\" column");
+
+        result.feature_rows = rows;
+        result.warmup_candles = result.candles - rows;
+
+        const std::size_t train = config.walk_forward_train ? config.walk_forward_train
+                                                            : clamp_training_rows(rows, config.train_ratio);
+        std::vector<WalkForwardFold> folds = plan_walk_forward(rows - 1, train, config.walk_forward_test,
+                                                               config.walk_forward_anchored);
+        if (folds.empty())
+            throw std::runtime_error("walk-forward training window leaves no rows to test");
+
+        // Sample j pairs row j's features with the close delta to row j + 1.
+        const std::size_t samples = rows - 1;
+        std::vector<double> y(samples);
+        for (std::size_t j = 0; j < samples; ++j)
+            y[j] = features.at(j + 1, *close) - features.at(j, *close);
+
+        // Slide one accumulator across the folds and snapshot it per fold.
+        std::vector<fin::ml::RidgeAccumulator> windows;
+        windows.reserve(folds.size());
+        {
+            fin::ml::RidgeAccumulator acc(features.cols());
+            std::size_t lo = 0, hi = 0; // acc holds samples [lo, hi)
+            for (const auto &f : folds)
+            {
+                for (; hi < f.train_end; ++hi)
+                    acc.add_sample(features.row(hi), y[hi]);
+                for (; lo < f.train_begin; ++lo)
+                    acc.remove_sample(features.row(lo), y[lo]);
+                windows.push_back(acc);
+            }
+        }
+
+        const std::size_t preview_limit = config.validation_preview_limit ? config.validation_preview_limit : 3;
+        fin::ml::LinearTrainingOptions train_opts{};
+        train_opts.ridge_lambda = config.ridge_lambda;
+
+        std::vector<FoldOutput> outputs(folds.size());
+        auto run_fold = [&](std::size_t i)
+        {
+            WalkForwardFold &f = folds[i];
+            FoldOutput &out = outputs[i];
+            out.training = fin::ml::train_linear(windows[i], features.schema->names(), train_opts);
+
+            fin::ml::LinearModel &model = out.training.model;
+            model.bind(*features.schema);
+            std::vector<double> pred(f.test_end - f.test_begin);
+            model.predict_batch(features.subview(f.test_begin, pred.size()), pred);
+            for (std::size_t j = f.test_begin; j < f.test_end; ++j)
+            {
+                const double p = pred[j - f.test_begin];
+                const double err = p - y[j];
+                out.sse += err * err;
+                if (out.preview.size() < preview_limit)
+                    out.preview.push_back({to_ms(features.ts[j + 1]), p, y[j]});
+            }
+            f.validation_rmse = std::sqrt(out.sse / static_cast<double>(pred.size()));
+
+            // Row j closes candle warmup + j; its prediction trades the next candle.
+            const std::size_t w = result.warmup_candles;
+            fin::backtest::Backtester bt = make_scenario_backtester(config);
+            for (std::size_t c = w + f.train_begin; c <= w + f.test_begin; ++c)
+                bt.warm_up(bars.candle(c));
+            for (std::size_t c = w + f.test_begin + 1; c <= w + f.test_end; ++c)
+                bt.on_candle(bars.candle(c), pred[c - 1 - w - f.test_begin]);
+            f.metrics = bt.finalize();
+            f.test_start_ms = to_ms(bars.ts[w + f.test_begin + 1]);
+            f.test_end_ms = to_ms(bars.ts[w + f.test_end]);
+        };
+
+        // Folds only read the shared features/bars and write their own slot.
+        std::size_t threads = config.walk_forward_threads ? config.walk_forward_threads : std::thread::hardware_concurrency();
+        threads = std::clamp<std::size_t>(threads, 1, folds.size());
+        if (threads == 1)
+        {
+            for (std::size_t i = 0; i < folds.size(); ++i)
+                run_fold(i);
+        }
+        else
+        {
+            std::atomic<std::size_t> next{0};
+            std::vector<std::exception_ptr> errors(threads);
+            std::vector<std::thread> pool;
+            pool.reserve(threads);
+            for (std::size_t t = 0; t < threads; ++t)
+            {
+                pool.emplace_back([&, t]
+                                  {
+                                      try
+                                      {
+                                          for (std::size_t i = next.fetch_add(1); i < folds.size(); i = next.fetch_add(1))
+                                              run_fold(i);
+                                      }
+                                      catch (...)
+                                      {
+                                          errors[t] = std::current_exception();
+                                          next = folds.size();
+                                      } });
+            }
+            for (auto &t : pool)
+                t.join();
+            for (auto &e : errors)
+                if (e)
+                    std::rethrow_exception(e);
+        }
+
+        double sse = 0.0;
+        for (std::size_t i = 0; i < folds.size(); ++i)
+        {
+            sse += outputs[i].sse;
+            result.validation_samples += folds[i].test_end - folds[i].test_begin;
+            for (const auto &p : outputs[i].preview)
+                if (result.validation_preview.size() < preview_limit)
+                    result.validation_preview.push_back(p);
+        }
+        result.validation_rmse = std::sqrt(sse / static_cast<double>(result.validation_samples));
+        result.training = std::move(outputs.back().training);
+
+        if (config.model_output_path)
+        {
+            if (!fin::ml::save_linear_model(result.training.model, *config.model_output_path))
+                throw std::runtime_error("Failed to persist linear model to " + *config.model_output_path);
+            result.model_saved = true;
+        }
+
+        result.metrics = sum_fold_metrics(folds);
+        result.folds = std::move(folds);
+        return result;
+    }
+}
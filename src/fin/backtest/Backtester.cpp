@@ -1,5 +1,7 @@
 #include "fin/backtest/Backtester.hpp"
 
+#include "fin/indicators/IndicatorGraph.hpp"
+
 namespace fin::backtest
 {
     using fin::core::Candle;
@@ -88,25 +90,54 @@ namespace fin::backtest
         }
     }
 
-    void Backtester::on_candle(const Candle &c, std::optional<double> prediction)
+    void Backtester::share_indicators(fin::indicators::IndicatorGraph &graph)
     {
-        ema_fast_.update(c);
-        ema_slow_.update(c);
-        rsi_.update(c);
-        auto e_fast = ema_fast_.is_ready() ? std::optional<double>(ema_fast_.value()) : std::nullopt;
-        auto e_slow = ema_slow_.is_ready() ? std::optional<double>(ema_slow_.value()) : std::nullopt;
-        auto r = rsi_.is_ready() ? std::optional<double>(rsi_.value()) : std::nullopt;
+        graph_nodes_[0] = graph.ema(cfg_.ema_fast);
+        graph_nodes_[1] = graph.ema(cfg_.ema_slow);
+        graph_nodes_[2] = graph.rsi(cfg_.rsi_period);
+        graph_ = &graph;
+    }
 
+    void Backtester::on_candle(const Candle &c, std::optional<double> prediction)
+    {
         IndicatorsSnapshot snap = make_snapshot(c);
-        snap.ema_fast = e_fast;
-        snap.ema_slow = e_slow;
-        snap.rsi = r;
+        if (graph_)
+        {
+            snap.ema_fast = graph_->get(graph_nodes_[0]);
+            snap.ema_slow = graph_->get(graph_nodes_[1]);
+            snap.rsi = graph_->get(graph_nodes_[2]);
+        }
+        else
+        {
+            ema_fast_.update(c);
+            ema_slow_.update(c);
+            rsi_.update(c);
+            snap.ema_fast = ema_fast_.is_ready() ? std::optional<double>(ema_fast_.value()) : std::nullopt;
+            snap.ema_slow = ema_slow_.is_ready() ? std::optional<double>(ema_slow_.value()) : std::nullopt;
+            snap.rsi = rsi_.is_ready() ? std::optional<double>(rsi_.value()) : std::nullopt;
+        }
 
         Signal sig = engine_.eval(snap, prediction);
         apply_signal(c, sig);
         update_drawdown(c);
     }
 
+    void Backtester::warm_up(const Candle &c)
+    {
+        if (graph_)
+            return;
+        ema_fast_.update(c);
+        ema_slow_.update(c);
+        rsi_.update(c);
+    }
+
+    void Backtester::on_candles(const fin::core::CandleSeriesView &bars,
+                                std::span<const std::optional<double>> predictions)
+    {
+        for (std::size_t i = 0; i < bars.size(); ++i)
+            on_candle(bars.candle(i), i < predictions.size() ? predictions[i] : std::nullopt);
+    }
+
     Metrics Backtester::finalize()
     {
         if (qty_ > 0.0 && last_close_ > 0.0)
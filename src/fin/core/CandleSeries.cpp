@@ -0,0 +1,82 @@
+#include "fin/core/CandleSeries.hpp"
+
+#include <algorithm>
+
+namespace fin::core
+{
+    Candle CandleSeriesView::candle(std::size_t i) const
+    {
+        return Candle{ts[i], Price{open[i]}, Price{high[i]}, Price{low[i]}, Price{close[i]}, Volume{volume[i]}};
+    }
+
+    CandleSeriesView CandleSeriesView::subview(std::size_t offset, std::size_t count) const
+    {
+        offset = std::min(offset, size());
+        count = std::min(count, size() - offset);
+        return {ts.subspan(offset, count), open.subspan(offset, count), high.subspan(offset, count),
+                low.subspan(offset, count), close.subspan(offset, count), volume.subspan(offset, count)};
+    }
+
+    CandleSeries::CandleSeries(const std::vector<Candle> &candles)
+    {
+        reserve(candles.size());
+        for (const auto &c : candles)
+            push_back(c);
+    }
+
+    void CandleSeries::reserve(std::size_t n)
+    {
+        ts_.reserve(n);
+        open_.reserve(n);
+        high_.reserve(n);
+        low_.reserve(n);
+        close_.reserve(n);
+        volume_.reserve(n);
+    }
+
+    void CandleSeries::clear()
+    {
+        ts_.clear();
+        open_.clear();
+        high_.clear();
+        low_.clear();
+        close_.clear();
+        volume_.clear();
+    }
+
+    void CandleSeries::push_back(const Candle &c)
+    {
+        push_back(c.start_time(), c.open().value(), c.high().value(), c.low().value(), c.close().value(), c.volume().value());
+    }
+
+    void CandleSeries::push_back(Timestamp ts, double open, double high, double low, double close, double volume)
+    {
+        ts_.push_back(ts);
+        open_.push_back(open);
+        high_.push_back(high);
+        low_.push_back(low);
+        close_.push_back(close);
+        volume_.push_back(volume);
+    }
+
+    Candle CandleSeries::operator[](std::size_t i) const
+    {
+        return view().candle(i);
+    }
+
+    CandleSeriesView CandleSeries::view() const
+    {
+        return {ts_, open_, high_, low_, close_, volume_};
+    }
+
+    std::vector<Candle> CandleSeries::to_candles() const
+    {
+        std::vector<Candle> out;
+        out.reserve(size());
+        const auto v = view();
+        for (std::size_t i = 0; i < v.size(); ++i)
+            out.push_back(v.candle(i));
+        return out;
+    }
+
+} // namespace fin::core
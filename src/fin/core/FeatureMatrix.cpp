@@ -0,0 +1,70 @@
+#include "fin/core/FeatureMatrix.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace fin::core
+{
+    FeatureSchema::FeatureSchema(std::vector<std::string> names) : names_(std::move(names))
+    {
+        for (std::size_t i = 0; i < names_.size(); ++i)
+        {
+            if (names_[i].empty())
+                throw std::invalid_argument("FeatureSchema: empty feature name");
+            if (std::find(names_.begin(), names_.begin() + static_cast<std::ptrdiff_t>(i), names_[i]) !=
+                names_.begin() + static_cast<std::ptrdiff_t>(i))
+                throw std::invalid_argument("FeatureSchema: duplicate feature name '" + names_[i] + "'");
+        }
+    }
+
+    std::shared_ptr<const FeatureSchema> FeatureSchema::make(std::vector<std::string> names)
+    {
+        return std::make_shared<const FeatureSchema>(std::move(names));
+    }
+
+    std::optional<std::size_t> FeatureSchema::index_of(std::string_view name) const noexcept
+    {
+        // Schemas hold a handful of columns; a scan beats hashing here.
+        for (std::size_t i = 0; i < names_.size(); ++i)
+            if (names_[i] == name)
+                return i;
+        return std::nullopt;
+    }
+
+    FeatureMatrixView FeatureMatrixView::subview(std::size_t offset, std::size_t count) const
+    {
+        offset = std::min(offset, rows());
+        count = std::min(count, rows() - offset);
+        return {schema, ts.subspan(offset, count), values.subspan(offset * cols(), count * cols())};
+    }
+
+    FeatureMatrix::FeatureMatrix(FeatureSchemaPtr schema) : schema_(std::move(schema))
+    {
+        if (!schema_)
+            throw std::invalid_argument("FeatureMatrix: null schema");
+    }
+
+    void FeatureMatrix::reserve(std::size_t rows)
+    {
+        ts_.reserve(rows);
+        values_.reserve(rows * cols());
+    }
+
+    void FeatureMatrix::clear()
+    {
+        ts_.clear();
+        values_.clear();
+    }
+
+    void FeatureMatrix::append(Timestamp ts, std::span<const double> values)
+    {
+        if (values.size() != cols())
+            throw std::invalid_argument("FeatureMatrix::append() row width does not match the schema");
+        ts_.push_back(ts);
+        const std::size_t end = values_.size();
+        values_.resize(end + values.size());
+        std::copy(values.begin(), values.end(), values_.begin() + static_cast<std::ptrdiff_t>(end));
+    }
+
+} // namespace fin::core
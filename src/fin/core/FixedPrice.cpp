@@ -0,0 +1,39 @@
+#include "fin/core/FixedPrice.hpp"
+
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace fin::core
+{
+    namespace
+    {
+        struct ScaleRegistry
+        {
+            std::shared_mutex mutex;
+            std::unordered_map<Symbol, PriceScale> scales;
+        };
+
+        ScaleRegistry &registry()
+        {
+            static ScaleRegistry r;
+            return r;
+        }
+    } // namespace
+
+    void set_price_scale(Symbol sym, PriceScale scale)
+    {
+        auto &r = registry();
+        std::unique_lock lk(r.mutex);
+        r.scales[sym] = scale;
+    }
+
+    PriceScale price_scale(Symbol sym)
+    {
+        auto &r = registry();
+        std::shared_lock lk(r.mutex);
+        auto it = r.scales.find(sym);
+        return it == r.scales.end() ? PriceScale{} : it->second;
+    }
+
+} // namespace fin::core
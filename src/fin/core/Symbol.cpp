@@ -1,14 +1,18 @@
 #include "fin/core/Symbol.hpp"
+#include "fin/core/SymbolTable.hpp"
 
 namespace fin::core
 {
-    Symbol::Symbol(const std::string &v) : val_(v) {}
+    Symbol::Symbol(std::string_view v) : id_(SymbolTable::instance().intern(v)) {}
 
-    const std::string &Symbol::value() const { return val_; }
-
-    bool Symbol::operator==(const Symbol &other) const
+    Symbol Symbol::from_id(std::uint32_t id)
     {
-        return val_ == other.val_;
+        SymbolTable::instance().name(id); // validates the id
+        Symbol s;
+        s.id_ = id;
+        return s;
     }
 
-} // namespace fin::cor
+    const std::string &Symbol::value() const { return SymbolTable::instance().name(id_); }
+
+} // namespace fin::core
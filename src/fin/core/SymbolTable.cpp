@@ -0,0 +1,52 @@
+#include "fin/core/SymbolTable.hpp"
+
+#include <mutex>
+#include <stdexcept>
+
+namespace fin::core
+{
+    SymbolTable &SymbolTable::instance()
+    {
+        static SymbolTable table;
+        return table;
+    }
+
+    SymbolTable::SymbolTable()
+    {
+        names_.emplace_back();
+        ids_.emplace(names_.back(), 0);
+    }
+
+    std::uint32_t SymbolTable::intern(std::string_view name)
+    {
+        {
+            std::shared_lock lk(mutex_);
+            if (auto it = ids_.find(name); it != ids_.end())
+                return it->second;
+        }
+
+        std::unique_lock lk(mutex_);
+        if (auto it = ids_.find(name); it != ids_.end())
+            return it->second; // interned by another thread meanwhile
+
+        const auto id = static_cast<std::uint32_t>(names_.size());
+        names_.emplace_back(name);
+        ids_.emplace(names_.back(), id);
+        return id;
+    }
+
+    const std::string &SymbolTable::name(std::uint32_t id) const
+    {
+        std::shared_lock lk(mutex_);
+        if (id >= names_.size())
+            throw std::out_of_range("Unknown symbol id " + std::to_string(id));
+        return names_[id];
+    }
+
+    std::size_t SymbolTable::size() const
+    {
+        std::shared_lock lk(mutex_);
+        return names_.size();
+    }
+
+} // namespace fin::core
@@ -2,12 +2,16 @@
 
 namespace fin::core
 {
-    Tick::Tick(Timestamp ts, Symbol sym, Price p, Volume v)
-        : ts_(ts), symbol_(std::move(sym)), price_(p), volume_(v) {}
+    FixedTick to_fixed(const Tick &t)
+    {
+        const auto scale = price_scale(t.symbol());
+        return FixedTick{t.timestamp(), t.symbol(), FixedPrice::from_double(t.price().value(), scale), t.volume()};
+    }
 
-    Timestamp Tick::timestamp() const { return ts_; }
-    const Symbol &Tick::symbol() const { return symbol_; }
-    Price Tick::price() const { return price_; }
-    Volume Tick::volume() const { return volume_; }
+    Tick to_double(const FixedTick &t)
+    {
+        const auto scale = price_scale(t.symbol());
+        return Tick{t.timestamp(), t.symbol(), Price{t.price().to_double(scale)}, t.volume()};
+    }
 
 } // namespace fin::core
@@ -56,9 +56,9 @@ namespace fin::indicators
     }
 
     std::vector<std::optional<double>>
-    ATR::compute(const std::vector<double> &highs,
-                 const std::vector<double> &lows,
-                 const std::vector<double> &closes,
+    ATR::compute(std::span<const double> highs,
+                 std::span<const double> lows,
+                 std::span<const double> closes,
                  std::size_t period)
     {
         std::size_t n = std::min({highs.size(), lows.size(), closes.size()});
@@ -1,10 +1,14 @@
 #include "fin/indicators/BollingerBands.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
 namespace fin::indicators
 {
 
     BollingerBands::BollingerBands(std::size_t period, double k)
-        : period_(period), k_(k), sum_(0.0), sumsq_(0.0), current_(std::nullopt) {}
+        : period_(period), k_(k), buf_(period + 1), sum_(0.0), sumsq_(0.0), current_(std::nullopt) {}
 
     void BollingerBands::reset()
     {
@@ -44,7 +48,7 @@ namespace fin::indicators
     }
 
     std::vector<std::optional<BollingerBands::Bands>>
-    BollingerBands::compute(const std::vector<double> &values, std::size_t period, double k)
+    BollingerBands::compute(std::span<const double> values, std::size_t period, double k)
     {
         std::vector<std::optional<Bands>> out;
         out.reserve(values.size());
@@ -54,4 +58,60 @@ namespace fin::indicators
         return out;
     }
 
+    std::size_t BollingerBands::compute_into(std::span<const double> values, std::span<double> middle, std::span<double> upper,
+                                             std::span<double> lower, std::size_t period, double k)
+    {
+        const std::size_t n = values.size();
+        if (middle.size() < n || upper.size() < n || lower.size() < n)
+            throw std::invalid_argument("BollingerBands::compute_into: output buffer shorter than input");
+
+        const std::size_t from = (period == 0 || n < period) ? n : period - 1;
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        const auto head = static_cast<std::ptrdiff_t>(from);
+        std::fill(middle.begin(), middle.begin() + head, nan);
+        std::fill(upper.begin(), upper.begin() + head, nan);
+        std::fill(lower.begin(), lower.begin() + head, nan);
+        if (from == n)
+            return n;
+
+        const double *x = values.data();
+        double *mid = middle.data();
+        double *up = upper.data();
+        double *lo = lower.data();
+
+        // Pass 1: window sums into `middle`, sums of squares into `upper`,
+        // in update()'s order.
+        double sum = 0.0, sumsq = 0.0;
+        for (std::size_t i = 0; i < period; ++i)
+        {
+            sum += x[i];
+            sumsq += x[i] * x[i];
+        }
+        mid[from] = sum;
+        up[from] = sumsq;
+        for (std::size_t i = period; i < n; ++i)
+        {
+            const double old = x[i - period];
+            sum += x[i];
+            sumsq += x[i] * x[i];
+            sum -= old;
+            sumsq -= old * old;
+            mid[i] = sum;
+            up[i] = sumsq;
+        }
+
+        // Pass 2: independent per element, vectorizes.
+        const double p = static_cast<double>(period);
+        for (std::size_t i = from; i < n; ++i)
+        {
+            const double mean = mid[i] / p;
+            const double var = std::max((up[i] / p) - (mean * mean), 0.0);
+            const double stdev = std::sqrt(var);
+            mid[i] = mean;
+            up[i] = mean + k * stdev;
+            lo[i] = mean - k * stdev;
+        }
+        return from;
+    }
+
 } // namespace fin::indicators
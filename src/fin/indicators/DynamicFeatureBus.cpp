@@ -0,0 +1,96 @@
+#include "fin/indicators/DynamicFeatureBus.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+namespace fin::indicators
+{
+    DynamicFeatureBus::DynamicFeatureBus(std::vector<FeatureSpec> specs)
+        : specs_(std::move(specs)), owned_(std::make_unique<IndicatorGraph>()), graph_(owned_.get())
+    {
+        build();
+    }
+
+    DynamicFeatureBus::DynamicFeatureBus(std::vector<FeatureSpec> specs, IndicatorGraph &graph)
+        : specs_(std::move(specs)), graph_(&graph)
+    {
+        build();
+    }
+
+    void DynamicFeatureBus::build()
+    {
+        IndicatorGraph &graph = *graph_;
+        if (specs_.empty())
+            throw std::invalid_argument("DynamicFeatureBus: empty feature set");
+        if (auto error = feature_spec_error(specs_))
+            throw std::invalid_argument("DynamicFeatureBus: " + *error);
+        schema_ = fin::core::FeatureSchema::make(feature_columns(specs_));
+
+        for (const auto &spec : specs_)
+        {
+            switch (spec.kind)
+            {
+            case FeatureKind::Close:
+                columns_.emplace_back(graph.close(), 0);
+                break;
+            case FeatureKind::Ema:
+                columns_.emplace_back(graph.ema(spec.period(0)), 0);
+                break;
+            case FeatureKind::Sma:
+                columns_.emplace_back(graph.sma(spec.period(0)), 0);
+                break;
+            case FeatureKind::Rsi:
+                columns_.emplace_back(graph.rsi(spec.period(0)), 0);
+                break;
+            case FeatureKind::Macd:
+            {
+                const auto m = graph.macd(spec.period(0), spec.period(1), spec.period(2));
+                columns_.emplace_back(m.macd, 0);
+                columns_.emplace_back(m.signal, 0);
+                columns_.emplace_back(m.hist, 0);
+                break;
+            }
+            default:
+            {
+                const auto node = graph.feature(spec);
+                const std::size_t outputs = feature_columns(spec).size();
+                for (std::size_t k = 0; k < outputs; ++k)
+                    columns_.emplace_back(node, k);
+                break;
+            }
+            }
+        }
+    }
+
+    bool DynamicFeatureBus::update(const FeatureInput &in, std::span<double> out)
+    {
+        graph_->update(in);
+        return read(out);
+    }
+
+    bool DynamicFeatureBus::read(std::span<double> out) const
+    {
+        if (out.size() < columns_.size())
+            throw std::invalid_argument("DynamicFeatureBus: output row is narrower than the schema");
+        for (std::size_t c = 0; c < columns_.size(); ++c)
+        {
+            const auto [node, output] = columns_[c];
+            if (!graph_->ready(node))
+                return false;
+            out[c] = graph_->value(node, output);
+        }
+        return true;
+    }
+
+    std::size_t DynamicFeatureBus::update(const fin::core::CandleSeriesView &bars, fin::core::FeatureMatrix &out)
+    {
+        if (!(*out.schema() == *schema_))
+            throw std::invalid_argument("DynamicFeatureBus::update() matrix schema does not match the bus");
+        const std::size_t before = out.rows();
+        std::vector<double> row(width());
+        for (std::size_t i = 0; i < bars.size(); ++i)
+            if (update(FeatureInput::from(bars, i), row))
+                out.append(bars.ts[i], row);
+        return out.rows() - before;
+    }
+}
@@ -1,5 +1,9 @@
 #include "fin/indicators/EMA.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
 namespace fin::indicators
 {
 
@@ -43,7 +47,7 @@ namespace fin::indicators
     }
 
     std::vector<std::optional<double>>
-    EMA::compute(const std::vector<double> &values, std::size_t period)
+    EMA::compute(std::span<const double> values, std::size_t period)
     {
         std::vector<std::optional<double>> out;
         out.reserve(values.size());
@@ -53,4 +57,35 @@ namespace fin::indicators
         return out;
     }
 
+    std::size_t EMA::compute_into(std::span<const double> values, std::span<double> out, std::size_t period)
+    {
+        const std::size_t n = values.size();
+        if (out.size() < n)
+            throw std::invalid_argument("EMA::compute_into: output buffer shorter than input");
+
+        const std::size_t from = (period == 0 || n < period) ? n : period - 1;
+        std::fill(out.begin(), out.begin() + static_cast<std::ptrdiff_t>(from), std::numeric_limits<double>::quiet_NaN());
+        if (from == n)
+            return n;
+
+        const double *x = values.data();
+        double *o = out.data();
+        const double alpha = 2.0 / (static_cast<double>(period) + 1.0);
+
+        double sum = 0.0;
+        for (std::size_t i = 0; i < period; ++i)
+            sum += x[i];
+        double ema = sum / static_cast<double>(period);
+        o[from] = ema;
+
+        // The recurrence is inherently serial; this just drops the optional
+        // and per-call overhead of update().
+        for (std::size_t i = period; i < n; ++i)
+        {
+            ema = alpha * x[i] + (1.0 - alpha) * ema;
+            o[i] = ema;
+        }
+        return from;
+    }
+
 } // namespace fin::indicators
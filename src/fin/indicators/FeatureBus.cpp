@@ -1,39 +1,58 @@
 #include "fin/indicators/FeatureBus.hpp"
 
+#include <stdexcept>
+
 namespace fin::indicators
 {
     FeatureBus::FeatureBus(std::size_t ema_fast, std::size_t rsi_p,
                            std::size_t macd_fast, std::size_t macd_slow, std::size_t macd_signal)
-        : ema_(ema_fast), rsi_(rsi_p), macd_(macd_fast, macd_slow, macd_signal) {}
+        : bus_(schema(), features::Close{}, features::Ema(ema_fast), features::Rsi(rsi_p),
+               features::Macd(macd_fast, macd_slow, macd_signal)) {}
 
     void FeatureBus::reset()
     {
-        // If your EMA/RSI/MACD expose reset(), call them; else do nothing
-        ema_.reset();
-        rsi_.reset();
-        macd_.reset();
+        bus_.reset();
     }
 
     std::optional<FeatureRow> FeatureBus::update(const fin::core::Candle &c)
     {
-        const double close = c.close().value();
+        return update(c.start_time(), c.close().value());
+    }
 
-        auto e = ema_.update(close);
-        // RSI consumes Price via its interface
-        rsi_.update(fin::core::Price(close));
-        auto r = rsi_.is_ready() ? std::optional<double>(rsi_.value()) : std::nullopt;
-        auto m = macd_.update(close);
+    std::vector<FeatureRow> FeatureBus::update(const fin::core::CandleSeriesView &bars)
+    {
+        std::vector<FeatureRow> rows;
+        rows.reserve(bars.size());
+        for (std::size_t i = 0; i < bars.size(); ++i)
+            if (auto row = update(bars.ts[i], bars.close[i]))
+                rows.push_back(*row);
+        return rows;
+    }
 
-        if (!e || !r || !m)
-            return std::nullopt;
+    std::size_t FeatureBus::update(const fin::core::CandleSeriesView &bars, fin::core::FeatureMatrix &out)
+    {
+        if (!(*out.schema() == *schema()))
+            throw std::invalid_argument("FeatureBus::update() matrix schema does not match FeatureBus::schema()");
+        return bus_.update(bars, out);
+    }
 
-        return FeatureRow{
-            c.start_time(),
-            close,
-            *e,
-            *r,
-            m->macd,
-            m->signal,
-            m->hist};
+    const fin::core::FeatureSchemaPtr &FeatureBus::schema()
+    {
+        static const fin::core::FeatureSchemaPtr schema =
+            fin::core::FeatureSchema::make({"close", "ema_fast", "rsi", "macd", "macd_signal", "macd_hist"});
+        return schema;
+    }
+
+    FeatureBus::RowValues FeatureBus::row_values(const FeatureRow &row) noexcept
+    {
+        return {row.close, row.ema_fast, row.rsi, row.macd, row.macd_signal, row.macd_hist};
+    }
+
+    std::optional<FeatureRow> FeatureBus::update(fin::core::Timestamp ts, double close)
+    {
+        RowValues v;
+        if (!bus_.update(FeatureInput{close, close, close, 0.0}, v))
+            return std::nullopt;
+        return FeatureRow{ts, v[0], v[1], v[2], v[3], v[4], v[5]};
     }
 }
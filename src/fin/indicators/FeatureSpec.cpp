@@ -0,0 +1,231 @@
+#include "fin/indicators/FeatureSpec.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+
+namespace fin::indicators
+{
+    namespace
+    {
+        // Upper bound for whole-period parameters; keeps period() in range.
+        constexpr double kMaxPeriod = 1e9;
+
+        struct KindInfo
+        {
+            FeatureKind kind;
+            std::string_view token;
+            std::vector<double> defaults;             // one per parameter
+            std::vector<std::string_view> suffixes{}; // extra output columns
+        };
+
+        const std::vector<KindInfo> &kinds()
+        {
+            static const std::vector<KindInfo> table = {
+                {FeatureKind::Close, "close", {}},
+                {FeatureKind::Sma, "sma", {14}},
+                {FeatureKind::Ema, "ema", {12}},
+                {FeatureKind::Rsi, "rsi", {14}},
+                {FeatureKind::Macd, "macd", {12, 26, 9}, {"_signal", "_hist"}},
+                {FeatureKind::Bollinger, "bbands", {20, 2.0}, {"_upper", "_lower"}},
+                {FeatureKind::Atr, "atr", {14}},
+                {FeatureKind::Adx, "adx", {14}},
+                {FeatureKind::Stochastic, "stoch", {14, 3}, {"_d"}},
+                {FeatureKind::Vwap, "vwap", {}},
+                {FeatureKind::ZScore, "zscore", {20}},
+                {FeatureKind::Momentum, "momentum", {10}},
+            };
+            return table;
+        }
+
+        const KindInfo &info(FeatureKind kind)
+        {
+            for (const auto &k : kinds())
+                if (k.kind == kind)
+                    return k;
+            return kinds().front();
+        }
+
+        std::string_view trim(std::string_view sv)
+        {
+            while (!sv.empty() && std::isspace(static_cast<unsigned char>(sv.front())))
+                sv.remove_prefix(1);
+            while (!sv.empty() && std::isspace(static_cast<unsigned char>(sv.back())))
+                sv.remove_suffix(1);
+            return sv;
+        }
+
+        bool valid_name(std::string_view name)
+        {
+            if (name.empty())
+                return false;
+            for (char c : name)
+                if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_')
+                    return false;
+            return true;
+        }
+
+        // Shortest form that parses back to the same double.
+        std::string format_number(double v)
+        {
+            char buf[32];
+            const auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), v);
+            return std::string(buf, ec == std::errc{} ? end : buf);
+        }
+
+        std::string default_name(const FeatureSpec &spec)
+        {
+            std::string name(info(spec.kind).token);
+            for (double p : spec.params)
+                name += '_' + format_number(p);
+            for (char &c : name)
+                if (c == '.')
+                    c = 'p';
+            return name;
+        }
+    } // namespace
+
+    std::optional<FeatureSpec> parse_feature_spec(std::string_view token)
+    {
+        token = trim(token);
+        std::optional<std::string_view> alias;
+        if (auto eq = token.find('='); eq != std::string_view::npos)
+        {
+            alias = trim(token.substr(0, eq));
+            token = trim(token.substr(eq + 1));
+            if (!valid_name(*alias))
+                return std::nullopt;
+            // "close" names the regression target; only the close kind may take it.
+            if (*alias == "close" && trim(token.substr(0, token.find(':'))) != "close")
+                return std::nullopt;
+        }
+
+        std::vector<std::string_view> parts;
+        for (std::size_t pos = 0;;)
+        {
+            const auto colon = token.find(':', pos);
+            parts.push_back(trim(token.substr(pos, colon == std::string_view::npos ? std::string_view::npos : colon - pos)));
+            if (colon == std::string_view::npos)
+                break;
+            pos = colon + 1;
+        }
+
+        std::string kind_token;
+        for (char c : parts.front())
+            kind_token += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+
+        const KindInfo *kind = nullptr;
+        for (const auto &k : kinds())
+            if (k.token == kind_token)
+                kind = &k;
+        if (!kind || parts.size() - 1 > kind->defaults.size())
+            return std::nullopt;
+
+        FeatureSpec spec;
+        spec.kind = kind->kind;
+        spec.params = kind->defaults;
+        for (std::size_t i = 1; i < parts.size(); ++i)
+        {
+            double v = 0.0;
+            const char *begin = parts[i].data();
+            const char *end = begin + parts[i].size();
+            auto [ptr, ec] = std::from_chars(begin, end, v);
+            if (ec != std::errc{} || ptr != end || !(v > 0.0) || !std::isfinite(v))
+                return std::nullopt;
+            spec.params[i - 1] = v;
+        }
+
+        // Everything but the Bollinger multiplier is a whole period.
+        for (std::size_t i = 0; i < spec.params.size(); ++i)
+        {
+            const bool multiplier = spec.kind == FeatureKind::Bollinger && i == 1;
+            if (!multiplier && (spec.params[i] != std::floor(spec.params[i]) || spec.params[i] > kMaxPeriod))
+                return std::nullopt;
+        }
+        if (spec.kind == FeatureKind::Macd && spec.params[0] >= spec.params[1])
+            return std::nullopt;
+
+        spec.name = alias ? std::string(*alias) : default_name(spec);
+        return spec;
+    }
+
+    std::optional<std::vector<FeatureSpec>> parse_feature_specs(std::string_view list)
+    {
+        std::vector<FeatureSpec> specs;
+        for (std::size_t pos = 0; pos <= list.size();)
+        {
+            auto comma = list.find(',', pos);
+            if (comma == std::string_view::npos)
+                comma = list.size();
+            const auto token = trim(list.substr(pos, comma - pos));
+            if (!token.empty())
+            {
+                auto spec = parse_feature_spec(token);
+                if (!spec)
+                    return std::nullopt;
+                specs.push_back(std::move(*spec));
+            }
+            pos = comma + 1;
+        }
+        if (specs.empty() || feature_spec_error(specs))
+            return std::nullopt;
+        return specs;
+    }
+
+    std::optional<std::string> feature_spec_error(const std::vector<FeatureSpec> &specs)
+    {
+        for (const auto &spec : specs)
+            if (spec.name == "close" && spec.kind != FeatureKind::Close)
+                return "column \"close\" must be the close price";
+
+        auto columns = feature_columns(specs);
+        std::sort(columns.begin(), columns.end());
+        const auto dup = std::adjacent_find(columns.begin(), columns.end());
+        if (dup != columns.end())
+            return "duplicate column \"" + *dup + "\"";
+        return std::nullopt;
+    }
+
+    std::string to_string(const FeatureSpec &spec)
+    {
+        std::string token;
+        if (spec.name != default_name(spec))
+            token = spec.name + '=';
+        token += info(spec.kind).token;
+        for (double p : spec.params)
+            token += ':' + format_number(p);
+        return token;
+    }
+
+    std::vector<std::string> feature_columns(const FeatureSpec &spec)
+    {
+        std::vector<std::string> columns{spec.name};
+        for (auto suffix : info(spec.kind).suffixes)
+            columns.push_back(spec.name + std::string(suffix));
+        return columns;
+    }
+
+    std::vector<std::string> feature_columns(const std::vector<FeatureSpec> &specs)
+    {
+        std::vector<std::string> columns;
+        for (const auto &spec : specs)
+            for (auto &c : feature_columns(spec))
+                columns.push_back(std::move(c));
+        return columns;
+    }
+
+    std::vector<FeatureSpec> default_feature_specs(std::size_t ema_fast, std::size_t rsi_period,
+                                                   std::size_t macd_fast, std::size_t macd_slow,
+                                                   std::size_t macd_signal)
+    {
+        auto d = [](std::size_t v)
+        { return static_cast<double>(v); };
+        return {
+            {FeatureKind::Close, "close", {}},
+            {FeatureKind::Ema, "ema_fast", {d(ema_fast)}},
+            {FeatureKind::Rsi, "rsi", {d(rsi_period)}},
+            {FeatureKind::Macd, "macd", {d(macd_fast), d(macd_slow), d(macd_signal)}},
+        };
+    }
+}
@@ -0,0 +1,214 @@
+#include "fin/indicators/IndicatorGraph.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace fin::indicators
+{
+    // Spec kinds with no shared sub-indicators run as one opaque feature node.
+    struct IndicatorGraph::Opaque
+    {
+        virtual ~Opaque() = default;
+        virtual bool update(const FeatureInput &in, double *out) = 0;
+        virtual void reset() = 0;
+    };
+
+    namespace
+    {
+        template <class F>
+        struct OpaqueImpl final : IndicatorGraph::Opaque
+        {
+            explicit OpaqueImpl(F f) : feature(std::move(f)) {}
+            bool update(const FeatureInput &in, double *out) override { return feature.update(in, out); }
+            void reset() override { feature.reset(); }
+            F feature;
+        };
+
+        template <class F>
+        std::unique_ptr<IndicatorGraph::Opaque> opaque(F f)
+        {
+            return std::make_unique<OpaqueImpl<F>>(std::move(f));
+        }
+
+        std::unique_ptr<IndicatorGraph::Opaque> make_opaque(const FeatureSpec &spec)
+        {
+            switch (spec.kind)
+            {
+            case FeatureKind::Bollinger:
+                return opaque(features::Bollinger(spec.period(0), spec.params.at(1)));
+            case FeatureKind::Atr:
+                return opaque(features::Atr(spec.period(0)));
+            case FeatureKind::Adx:
+                return opaque(features::Adx(spec.period(0)));
+            case FeatureKind::Stochastic:
+                return opaque(features::Stoch(spec.period(0), spec.period(1)));
+            case FeatureKind::Vwap:
+                return opaque(features::Vwap{});
+            case FeatureKind::ZScore:
+                return opaque(features::ZScoreOf(spec.period(0)));
+            case FeatureKind::Momentum:
+                return opaque(features::MomentumOf(spec.period(0)));
+            default:
+                throw std::invalid_argument("IndicatorGraph::feature() kind has dedicated nodes");
+            }
+        }
+    } // namespace
+
+    IndicatorGraph::IndicatorGraph()
+    {
+        Node close;
+        close.op = Op::Close;
+        find_or_add(std::move(close), 1);
+    }
+
+    IndicatorGraph::~IndicatorGraph() = default;
+    IndicatorGraph::IndicatorGraph(IndicatorGraph &&) noexcept = default;
+    IndicatorGraph &IndicatorGraph::operator=(IndicatorGraph &&) noexcept = default;
+
+    IndicatorGraph::NodeId IndicatorGraph::find_or_add(Node node, std::size_t outputs)
+    {
+        if (node.op != Op::Close && (node.a >= nodes_.size() || node.b >= nodes_.size()))
+            throw std::out_of_range("IndicatorGraph: unknown input node");
+
+        // Graphs hold a handful of nodes; a scan is all the lookup needed.
+        for (NodeId id = 0; id < nodes_.size(); ++id)
+        {
+            const Node &n = nodes_[id];
+            if (n.op == node.op && n.kind == node.kind && n.a == node.a && n.b == node.b && n.params == node.params)
+                return id;
+        }
+
+        node.slot = values_.size();
+        values_.resize(values_.size() + outputs, 0.0);
+        ready_.push_back(0);
+        nodes_.push_back(std::move(node));
+        return nodes_.size() - 1;
+    }
+
+    IndicatorGraph::NodeId IndicatorGraph::ema(std::size_t period, NodeId input)
+    {
+        Node n;
+        n.op = Op::Ema;
+        n.a = n.b = input;
+        n.params = {static_cast<double>(period)};
+        n.state = EMA(period);
+        return find_or_add(std::move(n), 1);
+    }
+
+    IndicatorGraph::NodeId IndicatorGraph::sma(std::size_t period, NodeId input)
+    {
+        Node n;
+        n.op = Op::Sma;
+        n.a = n.b = input;
+        n.params = {static_cast<double>(period)};
+        n.state = SMA(period);
+        return find_or_add(std::move(n), 1);
+    }
+
+    IndicatorGraph::NodeId IndicatorGraph::rsi(std::size_t period)
+    {
+        Node n;
+        n.op = Op::Rsi;
+        n.params = {static_cast<double>(period)};
+        n.state = RSI(period);
+        return find_or_add(std::move(n), 1);
+    }
+
+    IndicatorGraph::NodeId IndicatorGraph::diff(NodeId a, NodeId b)
+    {
+        Node n;
+        n.op = Op::Diff;
+        n.a = a;
+        n.b = b;
+        return find_or_add(std::move(n), 1);
+    }
+
+    IndicatorGraph::MacdNodes IndicatorGraph::macd(std::size_t fast, std::size_t slow, std::size_t signal)
+    {
+        const NodeId line = diff(ema(fast), ema(slow));
+        const NodeId sig = ema(signal, line);
+        return {line, sig, diff(line, sig)};
+    }
+
+    IndicatorGraph::NodeId IndicatorGraph::feature(const FeatureSpec &spec)
+    {
+        Node n;
+        n.op = Op::Feature;
+        n.kind = spec.kind;
+        n.params = spec.params;
+        n.state = make_opaque(spec);
+        return find_or_add(std::move(n), feature_columns(spec).size());
+    }
+
+    void IndicatorGraph::update(const FeatureInput &in)
+    {
+        for (std::size_t id = 0; id < nodes_.size(); ++id)
+        {
+            Node &n = nodes_[id];
+            double *out = values_.data() + n.slot;
+            char &ready = ready_[id];
+            switch (n.op)
+            {
+            case Op::Close:
+                *out = in.close;
+                ready = 1;
+                break;
+            case Op::Ema:
+                if (ready_[n.a])
+                    if (auto v = std::get_if<EMA>(&n.state)->update(values_[nodes_[n.a].slot]))
+                    {
+                        *out = *v;
+                        ready = 1;
+                    }
+                break;
+            case Op::Sma:
+                if (ready_[n.a])
+                    if (auto v = std::get_if<SMA>(&n.state)->update(values_[nodes_[n.a].slot]))
+                    {
+                        *out = *v;
+                        ready = 1;
+                    }
+                break;
+            case Op::Rsi:
+            {
+                RSI &rsi = *std::get_if<RSI>(&n.state);
+                rsi.update(fin::core::Price(in.close));
+                if (rsi.is_ready())
+                {
+                    *out = rsi.value();
+                    ready = 1;
+                }
+                break;
+            }
+            case Op::Diff:
+                if (ready_[n.a] && ready_[n.b])
+                {
+                    *out = values_[nodes_[n.a].slot] - values_[nodes_[n.b].slot];
+                    ready = 1;
+                }
+                break;
+            case Op::Feature:
+                ready = (*std::get_if<std::unique_ptr<Opaque>>(&n.state))->update(in, out) ? 1 : 0;
+                break;
+            }
+        }
+    }
+
+    void IndicatorGraph::reset()
+    {
+        for (auto &n : nodes_)
+        {
+            if (auto *e = std::get_if<EMA>(&n.state))
+                e->reset();
+            else if (auto *s = std::get_if<SMA>(&n.state))
+                s->reset();
+            else if (auto *r = std::get_if<RSI>(&n.state))
+                r->reset();
+            else if (auto *o = std::get_if<std::unique_ptr<Opaque>>(&n.state))
+                (*o)->reset();
+        }
+        std::fill(values_.begin(), values_.end(), 0.0);
+        std::fill(ready_.begin(), ready_.end(), 0);
+    }
+}
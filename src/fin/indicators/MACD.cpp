@@ -48,7 +48,7 @@ namespace fin::indicators
     }
 
     std::vector<std::optional<MACDValue>>
-    MACD::compute(const std::vector<double> &closes,
+    MACD::compute(std::span<const double> closes,
                   std::size_t fast, std::size_t slow, std::size_t signal)
     {
 
@@ -4,7 +4,7 @@ namespace fin::indicators
 {
 
     Momentum::Momentum(std::size_t period, Mode mode)
-        : period_(period), mode_(mode), current_(std::nullopt) {}
+        : period_(period), mode_(mode), buf_(period + 1), current_(std::nullopt) {}
 
     void Momentum::reset()
     {
@@ -39,7 +39,7 @@ namespace fin::indicators
     }
 
     std::vector<std::optional<double>>
-    Momentum::compute(const std::vector<double> &closes,
+    Momentum::compute(std::span<const double> closes,
                       std::size_t period, Mode mode)
     {
         std::vector<std::optional<double>> out;
@@ -1,9 +1,13 @@
 #include "fin/indicators/SMA.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
 namespace fin::indicators
 {
     SMA::SMA(std::size_t period)
-        : period_(period), sum_(0.0), current_(std::nullopt) {}
+        : period_(period), buf_(period + 1), sum_(0.0), current_(std::nullopt) {}
 
     void SMA::reset()
     {
@@ -33,7 +37,7 @@ namespace fin::indicators
     }
 
     std::vector<std::optional<double>>
-    SMA::compute(const std::vector<double> &values, std::size_t period)
+    SMA::compute(std::span<const double> values, std::size_t period)
     {
         std::vector<std::optional<double>> out;
         out.reserve(values.size());
@@ -45,4 +49,37 @@ namespace fin::indicators
         return out;
     }
 
+    std::size_t SMA::compute_into(std::span<const double> values, std::span<double> out, std::size_t period)
+    {
+        const std::size_t n = values.size();
+        if (out.size() < n)
+            throw std::invalid_argument("SMA::compute_into: output buffer shorter than input");
+
+        const std::size_t from = (period == 0 || n < period) ? n : period - 1;
+        std::fill(out.begin(), out.begin() + static_cast<std::ptrdiff_t>(from), std::numeric_limits<double>::quiet_NaN());
+        if (from == n)
+            return n;
+
+        const double *x = values.data();
+        double *o = out.data();
+
+        // Pass 1: running window sums, in update()'s order (add new, drop old).
+        double sum = 0.0;
+        for (std::size_t i = 0; i < period; ++i)
+            sum += x[i];
+        o[from] = sum;
+        for (std::size_t i = period; i < n; ++i)
+        {
+            sum += x[i];
+            sum -= x[i - period];
+            o[i] = sum;
+        }
+
+        // Pass 2: independent per element, vectorizes.
+        const double p = static_cast<double>(period);
+        for (std::size_t i = from; i < n; ++i)
+            o[i] /= p;
+        return from;
+    }
+
 } // namespace fin::indicators
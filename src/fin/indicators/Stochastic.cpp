@@ -6,7 +6,7 @@ namespace fin::indicators
 {
 
     Stochastic::Stochastic(std::size_t kPeriod, std::size_t dPeriod)
-        : kPeriod_(kPeriod), dPeriod_(dPeriod)
+        : kPeriod_(kPeriod), dPeriod_(dPeriod), dqHigh_(kPeriod), dqLow_(kPeriod), kBuf_(dPeriod + 1)
     {
         reset();
     }
@@ -21,43 +21,18 @@ namespace fin::indicators
         current_.reset();
     }
 
-    void Stochastic::push_high(double h)
-    {
-        while (!dqHigh_.empty() && dqHigh_.back().v <= h)
-        {
-            dqHigh_.pop_back();
-        }
-        dqHigh_.push_back(Node{h, idx_});
-    }
-
-    void Stochastic::push_low(double l)
-    {
-        while (!dqLow_.empty() && dqLow_.back().v >= l)
-        {
-            dqLow_.pop_back();
-        }
-        dqLow_.push_back(Node{l, idx_});
-    }
-
-    void Stochastic::evict_old(std::size_t window_start)
-    {
-        while (!dqHigh_.empty() && dqHigh_.front().idx < window_start)
-            dqHigh_.pop_front();
-        while (!dqLow_.empty() && dqLow_.front().idx < window_start)
-            dqLow_.pop_front();
-    }
-
     std::optional<StochOut> Stochastic::update(double high, double low, double close)
     {
         // Insert current high/low
-        push_high(high);
-        push_low(low);
+        dqHigh_.push(high, idx_);
+        dqLow_.push(low, idx_);
 
         // Keep only last kPeriod_ elements in window
         if (idx_ + 1 >= kPeriod_)
         {
             std::size_t window_start = idx_ + 1 - kPeriod_;
-            evict_old(window_start);
+            dqHigh_.evict_before(window_start);
+            dqLow_.evict_before(window_start);
         }
 
         std::optional<StochOut> out = std::nullopt;
@@ -104,9 +79,9 @@ namespace fin::indicators
     }
 
     std::vector<std::optional<StochOut>>
-    Stochastic::compute(const std::vector<double> &highs,
-                        const std::vector<double> &lows,
-                        const std::vector<double> &closes,
+    Stochastic::compute(std::span<const double> highs,
+                        std::span<const double> lows,
+                        std::span<const double> closes,
                         std::size_t kPeriod, std::size_t dPeriod)
     {
         std::size_t n = std::min({highs.size(), lows.size(), closes.size()});
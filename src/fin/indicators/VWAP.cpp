@@ -39,8 +39,8 @@ namespace fin::indicators
 
     // Batch helpers (direct price/volume)
     std::vector<double>
-    VWAP::compute(const std::vector<double> &prices,
-                  const std::vector<double> &volumes)
+    VWAP::compute(std::span<const double> prices,
+                  std::span<const double> volumes)
     {
         std::size_t n = std::min(prices.size(), volumes.size());
         std::vector<double> out;
@@ -53,10 +53,10 @@ namespace fin::indicators
         return out;
     }
 
-    std::vector<double> VWAP::compute(const std::vector<double> &highs,
-                                      const std::vector<double> &lows,
-                                      const std::vector<double> &closes,
-                                      const std::vector<double> &volumes)
+    std::vector<double> VWAP::compute(std::span<const double> highs,
+                                      std::span<const double> lows,
+                                      std::span<const double> closes,
+                                      std::span<const double> volumes)
     {
         std::size_t n = std::min({highs.size(), lows.size(), closes.size(), volumes.size()});
         std::vector<double> out;
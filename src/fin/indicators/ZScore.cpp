@@ -1,11 +1,14 @@
 #include "fin/indicators/ZScore.hpp"
 #include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <vector>
 
 namespace fin::indicators
 {
 
     ZScore::ZScore(std::size_t period)
-        : period_(period), sum_(0.0), sumsq_(0.0), current_(std::nullopt) {}
+        : period_(period), buf_(period + 1), sum_(0.0), sumsq_(0.0), current_(std::nullopt) {}
 
     void ZScore::reset()
     {
@@ -45,7 +48,7 @@ namespace fin::indicators
     }
 
     std::vector<std::optional<double>>
-    ZScore::compute(const std::vector<double> &values, std::size_t period)
+    ZScore::compute(std::span<const double> values, std::size_t period)
     {
         std::vector<std::optional<double>> out;
         out.reserve(values.size());
@@ -55,4 +58,61 @@ namespace fin::indicators
         return out;
     }
 
+    std::size_t ZScore::compute_into(std::span<const double> values, std::span<double> out, std::size_t period)
+    {
+        std::vector<double> scratch(values.size());
+        return compute_into(values, out, scratch, period);
+    }
+
+    std::size_t ZScore::compute_into(std::span<const double> values, std::span<double> out, std::span<double> scratch,
+                                     std::size_t period)
+    {
+        const std::size_t n = values.size();
+        if (out.size() < n)
+            throw std::invalid_argument("ZScore::compute_into: output buffer shorter than input");
+        if (scratch.size() < n)
+            throw std::invalid_argument("ZScore::compute_into: scratch buffer shorter than input");
+
+        const std::size_t from = (period == 0 || n < period) ? n : period - 1;
+        std::fill(out.begin(), out.begin() + static_cast<std::ptrdiff_t>(from), std::numeric_limits<double>::quiet_NaN());
+        if (from == n)
+            return n;
+
+        const double *x = values.data();
+        double *o = out.data();
+        double *sq = scratch.data();
+
+        // Pass 1: window sums into `out`, sums of squares into `scratch`, in
+        // update()'s order.
+        double sum = 0.0, sumsq = 0.0;
+        for (std::size_t i = 0; i < period; ++i)
+        {
+            sum += x[i];
+            sumsq += x[i] * x[i];
+        }
+        o[from] = sum;
+        sq[from] = sumsq;
+        for (std::size_t i = period; i < n; ++i)
+        {
+            const double old = x[i - period];
+            sum += x[i];
+            sumsq += x[i] * x[i];
+            sum -= old;
+            sumsq -= old * old;
+            o[i] = sum;
+            sq[i] = sumsq;
+        }
+
+        // Pass 2: independent per element, vectorizes.
+        const double p = static_cast<double>(period);
+        for (std::size_t i = from; i < n; ++i)
+        {
+            const double mean = o[i] / p;
+            const double var = std::max((sq[i] / p) - mean * mean, 0.0);
+            const double sd = std::sqrt(var);
+            o[i] = (sd > 0.0) ? (x[i] - mean) / sd : 0.0;
+        }
+        return from;
+    }
+
 } // namespace fin::indicators
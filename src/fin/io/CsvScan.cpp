@@ -0,0 +1,138 @@
+#include "fin/io/CsvScan.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define FIN_IO_SCAN_X86 1
+#include <immintrin.h>
+#endif
+
+namespace fin::io
+{
+    namespace
+    {
+        // Scalar pass over [from, size); offsets stay relative to `data`.
+        inline std::size_t scan_tail(const char *data, std::size_t from, std::size_t size, char delim,
+                                     std::uint32_t *out, std::size_t n)
+        {
+            for (std::size_t i = from; i < size; ++i)
+            {
+                const char c = data[i];
+                if (c == delim || c == '\n')
+                    out[n++] = static_cast<std::uint32_t>(i);
+            }
+            return n;
+        }
+
+        std::size_t scan_scalar(const char *data, std::size_t size, char delim, std::uint32_t *out)
+        {
+            return scan_tail(data, 0, size, delim, out, 0);
+        }
+
+#if defined(FIN_IO_SCAN_X86)
+        // Expands a match bitmask into offsets, lowest bit first.
+        inline std::size_t emit_mask(std::uint32_t mask, std::size_t base, std::uint32_t *out, std::size_t n)
+        {
+            while (mask)
+            {
+                out[n++] = static_cast<std::uint32_t>(base + static_cast<std::size_t>(__builtin_ctz(mask)));
+                mask &= mask - 1;
+            }
+            return n;
+        }
+
+        __attribute__((target("sse2")))
+        std::size_t scan_sse2(const char *data, std::size_t size, char delim, std::uint32_t *out)
+        {
+            const __m128i vd = _mm_set1_epi8(delim);
+            const __m128i vn = _mm_set1_epi8('\n');
+            std::size_t n = 0;
+            std::size_t i = 0;
+            for (; i + 16 <= size; i += 16)
+            {
+                const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+                const __m128i hit = _mm_or_si128(_mm_cmpeq_epi8(chunk, vd), _mm_cmpeq_epi8(chunk, vn));
+                n = emit_mask(static_cast<std::uint32_t>(_mm_movemask_epi8(hit)), i, out, n);
+            }
+            return scan_tail(data, i, size, delim, out, n);
+        }
+
+        __attribute__((target("avx2")))
+        std::size_t scan_avx2(const char *data, std::size_t size, char delim, std::uint32_t *out)
+        {
+            const __m256i vd = _mm256_set1_epi8(delim);
+            const __m256i vn = _mm256_set1_epi8('\n');
+            std::size_t n = 0;
+            std::size_t i = 0;
+            for (; i + 32 <= size; i += 32)
+            {
+                const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+                const __m256i hit = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, vd), _mm256_cmpeq_epi8(chunk, vn));
+                n = emit_mask(static_cast<std::uint32_t>(_mm256_movemask_epi8(hit)), i, out, n);
+            }
+            return scan_tail(data, i, size, delim, out, n);
+        }
+#endif
+
+        ScanKernel detect_kernel() noexcept
+        {
+#if defined(FIN_IO_SCAN_X86)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2"))
+                return ScanKernel::AVX2;
+            if (__builtin_cpu_supports("sse2"))
+                return ScanKernel::SSE2;
+#endif
+            return ScanKernel::Scalar;
+        }
+    } // namespace
+
+    ScanKernel best_scan_kernel() noexcept
+    {
+        static const ScanKernel kernel = detect_kernel();
+        return kernel;
+    }
+
+    bool scan_kernel_supported(ScanKernel kernel) noexcept
+    {
+        switch (kernel)
+        {
+        case ScanKernel::AVX2:
+            return best_scan_kernel() == ScanKernel::AVX2;
+        case ScanKernel::SSE2:
+            return best_scan_kernel() != ScanKernel::Scalar;
+        case ScanKernel::Scalar:
+        default:
+            return true;
+        }
+    }
+
+    const char *scan_kernel_name(ScanKernel kernel) noexcept
+    {
+        switch (kernel)
+        {
+        case ScanKernel::AVX2:
+            return "avx2";
+        case ScanKernel::SSE2:
+            return "sse2";
+        case ScanKernel::Scalar:
+        default:
+            return "scalar";
+        }
+    }
+
+    ScanFn scan_function(ScanKernel kernel) noexcept
+    {
+#if defined(FIN_IO_SCAN_X86)
+        if (scan_kernel_supported(kernel))
+        {
+            if (kernel == ScanKernel::AVX2)
+                return &scan_avx2;
+            if (kernel == ScanKernel::SSE2)
+                return &scan_sse2;
+        }
+#else
+        (void)kernel;
+#endif
+        return &scan_scalar;
+    }
+
+} // namespace fin::io
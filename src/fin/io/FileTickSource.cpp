@@ -1,4 +1,5 @@
 #include "fin/io/Sources.hpp"
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <charconv>
@@ -168,4 +169,19 @@ namespace fin::io
         }
         return std::nullopt; // EOF
     }
+
+    // The getline path allocates per row anyway; batching only saves the
+    // caller's virtual call and optional per tick.
+    std::size_t FileTickSource::next_batch(TickBatch &out)
+    {
+        out.clear();
+        while (!out.full())
+        {
+            auto t = next();
+            if (!t)
+                break;
+            out.push_back(*t);
+        }
+        return out.size();
+    }
 } // namespace fin::io
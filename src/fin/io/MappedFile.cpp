@@ -0,0 +1,122 @@
+#include "fin/io/MappedFile.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fin::io
+{
+    MappedFile::MappedFile(const std::string &path)
+    {
+#if !defined(_WIN32)
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return;
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            return;
+        }
+
+        open_ = true;
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ > 0)
+        {
+            void *p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED)
+            {
+                open_ = false;
+                size_ = 0;
+            }
+            else
+            {
+                ::madvise(p, size_, MADV_SEQUENTIAL);
+                data_ = static_cast<const char *>(p);
+                mapped_ = true;
+            }
+        }
+        ::close(fd);
+#else
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in)
+            return;
+        open_ = true;
+        size_ = static_cast<std::size_t>(in.tellg());
+        if (size_ > 0)
+        {
+            char *buf = new char[size_];
+            in.seekg(0);
+            in.read(buf, static_cast<std::streamsize>(size_));
+            size_ = static_cast<std::size_t>(in.gcount());
+            data_ = buf;
+        }
+#endif
+    }
+
+    MappedFile::~MappedFile() { release(); }
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          open_(std::exchange(other.open_, false)),
+          mapped_(std::exchange(other.mapped_, false)) {}
+
+    MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            open_ = std::exchange(other.open_, false);
+            mapped_ = std::exchange(other.mapped_, false);
+        }
+        return *this;
+    }
+
+    void MappedFile::release_pages(std::size_t offset, std::size_t length) const noexcept
+    {
+#if !defined(_WIN32)
+        if (!mapped_ || offset >= size_)
+            return;
+        static const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const std::size_t end = std::min(offset + length, size_);
+        const std::size_t first = (offset + page - 1) / page * page;
+        const std::size_t last = end == size_ ? end : end / page * page;
+        if (first < last)
+            ::madvise(const_cast<char *>(data_) + first, last - first, MADV_DONTNEED);
+#else
+        (void)offset;
+        (void)length;
+#endif
+    }
+
+    void MappedFile::release() noexcept
+    {
+        if (data_)
+        {
+#if !defined(_WIN32)
+            if (mapped_)
+                ::munmap(const_cast<char *>(data_), size_);
+            else
+                delete[] data_;
+#else
+            delete[] data_;
+#endif
+        }
+        data_ = nullptr;
+        size_ = 0;
+        open_ = false;
+        mapped_ = false;
+    }
+
+} // namespace fin::io
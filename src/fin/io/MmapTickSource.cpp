@@ -0,0 +1,52 @@
+#include "fin/io/Sources.hpp"
+#include "fin/io/MappedFile.hpp"
+#include "fin/io/TickCsvParser.hpp"
+
+namespace fin::io
+{
+    namespace
+    {
+        // Parsed bytes are handed back to the kernel in steps of this size.
+        constexpr std::size_t kReleaseStride = 16u << 20;
+    }
+
+    struct MmapTickSource::Impl
+    {
+        MappedFile file;
+        TickCsvOptions opt;
+        TickCsvParser parser;
+        std::size_t released = 0; // bytes already dropped from RSS
+
+        Impl(const std::string &path, TickCsvOptions o, ScanKernel kernel)
+            : file(path), opt(std::move(o)), parser(file.data(), file.data() + file.size(), opt, kernel) {}
+
+        void release_consumed();
+    };
+
+    MmapTickSource::MmapTickSource(std::string path, TickCsvOptions opt, ScanKernel kernel)
+        : impl_(std::make_unique<Impl>(path, std::move(opt), kernel)) {}
+
+    MmapTickSource::~MmapTickSource() = default;
+
+    void MmapTickSource::Impl::release_consumed()
+    {
+        const auto done = static_cast<std::size_t>(parser.consumed() - file.data());
+        if (done >= released + kReleaseStride)
+        {
+            file.release_pages(released, done - released);
+            released = done;
+        }
+    }
+
+    std::optional<fin::core::Tick> MmapTickSource::next()
+    {
+        impl_->release_consumed();
+        return impl_->parser.next(stats_);
+    }
+
+    std::size_t MmapTickSource::next_batch(TickBatch &out)
+    {
+        impl_->release_consumed();
+        return impl_->parser.next_batch(out, stats_);
+    }
+} // namespace fin::io
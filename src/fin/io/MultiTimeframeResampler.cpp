@@ -0,0 +1,127 @@
+#include "fin/io/MultiTimeframeResampler.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace fin::io
+{
+    using fin::core::CandleSeries;
+    using fin::core::CandleSeriesView;
+    using fin::core::Timestamp;
+
+    namespace
+    {
+        std::vector<Timeframe> nested_timeframes(std::vector<Timeframe> tfs)
+        {
+            if (tfs.empty())
+                throw std::invalid_argument("MultiTimeframeResampler needs at least one timeframe");
+
+            std::sort(tfs.begin(), tfs.end()); // by duration
+            tfs.erase(std::unique(tfs.begin(), tfs.end()), tfs.end());
+
+            for (std::size_t k = 1; k < tfs.size(); ++k)
+                if (tfs[k].duration() % tfs[k - 1].duration() != std::chrono::nanoseconds::zero())
+                    throw std::invalid_argument("MultiTimeframeResampler: each timeframe must be a multiple of the next smaller one");
+            return tfs;
+        }
+    } // namespace
+
+    MultiTimeframeResampler::MultiTimeframeResampler(std::vector<Timeframe> timeframes, std::chrono::nanoseconds max_lateness)
+        : timeframes_(nested_timeframes(std::move(timeframes))),
+          series_(timeframes_.size()),
+          base_(timeframes_.front(), max_lateness),
+          levels_(timeframes_.size())
+    {
+        for (std::size_t k = 0; k < timeframes_.size(); ++k)
+            levels_[k].dur = timeframes_[k].duration();
+    }
+
+    std::size_t MultiTimeframeResampler::index_of(Timeframe tf) const
+    {
+        for (std::size_t k = 0; k < timeframes_.size(); ++k)
+            if (timeframes_[k] == tf)
+                return k;
+        throw std::out_of_range("MultiTimeframeResampler: timeframe not configured");
+    }
+
+    const CandleSeries &MultiTimeframeResampler::series(Timeframe tf) const
+    {
+        return series_[index_of(tf)];
+    }
+
+    CandleSeries MultiTimeframeResampler::take(Timeframe tf)
+    {
+        const std::size_t k = index_of(tf);
+        // cascade() runs after every update, so the level above has folded
+        // every bar being moved out.
+        if (k + 1 < levels_.size())
+            levels_[k + 1].fed = 0;
+        return std::exchange(series_[k], CandleSeries{});
+    }
+
+    void MultiTimeframeResampler::fold(Level &level, const CandleSeriesView &below, CandleSeries &out)
+    {
+        for (std::size_t i = level.fed; i < below.size(); ++i)
+        {
+            const Timestamp ts = below.ts[i];
+            if (level.has_open && ts < level.end)
+            {
+                if (below.high[i] > level.high)
+                    level.high = below.high[i];
+                if (below.low[i] < level.low)
+                    level.low = below.low[i];
+                level.close = below.close[i];
+                level.vol += below.volume[i];
+                continue;
+            }
+
+            if (level.has_open)
+                out.push_back(level.start, level.open, level.high, level.low, level.close, level.vol);
+            const auto ns = ts.time_since_epoch();
+            level.start = Timestamp(ns - (ns % level.dur));
+            level.end = level.start + level.dur;
+            level.open = below.open[i];
+            level.high = below.high[i];
+            level.low = below.low[i];
+            level.close = below.close[i];
+            level.vol = below.volume[i];
+            level.has_open = true;
+        }
+        level.fed = below.size();
+    }
+
+    void MultiTimeframeResampler::cascade()
+    {
+        for (std::size_t k = 1; k < levels_.size(); ++k)
+            fold(levels_[k], series_[k - 1].view(), series_[k]);
+    }
+
+    void MultiTimeframeResampler::update(const fin::core::Tick &t)
+    {
+        if (base_.update(t, series_[0]))
+            cascade();
+    }
+
+    void MultiTimeframeResampler::update_batch(const TickBatch &batch)
+    {
+        if (base_.update_batch(batch, series_[0]))
+            cascade();
+    }
+
+    void MultiTimeframeResampler::flush()
+    {
+        base_.flush(series_[0]);
+        for (std::size_t k = 1; k < levels_.size(); ++k)
+        {
+            Level &level = levels_[k];
+            fold(level, series_[k - 1].view(), series_[k]);
+            if (level.has_open)
+            {
+                series_[k].push_back(level.start, level.open, level.high, level.low, level.close, level.vol);
+                level.has_open = false;
+            }
+        }
+    }
+
+} // namespace fin::io
@@ -0,0 +1,211 @@
+#include "fin/io/ParallelIngest.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "fin/io/MappedFile.hpp"
+#include "fin/io/TickCsvParser.hpp"
+
+namespace fin::io
+{
+    namespace
+    {
+        constexpr std::size_t kMinChunkBytes = 64u << 10;
+
+        struct ByteRange
+        {
+            const char *begin;
+            const char *end;
+        };
+
+        // Splits [b, e) into ranges of roughly `target` bytes, each ending just
+        // after a '\n' (or at `e`), so every row lands in exactly one range.
+        std::vector<ByteRange> split_on_newlines(const char *b, const char *e, std::size_t target)
+        {
+            std::vector<ByteRange> out;
+            while (b < e)
+            {
+                const std::size_t avail = static_cast<std::size_t>(e - b);
+                const char *stop = e;
+                if (avail > target)
+                {
+                    const void *nl = std::memchr(b + target, '\n', avail - target);
+                    stop = nl ? static_cast<const char *>(nl) + 1 : e;
+                }
+                out.push_back({b, stop});
+                b = stop;
+            }
+            return out;
+        }
+
+        struct Chunk
+        {
+            std::vector<fin::core::Tick> ticks;
+            ReadStats stats{};
+            std::exception_ptr error;
+            bool ready = false;
+        };
+
+        void parse_range(const ByteRange &r, const TickCsvOptions &opt, const TickCsvLayout &layout, Chunk &out)
+        {
+            TickCsvParser parser(r.begin, r.end, opt, layout);
+            // ~26 bytes per row for ticks_sample-style files; a rough reserve.
+            out.ticks.reserve(static_cast<std::size_t>(r.end - r.begin) / 24);
+            while (auto t = parser.next(out.stats))
+                out.ticks.push_back(std::move(*t));
+        }
+
+        void add_stats(ReadStats &acc, const ReadStats &s)
+        {
+            acc.rows += s.rows;
+            acc.parsed += s.parsed;
+            acc.skipped += s.skipped;
+        }
+    } // namespace
+
+    ReadStats for_each_tick_chunk_parallel(const std::string &path,
+                                           const TickCsvOptions &opt,
+                                           const ParallelIngestOptions &popt,
+                                           const TickChunkSink &sink)
+    {
+        ReadStats total{};
+        MappedFile file(path);
+        if (!file.is_open() || file.size() == 0)
+            return total;
+
+        const char *b = file.data();
+        const char *e = b + file.size();
+
+        // Header is resolved once; every chunk then parses with the same layout.
+        TickCsvLayout layout = TickCsvLayout::positional();
+        if (opt.has_header)
+        {
+            const void *nl = std::memchr(b, '\n', file.size());
+            const char *stop = nl ? static_cast<const char *>(nl) : e;
+            layout = TickCsvLayout::from_header(std::string_view(b, static_cast<std::size_t>(stop - b)), opt);
+            total.rows += 1;
+            b = nl ? stop + 1 : e;
+        }
+
+        // Consumed ranges are dropped from RSS so long files stay bounded.
+        auto release = [&file](const ByteRange &r)
+        {
+            file.release_pages(static_cast<std::size_t>(r.begin - file.data()), static_cast<std::size_t>(r.end - r.begin));
+        };
+
+        std::size_t threads = popt.threads ? popt.threads : std::thread::hardware_concurrency();
+        threads = std::max<std::size_t>(threads, 1);
+
+        // Keep at least a few chunks per worker so uneven ranges still balance.
+        const std::size_t data_bytes = static_cast<std::size_t>(e - b);
+        std::size_t target = std::min(std::max(popt.chunk_bytes, kMinChunkBytes),
+                                      std::max(data_bytes / (threads * 4), kMinChunkBytes));
+        const auto ranges = split_on_newlines(b, e, target);
+        threads = std::min(threads, ranges.size());
+
+        if (threads <= 1)
+        {
+            for (const auto &r : ranges)
+            {
+                Chunk c;
+                parse_range(r, opt, layout, c);
+                add_stats(total, c.stats);
+                sink(c.ticks);
+                release(r);
+            }
+            return total;
+        }
+
+        const std::size_t window = popt.max_chunks_in_flight ? popt.max_chunks_in_flight : 2 * threads;
+        std::vector<Chunk> chunks(ranges.size());
+        std::mutex m;
+        std::condition_variable cv_ready, cv_space;
+        std::size_t next_chunk = 0, consumed = 0;
+        bool stop = false;
+
+        auto worker = [&]
+        {
+            for (;;)
+            {
+                std::size_t idx = 0;
+                {
+                    std::unique_lock lk(m);
+                    cv_space.wait(lk, [&]
+                                  { return stop || next_chunk >= ranges.size() || next_chunk < consumed + window; });
+                    if (stop || next_chunk >= ranges.size())
+                        return;
+                    idx = next_chunk++;
+                }
+
+                Chunk &c = chunks[idx];
+                try
+                {
+                    parse_range(ranges[idx], opt, layout, c);
+                }
+                catch (...)
+                {
+                    c.error = std::current_exception();
+                }
+
+                {
+                    std::lock_guard lk(m);
+                    c.ready = true;
+                }
+                cv_ready.notify_all();
+            }
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i)
+            pool.emplace_back(worker);
+
+        auto shutdown = [&]
+        {
+            {
+                std::lock_guard lk(m);
+                stop = true;
+            }
+            cv_space.notify_all();
+            for (auto &t : pool)
+                t.join();
+        };
+
+        try
+        {
+            for (std::size_t i = 0; i < chunks.size(); ++i)
+            {
+                Chunk c;
+                {
+                    std::unique_lock lk(m);
+                    cv_ready.wait(lk, [&]
+                                  { return chunks[i].ready; });
+                    c = std::move(chunks[i]);
+                    chunks[i] = Chunk{};
+                    consumed = i + 1;
+                }
+                cv_space.notify_all();
+
+                if (c.error)
+                    std::rethrow_exception(c.error);
+                add_stats(total, c.stats);
+                sink(c.ticks);
+                release(ranges[i]);
+            }
+        }
+        catch (...)
+        {
+            shutdown();
+            throw;
+        }
+
+        shutdown();
+        return total;
+    }
+
+} // namespace fin::io
@@ -0,0 +1,269 @@
+#include "fin/io/SymbolPipeline.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "fin/io/TickStore.hpp"
+
+namespace fin::io
+{
+    namespace
+    {
+        constexpr std::size_t kStoreBatchTicks = 64u << 10;
+
+        // Feeds `batch` callbacks from a CSV (optionally parsed in parallel)
+        // or a tick store, in file order.
+        template <class Batch>
+        ReadStats read_batches(const std::string &path, const TickCsvOptions &opt, std::size_t ingest_threads, Batch &&batch)
+        {
+            if (is_tick_store_file(path))
+            {
+                TickStoreSource src(path);
+                TickBatch block(kStoreBatchTicks);
+                std::vector<fin::core::Tick> buf;
+                buf.reserve(kStoreBatchTicks);
+                while (src.next_batch(block))
+                {
+                    buf.clear();
+                    for (std::size_t i = 0; i < block.size(); ++i)
+                        buf.push_back(block.tick(i));
+                    batch(buf);
+                }
+                return src.stats();
+            }
+
+            ParallelIngestOptions popt{};
+            popt.threads = ingest_threads;
+            return for_each_tick_chunk_parallel(path, opt, popt, batch);
+        }
+
+        // One partition worker: owns a demux resampler for the symbols whose
+        // id maps to it and consumes a bounded queue of tick batches.
+        struct Shard
+        {
+            Shard(Timeframe tf, const std::vector<fin::indicators::FeatureSpec> &features) : demux(tf, features) {}
+
+            std::mutex m;
+            std::condition_variable cv_data, cv_space;
+            std::deque<std::vector<fin::core::Tick>> queue;
+            bool closed = false;
+
+            SymbolDemuxResampler demux;
+            std::exception_ptr error;
+        };
+
+        void run_shard(Shard &s, std::atomic<bool> &failed)
+        {
+            for (;;)
+            {
+                std::vector<fin::core::Tick> batch;
+                {
+                    std::unique_lock lk(s.m);
+                    s.cv_data.wait(lk, [&]
+                                   { return s.closed || !s.queue.empty(); });
+                    if (s.queue.empty())
+                        return;
+                    batch = std::move(s.queue.front());
+                    s.queue.pop_front();
+                }
+                s.cv_space.notify_one();
+
+                try
+                {
+                    for (const auto &t : batch)
+                        s.demux.update(t);
+                }
+                catch (...)
+                {
+                    std::lock_guard lk(s.m);
+                    s.error = std::current_exception();
+                    s.queue.clear();
+                    s.closed = true;
+                    failed = true;
+                    s.cv_space.notify_all();
+                    return;
+                }
+            }
+        }
+
+        void append_series(MultiSymbolResult &out, std::vector<SymbolSeries> &&series)
+        {
+            for (auto &s : series)
+                out.symbols.push_back(std::move(s));
+        }
+    } // namespace
+
+    const SymbolSeries *MultiSymbolResult::find(fin::core::Symbol sym) const
+    {
+        const auto &name = sym.value();
+        auto it = std::lower_bound(symbols.begin(), symbols.end(), name, [](const SymbolSeries &s, const std::string &n)
+                                   { return s.symbol.value() < n; });
+        return it != symbols.end() && it->symbol == sym ? &*it : nullptr;
+    }
+
+    SymbolDemuxResampler::Partition::Partition(Timeframe tf, const std::vector<fin::indicators::FeatureSpec> &specs)
+        : resampler(tf)
+    {
+        if (!specs.empty())
+        {
+            bus.emplace(specs);
+            features.emplace(bus->schema());
+            row.resize(bus->width());
+        }
+    }
+
+    SymbolDemuxResampler::SymbolDemuxResampler(Timeframe tf, std::vector<fin::indicators::FeatureSpec> features)
+        : tf_(tf), features_(std::move(features))
+    {
+        if (features_.empty())
+            return;
+        if (auto error = fin::indicators::feature_spec_error(features_))
+            throw std::invalid_argument("SymbolDemuxResampler: " + *error);
+    }
+
+    // Runs the bars closed since the last call through the symbol's bus,
+    // reusing the partition's row so a closed bar does not allocate.
+    void SymbolDemuxResampler::feed(Partition &p)
+    {
+        const auto bars = p.candles.view();
+        for (std::size_t i = p.fed; i < bars.size(); ++i)
+            if (p.bus->update(fin::indicators::FeatureInput::from(bars, i), p.row))
+                p.features->append(bars.ts[i], p.row);
+        p.fed = bars.size();
+    }
+
+    void SymbolDemuxResampler::update(const fin::core::Tick &t)
+    {
+        Partition &p = parts_.try_emplace(t.symbol(), tf_, features_);
+        ++p.ticks;
+        if (p.resampler.update(t, p.candles) && p.bus)
+            feed(p);
+    }
+
+    void SymbolDemuxResampler::flush()
+    {
+        for (auto &[sym, p] : parts_)
+            if (p.resampler.flush(p.candles) && p.bus)
+                feed(p);
+    }
+
+    std::vector<SymbolSeries> SymbolDemuxResampler::take()
+    {
+        std::vector<SymbolSeries> out;
+        out.reserve(parts_.size());
+        for (auto &[sym, p] : parts_)
+            out.push_back(SymbolSeries{sym, std::move(p.candles), p.ticks, std::move(p.features)});
+        parts_.clear();
+        return out;
+    }
+
+    MultiSymbolResult resample_by_symbol(const std::string &path,
+                                         Timeframe tf,
+                                         const TickCsvOptions &opt,
+                                         const SymbolPipelineOptions &sopt)
+    {
+        MultiSymbolResult result{};
+
+        std::size_t shards = sopt.partition_threads ? sopt.partition_threads : std::thread::hardware_concurrency();
+        shards = std::max<std::size_t>(shards, 1);
+
+        if (shards == 1)
+        {
+            SymbolDemuxResampler demux(tf, sopt.features);
+            result.stats = read_batches(path, opt, sopt.ingest_threads, [&](const std::vector<fin::core::Tick> &ticks)
+                                        {
+                                            for (const auto &t : ticks)
+                                                demux.update(t); });
+            demux.flush();
+            append_series(result, demux.take());
+        }
+        else
+        {
+            const std::size_t max_queued = std::max<std::size_t>(sopt.max_batches_queued, 1);
+            std::vector<std::unique_ptr<Shard>> shard_state;
+            shard_state.reserve(shards);
+            for (std::size_t i = 0; i < shards; ++i)
+                shard_state.push_back(std::make_unique<Shard>(tf, sopt.features));
+
+            std::atomic<bool> failed{false};
+            std::vector<std::thread> pool;
+            pool.reserve(shards);
+            for (auto &s : shard_state)
+                pool.emplace_back(run_shard, std::ref(*s), std::ref(failed));
+
+            auto close_and_join = [&]
+            {
+                for (auto &s : shard_state)
+                {
+                    {
+                        std::lock_guard lk(s->m);
+                        s->closed = true;
+                    }
+                    s->cv_data.notify_all();
+                }
+                for (auto &t : pool)
+                    if (t.joinable())
+                        t.join();
+            };
+
+            std::vector<std::vector<fin::core::Tick>> split(shards);
+            auto dispatch = [&](const std::vector<fin::core::Tick> &ticks)
+            {
+                for (const auto &t : ticks)
+                    split[t.symbol().id() % shards].push_back(t);
+
+                for (std::size_t i = 0; i < shards; ++i)
+                {
+                    if (split[i].empty())
+                        continue;
+                    Shard &s = *shard_state[i];
+                    {
+                        std::unique_lock lk(s.m);
+                        s.cv_space.wait(lk, [&]
+                                        { return s.closed || s.queue.size() < max_queued; });
+                        if (!s.closed)
+                            s.queue.push_back(std::move(split[i]));
+                    }
+                    s.cv_data.notify_one();
+                    split[i] = {};
+                }
+                if (failed)
+                    throw std::runtime_error("symbol partition worker failed");
+            };
+
+            try
+            {
+                result.stats = read_batches(path, opt, sopt.ingest_threads, dispatch);
+            }
+            catch (...)
+            {
+                close_and_join();
+                for (auto &s : shard_state)
+                    if (s->error)
+                        std::rethrow_exception(s->error);
+                throw;
+            }
+            close_and_join();
+
+            for (auto &s : shard_state)
+            {
+                if (s->error)
+                    std::rethrow_exception(s->error);
+                s->demux.flush();
+                append_series(result, s->demux.take());
+            }
+        }
+
+        std::sort(result.symbols.begin(), result.symbols.end(), [](const SymbolSeries &a, const SymbolSeries &b)
+                  { return a.symbol.value() < b.symbol.value(); });
+        return result;
+    }
+
+} // namespace fin::io
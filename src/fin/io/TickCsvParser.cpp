@@ -0,0 +1,261 @@
+#include "fin/io/TickCsvParser.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <string>
+
+namespace fin::io
+{
+    using core::Price;
+    using core::Symbol;
+    using core::Tick;
+    using core::Timestamp;
+    using core::Volume;
+
+    namespace
+    {
+        // Bytes indexed per scanner call; a block always ends on a row boundary
+        // (or grows to hold a single row longer than this).
+        constexpr std::size_t kBlockBytes = 1u << 16;
+
+        std::string_view trim(std::string_view sv)
+        {
+            while (!sv.empty() && std::isspace(static_cast<unsigned char>(sv.front())))
+                sv.remove_prefix(1);
+            while (!sv.empty() && std::isspace(static_cast<unsigned char>(sv.back())))
+                sv.remove_suffix(1);
+            return sv;
+        }
+
+        Timestamp from_epoch_ms(long long ms)
+        {
+            using namespace std::chrono;
+            return Timestamp(time_point<system_clock, nanoseconds>(nanoseconds{ms * 1'000'000LL}));
+        }
+    } // namespace
+
+    int TickCsvLayout::max_index() const noexcept
+    {
+        return std::max({ts, sym, price, vol});
+    }
+
+    TickCsvLayout TickCsvLayout::from_header(std::string_view line, const TickCsvOptions &opt)
+    {
+        TickCsvLayout l{};
+        int i = 0;
+        std::size_t pos = 0;
+        while (pos < line.size())
+        {
+            const std::size_t d = line.find(opt.delimiter, pos);
+            const std::size_t stop = (d == std::string_view::npos) ? line.size() : d;
+            const std::string_view f = line.substr(pos, stop - pos);
+            if (l.ts < 0 && f == opt.ts_col) l.ts = i;
+            if (l.sym < 0 && f == opt.symbol_col) l.sym = i;
+            if (l.price < 0 && f == opt.price_col) l.price = i;
+            if (l.vol < 0 && f == opt.volume_col) l.vol = i;
+            if (d == std::string_view::npos)
+                break;
+            pos = d + 1;
+            ++i;
+        }
+        return l;
+    }
+
+    // One physical line plus the offsets of the delimiters inside it. Offsets
+    // are relative to the owning block, like `begin` / `end`.
+    struct TickCsvParser::Row
+    {
+        const char *block = nullptr;
+        std::uint32_t begin = 0, end = 0; // line bytes, '\n' excluded
+        const std::uint32_t *delims = nullptr;
+        std::size_t ndelims = 0;
+
+        // Same shape as FileTickSource's getline-based split: an empty line has
+        // no fields and a trailing delimiter does not open an extra empty field.
+        std::size_t field_count() const noexcept
+        {
+            if (begin == end)
+                return 0;
+            if (ndelims > 0 && delims[ndelims - 1] + 1 == end)
+                return ndelims;
+            return ndelims + 1;
+        }
+
+        std::string_view field(int i) const noexcept
+        {
+            const auto k = static_cast<std::size_t>(i);
+            const std::uint32_t b = (k == 0) ? begin : delims[k - 1] + 1;
+            const std::uint32_t e = (k < ndelims) ? delims[k] : end;
+            return std::string_view(block + b, e - b);
+        }
+    };
+
+    TickCsvParser::TickCsvParser(const char *begin, const char *end, const TickCsvOptions &opt, ScanKernel kernel)
+        : TickCsvParser(begin, end, opt, TickCsvLayout::positional(), kernel)
+    {
+        if (opt.has_header && cur_ < end_)
+        {
+            const void *nl = std::memchr(cur_, '\n', static_cast<std::size_t>(end_ - cur_));
+            const char *stop = nl ? static_cast<const char *>(nl) : end_;
+            layout_ = TickCsvLayout::from_header(std::string_view(cur_, static_cast<std::size_t>(stop - cur_)), opt);
+            max_idx_ = layout_.max_index();
+            header_rows_ = 1;
+            cur_ = nl ? stop + 1 : end_;
+        }
+    }
+
+    TickCsvParser::TickCsvParser(const char *begin, const char *end, const TickCsvOptions &opt,
+                                 TickCsvLayout layout, ScanKernel kernel)
+        : cur_(begin), end_(end), delim_(opt.delimiter), scan_(scan_function(kernel)),
+          layout_(layout), max_idx_(layout.max_index()) {}
+
+    bool TickCsvParser::load_block()
+    {
+        if (cur_ >= end_)
+            return false;
+        const std::size_t avail = static_cast<std::size_t>(end_ - cur_);
+        std::size_t len = std::min(avail, kBlockBytes);
+        if (len < avail)
+        {
+            // Cut after the last newline in range, or extend to the next one.
+            std::size_t cut = len;
+            while (cut > 0 && cur_[cut - 1] != '\n')
+                --cut;
+            if (cut == 0)
+            {
+                const void *nl = std::memchr(cur_ + len, '\n', avail - len);
+                cut = nl ? static_cast<std::size_t>(static_cast<const char *>(nl) - cur_) + 1 : avail;
+            }
+            len = cut;
+        }
+
+        if (seps_.size() < len)
+            seps_.resize(len);
+        block_ = cur_;
+        block_size_ = len;
+        nseps_ = scan_(block_, len, delim_, seps_.data());
+        sep_i_ = 0;
+        row_ = 0;
+        cur_ += len;
+        return true;
+    }
+
+    // Next physical line (a trailing '\r' is kept, as std::getline would).
+    bool TickCsvParser::next_row(Row &r)
+    {
+        if (row_ >= block_size_ && !load_block())
+            return false;
+
+        const std::size_t first = sep_i_;
+        while (sep_i_ < nseps_ && block_[seps_[sep_i_]] != '\n')
+            ++sep_i_;
+
+        r.block = block_;
+        r.begin = row_;
+        r.delims = seps_.data() + first;
+        r.ndelims = sep_i_ - first;
+        if (sep_i_ < nseps_)
+        {
+            r.end = seps_[sep_i_++];
+            row_ = r.end + 1;
+        }
+        else
+        {
+            r.end = static_cast<std::uint32_t>(block_size_);
+            row_ = r.end;
+        }
+        return true;
+    }
+
+    Symbol TickCsvParser::intern_symbol(std::string_view name)
+    {
+        if (name != last_sym_name_)
+        {
+            last_sym_ = Symbol{name};
+            last_sym_name_.assign(name);
+        }
+        return last_sym_;
+    }
+
+    bool TickCsvParser::parse_next(ReadStats &stats, Timestamp &ts, Symbol &sym, double &price, double &vol)
+    {
+        stats.rows += header_rows_;
+        header_rows_ = 0;
+
+        Row r;
+        while (next_row(r))
+        {
+            ++stats.rows;
+
+            // A header without one of the required columns makes every row unusable.
+            if (!layout_.complete() || max_idx_ >= static_cast<int>(r.field_count()))
+            {
+                ++stats.skipped;
+                continue;
+            }
+
+            // Timestamp: epoch millis, trimmed, non-negative
+            long long ms = 0;
+            {
+                const auto t = trim(r.field(layout_.ts));
+                if (t.empty())
+                {
+                    ++stats.skipped;
+                    continue;
+                }
+                if (auto [p, ec] = std::from_chars(t.data(), t.data() + t.size(), ms); ec != std::errc{} || ms < 0)
+                {
+                    ++stats.skipped;
+                    continue;
+                }
+            }
+
+            double price_d = 0.0, vol_d = 0.0;
+            const auto f_price = r.field(layout_.price);
+            if (auto [p, ec] = std::from_chars(f_price.data(), f_price.data() + f_price.size(), price_d); ec != std::errc{})
+            {
+                ++stats.skipped;
+                continue;
+            }
+            const auto f_vol = r.field(layout_.vol);
+            if (auto [p, ec] = std::from_chars(f_vol.data(), f_vol.data() + f_vol.size(), vol_d); ec != std::errc{})
+            {
+                ++stats.skipped;
+                continue;
+            }
+            ++stats.parsed;
+
+            ts = from_epoch_ms(ms);
+            sym = intern_symbol(r.field(layout_.sym));
+            price = price_d;
+            vol = vol_d;
+            return true;
+        }
+        return false; // end of range
+    }
+
+    std::optional<Tick> TickCsvParser::next(ReadStats &stats)
+    {
+        Timestamp ts;
+        Symbol sym;
+        double price = 0.0, vol = 0.0;
+        if (!parse_next(stats, ts, sym, price, vol))
+            return std::nullopt;
+        return Tick{ts, sym, Price{price}, Volume{vol}};
+    }
+
+    std::size_t TickCsvParser::next_batch(TickBatch &out, ReadStats &stats)
+    {
+        out.clear();
+        Timestamp ts;
+        Symbol sym;
+        double price = 0.0, vol = 0.0;
+        while (!out.full() && parse_next(stats, ts, sym, price, vol))
+            out.push_back(ts, sym, price, vol);
+        return out.size();
+    }
+
+} // namespace fin::io
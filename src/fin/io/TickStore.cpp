@@ -0,0 +1,349 @@
+#include "fin/io/TickStore.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <stdexcept>
+
+#include "fin/io/MappedFile.hpp"
+
+namespace fin::io
+{
+    // Header fields and block columns are memcpy'd / mapped in host order,
+    // so the documented little-endian layout only holds on such hosts.
+    static_assert(std::endian::native == std::endian::little, "tick store files are little-endian; big-endian hosts need byte swapping");
+
+    namespace
+    {
+        constexpr std::size_t kHeaderBytes = 40;
+
+        struct StoreHeader
+        {
+            std::uint32_t version = kTickStoreVersion;
+            std::uint32_t block_rows = 0;
+            std::uint64_t count = 0;
+            std::uint64_t dict_offset = 0;
+            std::uint32_t symbols = 0;
+        };
+
+        template <class T>
+        void put(char *&p, T v)
+        {
+            std::memcpy(p, &v, sizeof(T));
+            p += sizeof(T);
+        }
+
+        template <class T>
+        T get(const char *p)
+        {
+            T v;
+            std::memcpy(&v, p, sizeof(T));
+            return v;
+        }
+
+        // Bytes of one block holding n ticks (symbol ids padded to 8 bytes).
+        std::uint64_t block_bytes(std::uint64_t n)
+        {
+            return n * (sizeof(std::int64_t) + 2 * sizeof(double)) + ((n * sizeof(std::uint32_t) + 7) & ~std::uint64_t{7});
+        }
+
+        std::uint64_t data_bytes(std::uint64_t count, std::uint32_t block_rows)
+        {
+            const std::uint64_t full = count / block_rows;
+            return full * block_bytes(block_rows) + block_bytes(count % block_rows);
+        }
+
+        StoreHeader decode_header(const MappedFile &file, const std::string &path)
+        {
+            if (file.size() < kHeaderBytes || std::memcmp(file.data(), kTickStoreMagic, sizeof(kTickStoreMagic)) != 0)
+                throw std::runtime_error("Not a tick store file: " + path);
+
+            const char *p = file.data() + sizeof(kTickStoreMagic);
+            StoreHeader h;
+            h.version = get<std::uint32_t>(p);
+            h.block_rows = get<std::uint32_t>(p + 4);
+            h.count = get<std::uint64_t>(p + 8);
+            h.dict_offset = get<std::uint64_t>(p + 16);
+            h.symbols = get<std::uint32_t>(p + 24);
+
+            if (h.version != kTickStoreVersion)
+                throw std::runtime_error("Unsupported tick store version " + std::to_string(h.version) + ": " + path);
+            if (h.block_rows == 0 || h.dict_offset != kHeaderBytes + data_bytes(h.count, h.block_rows) ||
+                h.dict_offset > file.size())
+                throw std::runtime_error("Corrupt tick store header: " + path);
+            return h;
+        }
+    } // namespace
+
+    bool is_tick_store_file(const std::string &path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        char magic[sizeof(kTickStoreMagic)] = {};
+        if (!in.read(magic, sizeof(magic)))
+            return false;
+        return std::memcmp(magic, kTickStoreMagic, sizeof(magic)) == 0;
+    }
+
+    // ---------------------------------------------------------------- writer
+
+    TickStoreWriter::TickStoreWriter(const std::string &path, std::uint32_t block_rows)
+        : path_(path), out_(path, std::ios::binary | std::ios::trunc), block_rows_(std::max<std::uint32_t>(block_rows, 1)),
+          uncaught_(std::uncaught_exceptions())
+    {
+        if (!out_)
+            throw std::runtime_error("Failed to create tick store: " + path);
+        ts_.reserve(block_rows_);
+        price_.reserve(block_rows_);
+        volume_.reserve(block_rows_);
+        sym_.reserve(block_rows_);
+        write_header(); // placeholder, patched by finish()
+    }
+
+    TickStoreWriter::~TickStoreWriter()
+    {
+        if (std::uncaught_exceptions() > uncaught_)
+        {
+            abort();
+            return;
+        }
+        try
+        {
+            finish();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    void TickStoreWriter::abort() noexcept
+    {
+        if (finished_)
+            return;
+        finished_ = true;
+        out_.close();
+        std::error_code ec;
+        std::filesystem::remove(path_, ec);
+    }
+
+    void TickStoreWriter::append(const fin::core::Tick &t)
+    {
+        const auto sym = t.symbol();
+        auto it = ids_.find(sym);
+        if (it == ids_.end())
+        {
+            it = ids_.emplace(sym, static_cast<std::uint32_t>(names_.size())).first;
+            names_.push_back(sym);
+        }
+
+        ts_.push_back(t.timestamp().time_since_epoch().count());
+        price_.push_back(t.price().value());
+        volume_.push_back(t.volume().value());
+        sym_.push_back(it->second);
+        ++count_;
+
+        if (ts_.size() == block_rows_)
+            flush_block();
+    }
+
+    void TickStoreWriter::flush_block()
+    {
+        if (ts_.empty())
+            return;
+        const std::size_t n = ts_.size();
+        out_.write(reinterpret_cast<const char *>(ts_.data()), static_cast<std::streamsize>(n * sizeof(std::int64_t)));
+        out_.write(reinterpret_cast<const char *>(price_.data()), static_cast<std::streamsize>(n * sizeof(double)));
+        out_.write(reinterpret_cast<const char *>(volume_.data()), static_cast<std::streamsize>(n * sizeof(double)));
+        out_.write(reinterpret_cast<const char *>(sym_.data()), static_cast<std::streamsize>(n * sizeof(std::uint32_t)));
+        if (n % 2)
+        {
+            const std::uint32_t pad = 0;
+            out_.write(reinterpret_cast<const char *>(&pad), sizeof(pad));
+        }
+        ts_.clear();
+        price_.clear();
+        volume_.clear();
+        sym_.clear();
+    }
+
+    void TickStoreWriter::write_header()
+    {
+        char buf[kHeaderBytes] = {};
+        char *p = buf;
+        std::memcpy(p, kTickStoreMagic, sizeof(kTickStoreMagic));
+        p += sizeof(kTickStoreMagic);
+        put<std::uint32_t>(p, kTickStoreVersion);
+        put<std::uint32_t>(p, block_rows_);
+        put<std::uint64_t>(p, count_);
+        put<std::uint64_t>(p, kHeaderBytes + data_bytes(count_, block_rows_));
+        put<std::uint32_t>(p, static_cast<std::uint32_t>(names_.size()));
+        out_.write(buf, sizeof(buf));
+    }
+
+    void TickStoreWriter::finish()
+    {
+        if (finished_)
+            return;
+        finished_ = true;
+
+        flush_block();
+        for (const auto &sym : names_)
+        {
+            const std::string &name = sym.value();
+            const auto len = static_cast<std::uint32_t>(name.size());
+            out_.write(reinterpret_cast<const char *>(&len), sizeof(len));
+            out_.write(name.data(), static_cast<std::streamsize>(name.size()));
+        }
+        out_.seekp(0);
+        write_header();
+        out_.close();
+        if (out_.fail())
+        {
+            std::error_code ec;
+            std::filesystem::remove(path_, ec);
+            throw std::runtime_error("Failed to write tick store: " + path_);
+        }
+    }
+
+    // ---------------------------------------------------------------- reader
+
+    struct TickStoreSource::Impl
+    {
+        MappedFile file;
+        StoreHeader header{};
+        std::vector<fin::core::Symbol> symbols;
+
+        std::uint64_t pos = 0; // next tick index
+        std::uint64_t block_end = 0;
+        const char *ts = nullptr, *price = nullptr, *volume = nullptr, *sym = nullptr;
+        std::uint64_t block_begin = 0;
+
+        explicit Impl(const std::string &path) : file(path)
+        {
+            if (!file.is_open())
+                return;
+            header = decode_header(file, path);
+
+            const char *p = file.data() + header.dict_offset;
+            const char *e = file.data() + file.size();
+            symbols.reserve(header.symbols);
+            for (std::uint32_t i = 0; i < header.symbols; ++i)
+            {
+                if (e - p < 4)
+                    throw std::runtime_error("Truncated tick store dictionary: " + path);
+                const auto len = get<std::uint32_t>(p);
+                p += 4;
+                if (static_cast<std::uint64_t>(e - p) < len)
+                    throw std::runtime_error("Truncated tick store dictionary: " + path);
+                symbols.emplace_back(std::string_view(p, len));
+                p += len;
+            }
+        }
+
+        void load_block()
+        {
+            // Blocks are read once, front to back: drop the finished one.
+            if (ts)
+                file.release_pages(static_cast<std::size_t>(ts - file.data()), static_cast<std::size_t>(block_bytes(header.block_rows)));
+
+            const std::uint64_t bi = pos / header.block_rows;
+            block_begin = bi * header.block_rows;
+            const std::uint64_t n = std::min<std::uint64_t>(header.block_rows, header.count - block_begin);
+            block_end = block_begin + n;
+
+            const char *b = file.data() + kHeaderBytes + bi * block_bytes(header.block_rows);
+            ts = b;
+            price = ts + n * sizeof(std::int64_t);
+            volume = price + n * sizeof(double);
+            sym = volume + n * sizeof(double);
+        }
+    };
+
+    TickStoreSource::TickStoreSource(std::string path)
+        : impl_(std::make_unique<Impl>(path)) {}
+
+    TickStoreSource::~TickStoreSource() = default;
+
+    std::uint64_t TickStoreSource::size() const noexcept { return impl_->header.count; }
+
+    std::optional<fin::core::Tick> TickStoreSource::next()
+    {
+        auto &s = *impl_;
+        if (s.pos >= s.header.count)
+            return std::nullopt;
+        if (s.pos >= s.block_end)
+            s.load_block();
+
+        const std::uint64_t i = s.pos - s.block_begin;
+        const auto id = get<std::uint32_t>(s.sym + i * sizeof(std::uint32_t));
+        if (id >= s.symbols.size())
+            throw std::runtime_error("Tick store symbol id out of range");
+
+        ++s.pos;
+        ++stats_.rows;
+        ++stats_.parsed;
+        return fin::core::Tick(fin::core::Timestamp(std::chrono::nanoseconds(get<std::int64_t>(s.ts + i * sizeof(std::int64_t)))),
+                               s.symbols[id],
+                               fin::core::Price(get<double>(s.price + i * sizeof(double))),
+                               fin::core::Volume(get<double>(s.volume + i * sizeof(double))));
+    }
+
+    std::size_t TickStoreSource::next_batch(TickBatch &out)
+    {
+        auto &s = *impl_;
+        out.clear();
+        while (!out.full() && s.pos < s.header.count)
+        {
+            if (s.pos >= s.block_end)
+                s.load_block();
+
+            const std::uint64_t first = s.pos - s.block_begin;
+            const std::uint64_t n = std::min<std::uint64_t>(s.block_end - s.pos, out.capacity() - out.size());
+            for (std::uint64_t i = first; i < first + n; ++i)
+            {
+                const auto id = get<std::uint32_t>(s.sym + i * sizeof(std::uint32_t));
+                if (id >= s.symbols.size())
+                    throw std::runtime_error("Tick store symbol id out of range");
+                out.push_back(fin::core::Timestamp(std::chrono::nanoseconds(get<std::int64_t>(s.ts + i * sizeof(std::int64_t)))),
+                              s.symbols[id],
+                              get<double>(s.price + i * sizeof(double)),
+                              get<double>(s.volume + i * sizeof(double)));
+            }
+            s.pos += n;
+        }
+        stats_.rows += out.size();
+        stats_.parsed += out.size();
+        return out.size();
+    }
+
+    // ------------------------------------------------------------- converter
+
+    ReadStats convert_csv_to_tick_store(const std::string &csv_path,
+                                        const std::string &store_path,
+                                        const TickCsvOptions &opt,
+                                        const ParallelIngestOptions &popt)
+    {
+        // Checked before the writer truncates `store_path`: a missing CSV would
+        // otherwise read as zero rows and produce a valid empty store.
+        if (!MappedFile(csv_path).is_open())
+            throw std::runtime_error("Failed to open tick CSV: " + csv_path);
+
+        TickStoreWriter writer(store_path);
+        try
+        {
+            auto stats = for_each_tick_chunk_parallel(csv_path, opt, popt, [&](const std::vector<fin::core::Tick> &ticks)
+                                                      {
+                                                          for (const auto &t : ticks)
+                                                              writer.append(t); });
+            writer.finish();
+            return stats;
+        }
+        catch (...)
+        {
+            writer.abort();
+            throw;
+        }
+    }
+
+} // namespace fin::io
@@ -0,0 +1,107 @@
+#include "fin/io/Timeframe.hpp"
+
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+
+namespace fin::io
+{
+    using namespace std::chrono;
+
+    namespace
+    {
+        constexpr nanoseconds kMaxWidth = hours(24 * 366);
+
+        std::string lowered(std::string_view s)
+        {
+            while (!s.empty() && std::isspace(static_cast<unsigned char>(s.front())))
+                s.remove_prefix(1);
+            while (!s.empty() && std::isspace(static_cast<unsigned char>(s.back())))
+                s.remove_suffix(1);
+            std::string out(s);
+            for (auto &c : out)
+                c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            return out;
+        }
+
+        std::optional<nanoseconds> unit_of(std::string_view unit)
+        {
+            if (unit == "ns")
+                return nanoseconds(1);
+            if (unit == "us")
+                return microseconds(1);
+            if (unit == "ms")
+                return milliseconds(1);
+            if (unit == "s")
+                return seconds(1);
+            if (unit == "m")
+                return minutes(1);
+            if (unit == "h")
+                return hours(1);
+            if (unit == "d")
+                return hours(24);
+            return std::nullopt;
+        }
+
+        std::optional<std::int64_t> count_of(std::string_view digits)
+        {
+            std::int64_t n = 0;
+            const auto [p, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), n);
+            if (digits.empty() || ec != std::errc{} || p != digits.data() + digits.size() || n <= 0)
+                return std::nullopt;
+            return n;
+        }
+    } // namespace
+
+    std::optional<Timeframe> parse_timeframe(std::string_view token)
+    {
+        const std::string t = lowered(token);
+        if (t.empty())
+            return std::nullopt;
+
+        std::optional<nanoseconds> unit;
+        std::optional<std::int64_t> count;
+        if (std::isalpha(static_cast<unsigned char>(t.front())))
+        {
+            // S15, M1, H4, D1
+            unit = unit_of(std::string_view(t).substr(0, 1));
+            count = count_of(std::string_view(t).substr(1));
+        }
+        else
+        {
+            // 250ms, 15s, 4h, 1d
+            const std::size_t split = t.find_first_not_of("0123456789");
+            if (split == std::string::npos)
+                return std::nullopt;
+            count = count_of(std::string_view(t).substr(0, split));
+            unit = unit_of(std::string_view(t).substr(split));
+        }
+        if (!unit || !count || *count > kMaxWidth / *unit)
+            return std::nullopt;
+        return Timeframe(*count * *unit);
+    }
+
+    std::string to_string(Timeframe tf)
+    {
+        const nanoseconds w = tf.duration();
+        struct Unit
+        {
+            nanoseconds width;
+            const char *prefix;
+            const char *suffix;
+        };
+        static constexpr Unit units[] = {
+            {hours(24), "D", ""},
+            {hours(1), "H", ""},
+            {minutes(1), "M", ""},
+            {seconds(1), "S", ""},
+            {milliseconds(1), "", "ms"},
+            {microseconds(1), "", "us"},
+        };
+        for (const auto &u : units)
+            if (w >= u.width && w % u.width == nanoseconds::zero())
+                return u.prefix + std::to_string(w / u.width) + u.suffix;
+        return std::to_string(w.count()) + "ns";
+    }
+
+} // namespace fin::io
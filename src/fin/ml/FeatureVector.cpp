@@ -1,20 +1,19 @@
 #include "fin/ml/FeatureVector.hpp"
-#include "fin/indicators/FeatureBus.hpp"
-#include <algorithm>
 
 namespace fin::ml
 {
+    const std::vector<std::string> &FeatureVector::names() const noexcept
+    {
+        static const std::vector<std::string> none;
+        return schema ? schema->names() : none;
+    }
+
     std::optional<double> FeatureVector::value_of(std::string_view name) const
     {
-        if (names.empty())
+        if (!schema)
             return std::nullopt;
-        for (std::size_t i = 0; i < names.size(); ++i)
-        {
-            if (names[i] == name)
-            {
-                return values[i];
-            }
-        }
+        if (auto idx = schema->index_of(name); idx && *idx < values.size())
+            return values[*idx];
         return std::nullopt;
     }
 
@@ -22,8 +21,19 @@ namespace fin::ml
     {
         FeatureVector fv;
         fv.ts = row.ts;
-        fv.names = {"close", "ema_fast", "rsi", "macd", "macd_signal", "macd_hist"};
-        fv.values = {row.close, row.ema_fast, row.rsi, row.macd, row.macd_signal, row.macd_hist};
+        fv.schema = fin::indicators::FeatureBus::schema();
+        const FeatureRowValues values = feature_row_values(row);
+        fv.values.assign(values.begin(), values.end());
         return fv;
     }
+
+    FeatureVector::FeatureRowValues FeatureVector::feature_row_values(const fin::indicators::FeatureRow &row) noexcept
+    {
+        return fin::indicators::FeatureBus::row_values(row);
+    }
+
+    const std::vector<std::string> &FeatureVector::feature_row_names()
+    {
+        return fin::indicators::FeatureBus::schema()->names();
+    }
 }
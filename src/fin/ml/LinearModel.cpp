@@ -43,6 +43,10 @@ namespace fin::ml
         weights_.clear();
         named_weights_.clear();
         ready_ = false;
+        online_.reset();
+        bound_ = false;
+        bound_names_.clear();
+        dense_weights_.clear();
     }
 
     bool LinearModel::is_ready() const
@@ -79,12 +83,165 @@ namespace fin::ml
         return acc;
     }
 
+    void LinearModel::bind(std::span<const std::string> names)
+    {
+        if (named_weights_.empty() && !weights_.empty() && weights_.size() != names.size())
+            throw std::invalid_argument("LinearModel::bind() positional weights do not match the schema width");
+        bound_names_.assign(names.begin(), names.end());
+        bound_ = true;
+        rebind();
+    }
+
+    void LinearModel::rebind()
+    {
+        if (!bound_)
+            return;
+        const std::size_t d = bound_names_.size();
+        dense_weights_.assign(d, 0.0);
+        if (named_weights_.empty())
+        {
+            if (weights_.empty())
+                return;
+            if (weights_.size() != d)
+                throw std::invalid_argument("LinearModel::bind() positional weights do not match the schema width");
+            dense_weights_ = weights_;
+            return;
+        }
+        for (const auto &[name, weight] : named_weights_)
+        {
+            for (std::size_t k = 0; k < d; ++k)
+            {
+                if (bound_names_[k] == name)
+                {
+                    dense_weights_[k] = weight;
+                    break;
+                }
+            }
+        }
+    }
+
+    void LinearModel::check_bound(const char *caller) const
+    {
+        if (!ready_)
+            throw std::logic_error(std::string(caller) + " called before loading weights");
+        if (!bound_)
+            throw std::logic_error(std::string(caller) + " called before bind()");
+    }
+
+    double LinearModel::predict_row(std::span<const double> row) const
+    {
+        check_bound("LinearModel::predict_row()");
+        const std::size_t d = dense_weights_.size();
+        if (row.size() != d)
+            throw std::invalid_argument("LinearModel::predict_row() feature dimension mismatch");
+
+        const double *w = dense_weights_.data();
+        double acc = bias_;
+        for (std::size_t k = 0; k < d; ++k)
+            acc += w[k] * row[k];
+        return acc;
+    }
+
+    void LinearModel::predict_batch(std::span<const double> rows, std::span<double> out) const
+    {
+        check_bound("LinearModel::predict_batch()");
+        const std::size_t d = dense_weights_.size();
+        if (rows.size() != out.size() * d)
+            throw std::invalid_argument("LinearModel::predict_batch() needs out.size() * features values");
+
+        // Plain pointers and a fixed stride keep the inner loop free of
+        // aliasing and bounds questions so the compiler can unroll it.
+        const double *w = dense_weights_.data();
+        const double *x = rows.data();
+        double *y = out.data();
+        const double bias = bias_;
+        for (std::size_t i = 0, n = out.size(); i < n; ++i, x += d)
+        {
+            double acc = bias;
+            for (std::size_t k = 0; k < d; ++k)
+                acc += w[k] * x[k];
+            y[i] = acc;
+        }
+    }
+
+    void LinearModel::predict_batch(const fin::core::FeatureMatrixView &features, std::span<double> out) const
+    {
+        check_bound("LinearModel::predict_batch()");
+        if (!features.schema || features.schema->names() != bound_names_)
+            throw std::invalid_argument("LinearModel::predict_batch() matrix schema does not match the bound names");
+        if (out.size() != features.rows())
+            throw std::invalid_argument("LinearModel::predict_batch() needs one output per matrix row");
+        predict_batch(features.values, out);
+    }
+
+    void LinearModel::fit(std::span<const FeatureVector> features, std::span<const double> targets)
+    {
+        if (features.empty() || features.size() != targets.size())
+            throw std::invalid_argument("LinearModel::fit() needs one target per feature vector");
+
+        online_.emplace(features.front().size());
+        for (std::size_t i = 0; i < features.size(); ++i)
+            online_->add_sample(features[i].values, targets[i]);
+        apply_fit(online_->solve(ridge_lambda_), features.front().names());
+    }
+
+    void LinearModel::fit(const fin::core::FeatureMatrixView &features, std::span<const double> targets)
+    {
+        if (features.empty() || features.rows() != targets.size())
+            throw std::invalid_argument("LinearModel::fit() needs one target per feature row");
+
+        online_.emplace(features.cols());
+        for (std::size_t i = 0; i < features.rows(); ++i)
+            online_->add_sample(features.row(i), targets[i]);
+        apply_fit(online_->solve(ridge_lambda_), features.schema->names());
+    }
+
+    void LinearModel::partial_fit(const FeatureVector &features, double target)
+    {
+        if (!online_)
+            online_.emplace(features.size());
+        online_->add_sample(features.values, target);
+        if (online_->samples() > online_->features())
+            apply_fit(online_->solve(ridge_lambda_), features.names());
+    }
+
+    void LinearModel::apply_fit(RidgeSolution &&fit, const std::vector<std::string> &names)
+    {
+        bias_ = fit.bias;
+        ready_ = true;
+        if (names.size() != fit.weights.size())
+        {
+            weights_ = std::move(fit.weights);
+            named_weights_.clear();
+            rebind();
+            return;
+        }
+
+        // Online refits usually see the same names every step; update the
+        // weights in place instead of rebuilding the pairs.
+        bool same_names = named_weights_.size() == names.size();
+        for (std::size_t i = 0; same_names && i < names.size(); ++i)
+            same_names = named_weights_[i].first == names[i];
+        if (!same_names)
+        {
+            named_weights_.clear();
+            named_weights_.reserve(names.size());
+            for (const auto &name : names)
+                named_weights_.emplace_back(name, 0.0);
+        }
+        for (std::size_t i = 0; i < names.size(); ++i)
+            named_weights_[i].second = fit.weights[i];
+        weights_.clear();
+        rebind();
+    }
+
     void LinearModel::set_weights(std::vector<double> weights, double bias)
     {
         bias_ = bias;
         weights_ = std::move(weights);
         named_weights_.clear();
         ready_ = !weights_.empty();
+        rebind();
     }
 
     void LinearModel::set_named_weights(std::vector<std::pair<std::string, double>> weights, double bias)
@@ -93,6 +250,7 @@ namespace fin::ml
         named_weights_ = std::move(weights);
         weights_.clear();
         ready_ = !named_weights_.empty();
+        rebind();
     }
 
     bool LinearModel::load_from_file(const std::string &path)
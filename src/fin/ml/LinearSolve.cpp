@@ -0,0 +1,220 @@
+#include "fin/ml/LinearSolve.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace fin::ml
+{
+    namespace
+    {
+        constexpr std::size_t kBlock = 64;
+        constexpr double kEps = std::numeric_limits<double>::epsilon();
+
+        std::size_t checked_order(std::span<const double> A, std::span<const double> b)
+        {
+            const std::size_t n = b.size();
+            if (A.size() != n * n)
+                throw std::invalid_argument("linear solve: matrix is not n x n for the given right-hand side");
+            return n;
+        }
+
+        // In-place lower Cholesky factor of a row-major n x n matrix.
+        bool cholesky_factor(double *A, std::size_t n)
+        {
+            double max_diag = 0.0;
+            for (std::size_t i = 0; i < n; ++i)
+                max_diag = std::max(max_diag, std::fabs(A[i * n + i]));
+            const double tiny = kEps * max_diag;
+
+            for (std::size_t k = 0; k < n; k += kBlock)
+            {
+                const std::size_t kend = std::min(k + kBlock, n);
+
+                // Diagonal block; earlier panels are already subtracted.
+                for (std::size_t j = k; j < kend; ++j)
+                {
+                    double *rj = A + j * n;
+                    double d = rj[j];
+                    for (std::size_t p = k; p < j; ++p)
+                        d -= rj[p] * rj[p];
+                    if (!(d > tiny))
+                        return false;
+                    rj[j] = std::sqrt(d);
+
+                    const double inv = 1.0 / rj[j];
+                    for (std::size_t i = j + 1; i < kend; ++i)
+                    {
+                        double *ri = A + i * n;
+                        double s = ri[j];
+                        for (std::size_t p = k; p < j; ++p)
+                            s -= ri[p] * rj[p];
+                        ri[j] = s * inv;
+                    }
+                }
+
+                // Panel below the diagonal block.
+                for (std::size_t i = kend; i < n; ++i)
+                {
+                    double *ri = A + i * n;
+                    for (std::size_t j = k; j < kend; ++j)
+                    {
+                        const double *rj = A + j * n;
+                        double s = ri[j];
+                        for (std::size_t p = k; p < j; ++p)
+                            s -= ri[p] * rj[p];
+                        ri[j] = s / rj[j];
+                    }
+                }
+
+                // Trailing lower triangle -= panel * panel^T; both operands
+                // are contiguous runs of kend - k values.
+                for (std::size_t i = kend; i < n; ++i)
+                {
+                    double *ri = A + i * n;
+                    for (std::size_t j = kend; j <= i; ++j)
+                    {
+                        const double *rj = A + j * n;
+                        double s = 0.0;
+                        for (std::size_t p = k; p < kend; ++p)
+                            s += ri[p] * rj[p];
+                        ri[j] -= s;
+                    }
+                }
+            }
+            return true;
+        }
+    } // namespace
+
+    bool cholesky_solve(std::span<double> A, std::span<double> b)
+    {
+        const std::size_t n = checked_order(A, b);
+        if (!cholesky_factor(A.data(), n))
+            return false;
+
+        // L y = b
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double *ri = A.data() + i * n;
+            double s = b[i];
+            for (std::size_t p = 0; p < i; ++p)
+                s -= ri[p] * b[p];
+            b[i] = s / ri[i];
+        }
+        // L^T x = y, column-oriented so row i of L is read contiguously.
+        for (std::size_t i = n; i-- > 0;)
+        {
+            const double *ri = A.data() + i * n;
+            b[i] /= ri[i];
+            for (std::size_t p = 0; p < i; ++p)
+                b[p] -= ri[p] * b[i];
+        }
+        return true;
+    }
+
+    bool qr_solve(std::span<const double> A, std::span<double> b)
+    {
+        const std::size_t n = checked_order(A, b);
+
+        // Work column-major so reflections and pivot norms stream columns.
+        std::vector<double> Q(n * n);
+        for (std::size_t r = 0; r < n; ++r)
+            for (std::size_t c = 0; c < n; ++c)
+                Q[c * n + r] = A[r * n + c];
+        auto col = [&Q, n](std::size_t c)
+        { return Q.data() + c * n; };
+
+        std::vector<std::size_t> perm(n);
+        std::iota(perm.begin(), perm.end(), std::size_t{0});
+
+        double tol = 0.0;
+        std::size_t rank = 0;
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            // Pivot on the largest remaining column norm.
+            std::size_t pivot = k;
+            double best = -1.0;
+            for (std::size_t j = k; j < n; ++j)
+            {
+                const double *cj = col(j);
+                double s = 0.0;
+                for (std::size_t i = k; i < n; ++i)
+                    s += cj[i] * cj[i];
+                if (s > best)
+                {
+                    best = s;
+                    pivot = j;
+                }
+            }
+            const double norm = std::sqrt(best);
+            if (k == 0)
+                tol = static_cast<double>(n) * kEps * norm;
+            if (norm <= tol || norm == 0.0)
+                break;
+
+            if (pivot != k)
+            {
+                std::swap_ranges(col(k), col(k) + n, col(pivot));
+                std::swap(perm[k], perm[pivot]);
+            }
+
+            // Householder reflector v = x - alpha e_k, stored in column k.
+            double *v = col(k);
+            const double alpha = v[k] > 0.0 ? -norm : norm;
+            v[k] -= alpha;
+            double vv = 0.0;
+            for (std::size_t i = k; i < n; ++i)
+                vv += v[i] * v[i];
+            const double beta = 2.0 / vv;
+
+            auto reflect = [&](double *x)
+            {
+                double s = 0.0;
+                for (std::size_t i = k; i < n; ++i)
+                    s += v[i] * x[i];
+                s *= beta;
+                for (std::size_t i = k; i < n; ++i)
+                    x[i] -= s * v[i];
+            };
+            for (std::size_t j = k + 1; j < n; ++j)
+                reflect(col(j));
+            reflect(b.data());
+
+            v[k] = alpha; // R_kk; the rest of the column is no longer needed
+            rank = k + 1;
+        }
+
+        if (rank == 0 && n > 0)
+            return false;
+
+        // R z = Q^T b over the leading `rank` columns; dependent unknowns are 0.
+        std::vector<double> z(n, 0.0);
+        for (std::size_t i = rank; i-- > 0;)
+        {
+            double s = b[i];
+            for (std::size_t j = i + 1; j < rank; ++j)
+                s -= col(j)[i] * z[j];
+            z[i] = s / col(i)[i];
+        }
+        for (std::size_t j = 0; j < n; ++j)
+            b[perm[j]] = z[j];
+        return true;
+    }
+
+    bool solve_spd(std::span<double> A, std::span<double> b)
+    {
+        // Cholesky overwrites A's lower triangle and b, so keep the originals.
+        const std::vector<double> A0(A.begin(), A.end());
+        const std::vector<double> b0(b.begin(), b.end());
+        if (cholesky_solve(A, b))
+            return true;
+
+        std::copy(b0.begin(), b0.end(), b.begin());
+        return qr_solve(A0, b);
+    }
+
+} // namespace fin::ml
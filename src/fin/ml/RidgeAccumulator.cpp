@@ -0,0 +1,105 @@
+#include "fin/ml/RidgeAccumulator.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "fin/ml/LinearSolve.hpp"
+
+namespace fin::ml
+{
+    RidgeAccumulator::RidgeAccumulator(std::size_t features)
+        : features_(features), xtx_((features + 1) * (features + 1), 0.0), xty_(features + 1, 0.0) {}
+
+    void RidgeAccumulator::add_sample(std::span<const double> x, double y)
+    {
+        accumulate(x, y, 1.0);
+        ++samples_;
+    }
+
+    void RidgeAccumulator::remove_sample(std::span<const double> x, double y)
+    {
+        if (samples_ == 0)
+            throw std::logic_error("RidgeAccumulator::remove_sample: no samples to remove");
+        accumulate(x, y, -1.0);
+        --samples_;
+    }
+
+    void RidgeAccumulator::clear() noexcept
+    {
+        std::fill(xtx_.begin(), xtx_.end(), 0.0);
+        std::fill(xty_.begin(), xty_.end(), 0.0);
+        yty_ = 0.0;
+        samples_ = 0;
+    }
+
+    void RidgeAccumulator::accumulate(std::span<const double> x, double y, double sign)
+    {
+        if (x.size() != features_)
+            throw std::invalid_argument("RidgeAccumulator: feature count mismatch");
+
+        // X'X is symmetric, so only the upper triangle is maintained; the
+        // bias column (constant 1) is the last row/column.
+        const std::size_t n = features_ + 1;
+        for (std::size_t r = 0; r < features_; ++r)
+        {
+            const double xr = sign * x[r];
+            double *row = xtx_.data() + r * n;
+            for (std::size_t c = r; c < features_; ++c)
+                row[c] += xr * x[c];
+            row[features_] += xr;
+            xty_[r] += xr * y;
+        }
+        xtx_[features_ * n + features_] += sign;
+        xty_[features_] += sign * y;
+        yty_ += sign * y * y;
+    }
+
+    RidgeSolution RidgeAccumulator::solve(double ridge_lambda) const
+    {
+        const std::size_t n = features_ + 1;
+        std::vector<double> A(n * n);
+        for (std::size_t r = 0; r < n; ++r)
+        {
+            for (std::size_t c = r; c < n; ++c)
+            {
+                A[r * n + c] = xtx_[r * n + c];
+                A[c * n + r] = xtx_[r * n + c];
+            }
+        }
+        for (std::size_t j = 0; j < features_; ++j)
+            A[j * n + j] += ridge_lambda;
+
+        std::vector<double> solution = xty_;
+        if (!solve_spd(A, solution))
+            throw std::runtime_error("Failed to solve normal equations for linear model");
+
+        RidgeSolution fit{};
+        fit.bias = solution.back();
+        solution.pop_back();
+        fit.weights = std::move(solution);
+        return fit;
+    }
+
+    double RidgeAccumulator::sse(const RidgeSolution &fit) const
+    {
+        if (fit.weights.size() != features_)
+            throw std::invalid_argument("RidgeAccumulator: solution has the wrong feature count");
+        const std::size_t n = features_ + 1;
+        auto w = [&fit, this](std::size_t k)
+        { return k < features_ ? fit.weights[k] : fit.bias; };
+
+        double quad = 0.0, lin = 0.0;
+        for (std::size_t r = 0; r < n; ++r)
+        {
+            // Diagonal once, off-diagonal upper entries twice.
+            double row = xtx_[r * n + r] * w(r);
+            for (std::size_t c = r + 1; c < n; ++c)
+                row += 2.0 * xtx_[r * n + c] * w(c);
+            quad += w(r) * row;
+            lin += w(r) * xty_[r];
+        }
+        return std::max(0.0, yty_ - 2.0 * lin + quad);
+    }
+
+} // namespace fin::ml
@@ -8,18 +8,23 @@
 #include <vector>
 #include <optional>
 #include <charconv>
+#include <filesystem>
 #include <fstream>
 #include <chrono>
 #include <exception>
 #include <memory>
 
 #include "fin/io/Pipeline.hpp"
+#include "fin/io/SymbolPipeline.hpp"
 #include "fin/backtest/Backtester.hpp"
+#include "fin/indicators/DynamicFeatureBus.hpp"
 #include "fin/indicators/FeatureBus.hpp"
+#include "fin/indicators/IndicatorGraph.hpp"
 #include "fin/signal/SignalEngine.hpp"
 #include "fin/ml/FeatureVector.hpp"
 #include "fin/ml/LinearModel.hpp"
 #include "fin/ml/LinearTrainer.hpp"
+#include "fin/app/ParameterSweep.hpp"
 #include "fin/app/ScenarioRunner.hpp"
 #include "fin/app/ScenarioConfigIO.hpp"
 #include "fin/app/ScenarioUtils.hpp"
@@ -102,11 +107,21 @@ static fin::io::Timeframe parse_timeframe_flag(const std::vector<std::string> &a
     return fin::io::Timeframe::M1;
 }
 
+// --max-lateness DUR: out-of-order ticks up to DUR late are merged; 0 (the
+// default) drops them.
+static std::chrono::nanoseconds parse_lateness_flag(const std::vector<std::string> &args)
+{
+    if (auto token = parse_string_flag(args, "--max-lateness"))
+        if (auto parsed = fin::app::parse_lateness_token(*token))
+            return *parsed;
+    return std::chrono::nanoseconds::zero();
+}
+
 static int cmd_backtest(const std::vector<std::string> &args)
 {
     if (args.empty())
     {
-        std::cerr << "Usage: aiquant backtest <ticks.csv> [--tf S1|S5|M1|M5|H1] [--cash N] [--qty N] [--fee N] [--ema-fast N] [--ema-slow N] [--rsi N] [--macd-fast N] [--macd-slow N] [--macd-signal N] [--rsi-buy N] [--rsi-sell N] [--no-ema-xover] [--candles-out path] [--model-linear path]\n";
+        std::cerr << "Usage: aiquant backtest <ticks.csv> [--tf TF] [--max-lateness DUR] [--cash N] [--qty N] [--fee N] [--ema-fast N] [--ema-slow N] [--rsi N] [--macd-fast N] [--macd-slow N] [--macd-signal N] [--rsi-buy N] [--rsi-sell N] [--no-ema-xover] [--candles-out path] [--model-linear path]\n";
         return 2;
     }
 
@@ -114,7 +129,7 @@ static int cmd_backtest(const std::vector<std::string> &args)
 
     fin::io::TickCsvOptions opt{}; // defaults: header, epoch-ms
     auto tf = parse_timeframe_flag(args);
-    auto res = fin::io::resample_csv_with_stats(path, tf, opt);
+    auto res = fin::io::resample_ticks_with_stats(path, tf, opt, parse_lateness_flag(args));
 
     fin::backtest::BacktestConfig cfg{}; // defaults
     if (auto v = parse_double_flag(args, "--cash"))
@@ -133,7 +148,9 @@ static int cmd_backtest(const std::vector<std::string> &args)
     const std::size_t macd_slow = parse_size_flag(args, "--macd-slow").value_or(26);
     const std::size_t macd_signal = parse_size_flag(args, "--macd-signal").value_or(9);
 
-    std::unique_ptr<fin::indicators::FeatureBus> feature_bus;
+    // With a model, its features and the backtester's EMAs/RSI share one graph.
+    fin::indicators::IndicatorGraph graph;
+    std::unique_ptr<fin::indicators::DynamicFeatureBus> feature_bus;
     std::optional<fin::ml::LinearModel> linear_model;
     if (auto model_path = parse_string_flag(args, "--model-linear"))
     {
@@ -144,8 +161,10 @@ static int cmd_backtest(const std::vector<std::string> &args)
         }
         else
         {
+            loaded.bind(fin::ml::FeatureVector::feature_row_names());
             linear_model = std::move(loaded);
-            feature_bus = std::make_unique<fin::indicators::FeatureBus>(cfg.ema_fast, cfg.rsi_period, macd_fast, macd_slow, macd_signal);
+            feature_bus = std::make_unique<fin::indicators::DynamicFeatureBus>(
+                fin::indicators::default_feature_specs(cfg.ema_fast, cfg.rsi_period, macd_fast, macd_slow, macd_signal), graph);
         }
     }
     // Signal config (MVP): RSI Thresholds and EMA crossover on/off
@@ -159,19 +178,21 @@ static int cmd_backtest(const std::vector<std::string> &args)
 
     fin::signal::SignalEngine eng{scfg}; // defaults
     fin::backtest::Backtester bt(cfg, eng);
+    if (feature_bus)
+        bt.share_indicators(graph);
 
+    std::vector<double> row(feature_bus ? feature_bus->width() : 0);
     for (const auto &c : res.candles)
     {
         std::optional<double> prediction;
         if (feature_bus)
         {
-            if (auto row = feature_bus->update(c))
+            if (feature_bus->update(c, row))
             {
-                auto fv = fin::ml::FeatureVector::from_feature_row(*row);
                 try
                 {
                     if (linear_model)
-                        prediction = linear_model->predict(fv);
+                        prediction = linear_model->predict_row(row);
                 }
                 catch (const std::exception &ex)
                 {
@@ -186,6 +207,7 @@ static int cmd_backtest(const std::vector<std::string> &args)
 
     std::cout << "Candles: " << res.candles.size() << "\n";
     std::cout << "Rows: " << res.stats.rows << ", Parsed: " << res.stats.parsed << ", Skipped: " << res.stats.skipped << "\n";
+    std::cout << "Late ticks: merged " << res.late.merged << ", dropped " << res.late.dropped << "\n";
     std::cout << "Final Cash: " << m.final_cash << "\n";
     std::cout << "PnL: " << m.pnl << " (" << m.return_pct << "%)\n";
     std::cout << "Max DD: " << m.max_drawdown << "%\n";
@@ -221,14 +243,14 @@ static int cmd_train_linear(const std::vector<std::string> &args)
 {
     if (args.empty())
     {
-        std::cerr << "Usage: aiquant train-linear <ticks.csv> [--tf S1|S5|M1|M5|H1] [--ema-fast N] [--rsi N] [--macd-fast N] [--macd-slow N] [--macd-signal N] [--out path]\n";
+        std::cerr << "Usage: aiquant train-linear <ticks.csv> [--tf TF] [--max-lateness DUR] [--ema-fast N] [--rsi N] [--macd-fast N] [--macd-slow N] [--macd-signal N] [--out path]\n";
         return 2;
     }
 
     const std::string path = args[0];
     fin::io::TickCsvOptions opt{};
     auto tf = parse_timeframe_flag(args);
-    auto res = fin::io::resample_csv_with_stats(path, tf, opt);
+    auto res = fin::io::resample_ticks_with_stats(path, tf, opt, parse_lateness_flag(args));
 
     std::size_t ema_fast = parse_size_flag(args, "--ema-fast").value_or(12);
     std::size_t rsi_period = parse_size_flag(args, "--rsi").value_or(14);
@@ -278,14 +300,14 @@ static int cmd_features(const std::vector<std::string> &args)
 {
     if (args.empty())
     {
-        std::cerr << "Usage: aiquant features <ticks.csv> [--tf S1|S5|M1|M5|H1] [--ema-fast N] [--rsi N] [--macd-fast N] [--macd-slow N] [--macd-signal N]\n";
+        std::cerr << "Usage: aiquant features <ticks.csv> [--tf TF] [--max-lateness DUR] [--ema-fast N] [--rsi N] [--macd-fast N] [--macd-slow N] [--macd-signal N]\n";
         return 2;
     }
     const std::string path = args[0];
 
     fin::io::TickCsvOptions opt{};
     auto tf = parse_timeframe_flag(args);
-    auto res = fin::io::resample_csv_with_stats(path, tf, opt);
+    auto res = fin::io::resample_ticks_with_stats(path, tf, opt, parse_lateness_flag(args));
 
     std::size_t ema_fast = parse_size_flag(args, "--ema-fast").value_or(12);
     std::size_t rsi_period = parse_size_flag(args, "--rsi").value_or(14);
@@ -313,29 +335,11 @@ static int cmd_features(const std::vector<std::string> &args)
     return 0;
 }
 
-static const char *timeframe_to_cstr(fin::io::Timeframe tf)
-{
-    switch (tf)
-    {
-    case fin::io::Timeframe::S1:
-        return "S1";
-    case fin::io::Timeframe::S5:
-        return "S5";
-    case fin::io::Timeframe::M5:
-        return "M5";
-    case fin::io::Timeframe::H1:
-        return "H1";
-    case fin::io::Timeframe::M1:
-    default:
-        return "M1";
-    }
-}
-
 static void print_scenario_result(const fin::app::ScenarioConfig &cfg, const fin::app::ScenarioResult &result)
 {
     std::cout << "=== MVP scenario ===\n";
     std::cout << "Ticks: " << cfg.ticks_path << "\n";
-    std::cout << "Timeframe: " << timeframe_to_cstr(cfg.timeframe) << "\n";
+    std::cout << "Timeframe: " << fin::io::to_string(cfg.timeframe) << "\n";
     std::cout << "Candles (post-resample): " << result.candles;
     if (result.warmup_candles > 0)
         std::cout << " (warmup " << result.warmup_candles << ")";
@@ -369,22 +373,45 @@ static void print_scenario_result(const fin::app::ScenarioConfig &cfg, const fin
     std::cout << "Trades: " << result.metrics.trades << " (Wins: " << result.metrics.wins
               << ", Losses: " << result.metrics.losses << ")\n";
     std::cout << "Max DD: " << result.metrics.max_drawdown << "%\n";
+    if (!result.folds.empty())
+    {
+        std::cout << "Walk-forward folds (train rows, test rows, test start ms, RMSE, PnL, trades):\n";
+        for (const auto &f : result.folds)
+            std::cout << " [" << f.train_begin << ", " << f.train_end << ") [" << f.test_begin << ", " << f.test_end << ") "
+                      << f.test_start_ms << ", " << f.validation_rmse << ", " << f.metrics.pnl << ", " << f.metrics.trades << "\n";
+    }
+    if (result.late_ticks.merged || result.late_ticks.dropped)
+        std::cout << "Late ticks: merged " << result.late_ticks.merged << ", dropped " << result.late_ticks.dropped << "\n";
+    std::cout << "Mode: " << fin::app::scenario_mode_to_cstr(cfg.mode) << ", peak RSS: "
+              << static_cast<double>(result.peak_rss_bytes) / (1024.0 * 1024.0) << " MB\n";
     if (result.model_saved && cfg.model_output_path)
         std::cout << "Saved model: " << *cfg.model_output_path << "\n";
+    if (result.features_saved && cfg.features_output_path)
+        std::cout << "Saved features: " << *cfg.features_output_path << "\n";
 }
 
-static int cmd_run_mvp(const std::vector<std::string> &args)
+// Scenario flags shared by run-mvp and sweep; args[0] is the ticks path.
+// nullopt (after printing why) on an invalid --features list.
+static std::optional<fin::app::ScenarioConfig> parse_scenario_flags(const std::vector<std::string> &args)
 {
-    if (args.empty())
-    {
-        std::cerr << "Usage: aiquant run-mvp <ticks.csv> [--tf S1|S5|M1|M5|H1] [--train-ratio 0.1-0.95] [--ridge L] [--cash N] [--qty N] [--fee N] [--ema-fast N] [--ema-slow N] [--rsi N] [--macd-fast N] [--macd-slow N] [--macd-signal N] [--rsi-buy N|--rsi_buy N] [--rsi-sell N|--rsi_sell N] [--no-ema-xover] [--preview N] [--preview-out path] [--model-out path] [--json]\n";
-        return 2;
-    }
-
     fin::app::ScenarioConfig cfg{};
     cfg.ticks_path = args[0];
     cfg.timeframe = parse_timeframe_flag(args);
-
+    cfg.max_lateness = parse_lateness_flag(args);
+
+    if (auto v = parse_size_flag(args, "--threads"))
+        cfg.ingest_threads = *v;
+    if (flag_present(args, "--stream"))
+        cfg.mode = fin::app::ScenarioMode::Streaming;
+    if (auto v = parse_size_flag(args, "--train-rows"))
+        cfg.stream_train_rows = *v;
+    if (auto v = parse_size_flag(args, "--wf-train"))
+        cfg.walk_forward_train = *v;
+    if (auto v = parse_size_flag(args, "--wf-test"))
+        cfg.walk_forward_test = *v;
+    if (auto v = parse_size_flag(args, "--wf-jobs"))
+        cfg.walk_forward_threads = *v;
+    cfg.walk_forward_anchored = flag_present(args, "--wf-anchored");
     if (auto ratio = parse_double_flag(args, "--train-ratio"))
         cfg.train_ratio = *ratio;
     if (auto ridge = parse_double_flag(args, "--ridge"))
@@ -404,6 +431,16 @@ static int cmd_run_mvp(const std::vector<std::string> &args)
         cfg.macd_signal = *v;
     if (auto v = parse_size_flag(args, "--preview"))
         cfg.validation_preview_limit = *v;
+    if (auto text = parse_string_flag(args, "--features"))
+    {
+        auto specs = fin::indicators::parse_feature_specs(*text);
+        if (!specs)
+        {
+            std::cerr << "Invalid --features list: " << *text << "\n";
+            return std::nullopt;
+        }
+        cfg.features = std::move(*specs);
+    }
 
     if (auto v = parse_double_flag(args, "--rsi-buy"))
         cfg.rsi_buy = *v;
@@ -423,9 +460,26 @@ static int cmd_run_mvp(const std::vector<std::string> &args)
         cfg.trade_qty = *v;
     if (auto v = parse_double_flag(args, "--fee"))
         cfg.fee_per_trade = *v;
+    return cfg;
+}
+
+static int cmd_run_mvp(const std::vector<std::string> &args)
+{
+    if (args.empty())
+    {
+        std::cerr << "Usage: aiquant run-mvp <ticks.csv> [--tf TF] [--max-lateness DUR] [--threads N] [--stream] [--train-ratio 0.1-0.95] [--train-rows N] [--wf-test N [--wf-train N] [--wf-anchored] [--wf-jobs N]] [--ridge L] [--cash N] [--qty N] [--fee N] [--ema-fast N] [--ema-slow N] [--rsi N] [--macd-fast N] [--macd-slow N] [--macd-signal N] [--features LIST] [--rsi-buy N|--rsi_buy N] [--rsi-sell N|--rsi_sell N] [--no-ema-xover] [--preview N] [--preview-out path] [--model-out path] [--features-out path] [--json]\n";
+        return 2;
+    }
+
+    auto parsed = parse_scenario_flags(args);
+    if (!parsed)
+        return 2;
+    fin::app::ScenarioConfig cfg = std::move(*parsed);
 
     if (auto out = parse_string_flag(args, "--model-out"))
         cfg.model_output_path = *out;
+    if (auto out = parse_string_flag(args, "--features-out"))
+        cfg.features_output_path = *out;
 
     auto preview_out = parse_string_flag(args, "--preview-out");
     bool json_output = flag_present(args, "--json");
@@ -447,6 +501,279 @@ static int cmd_run_mvp(const std::vector<std::string> &args)
     }
 }
 
+static void print_sweep_row(std::ostream &os, std::size_t rank, const fin::app::SweepEntry &e, char sep)
+{
+    const auto &c = e.config;
+    os << rank << sep << c.ema_fast << sep << c.ema_slow << sep << c.rsi_period << sep
+       << c.rsi_buy << sep << c.rsi_sell << sep << c.ridge_lambda << sep;
+    if (!e.ok)
+    {
+        os << "error" << sep << e.error << "\n";
+        return;
+    }
+    const auto &m = e.result.metrics;
+    os << m.trades << sep << m.pnl << sep << m.return_pct << sep << m.max_drawdown << sep
+       << e.result.validation_rmse << "\n";
+}
+
+static int cmd_sweep(const std::vector<std::string> &args)
+{
+    if (args.empty())
+    {
+        std::cerr << "Usage: aiquant sweep <ticks.csv> [--ema-fast LIST] [--ema-slow LIST] [--rsi LIST] [--rsi-buy LIST] [--rsi-sell LIST] [--ridge LIST] [--jobs N] [--rank return|rmse] [--top N] [--csv path] [run-mvp flags]\n"
+                  << "  LIST is comma-separated values and/or lo:hi:step ranges, e.g. --ema-fast 5,8:20:4\n";
+        return 2;
+    }
+
+    auto parsed = parse_scenario_flags(args);
+    if (!parsed)
+        return 2;
+    fin::app::ScenarioConfig base = std::move(*parsed);
+    fin::app::SweepGrid grid{};
+    auto parse_axis = [&](const char *flag, auto &axis)
+    {
+        auto text = parse_string_flag(args, flag);
+        if (text && !fin::app::parse_sweep_values(*text, axis))
+        {
+            std::cerr << "Invalid " << flag << " list: " << *text << "\n";
+            return false;
+        }
+        return true;
+    };
+    if (!parse_axis("--ema-fast", grid.ema_fast) || !parse_axis("--ema-slow", grid.ema_slow) ||
+        !parse_axis("--rsi", grid.rsi_period) || !parse_axis("--rsi-buy", grid.rsi_buy) ||
+        !parse_axis("--rsi-sell", grid.rsi_sell) || !parse_axis("--ridge", grid.ridge_lambda))
+        return 2;
+
+    fin::app::SweepOptions opt{};
+    opt.threads = parse_size_flag(args, "--jobs").value_or(0);
+    const std::string rank = parse_string_flag(args, "--rank").value_or("return");
+    if (rank == "rmse")
+        opt.rank_by = fin::app::SweepRankBy::ValidationRmse;
+    else if (rank != "return")
+    {
+        std::cerr << "Unknown --rank '" << rank << "' (expected return or rmse)\n";
+        return 2;
+    }
+    const std::size_t top = parse_size_flag(args, "--top").value_or(10);
+
+    try
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        auto res = fin::app::run_sweep(base, grid, opt);
+        const auto secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+        std::size_t failed = 0;
+        for (const auto &e : res.entries)
+            failed += e.ok ? 0 : 1;
+        std::cout << "Candles: " << res.candles << ", combinations: " << res.entries.size()
+                  << " (" << failed << " failed), " << secs << " s\n";
+        std::cout << "rank\tema_fast\tema_slow\trsi\trsi_buy\trsi_sell\tridge\ttrades\tpnl\treturn_pct\tmax_dd\tval_rmse\n";
+        for (std::size_t i = 0; i < res.entries.size() && i < top; ++i)
+            print_sweep_row(std::cout, i + 1, res.entries[i], '\t');
+
+        if (auto csv = parse_string_flag(args, "--csv"))
+        {
+            std::ofstream ofs(*csv);
+            if (!ofs)
+            {
+                std::cerr << "Failed to open --csv file: " << *csv << "\n";
+                return 1;
+            }
+            ofs << "rank,ema_fast,ema_slow,rsi,rsi_buy,rsi_sell,ridge,trades,pnl,return_pct,max_dd,val_rmse\n";
+            for (std::size_t i = 0; i < res.entries.size(); ++i)
+                print_sweep_row(ofs, i + 1, res.entries[i], ',');
+        }
+        return 0;
+    }
+    catch (const std::exception &ex)
+    {
+        std::cerr << "sweep failed: " << ex.what() << "\n";
+        return 1;
+    }
+}
+
+// File name stem for an untrusted symbol: characters outside [A-Za-z0-9._-]
+// become '_'. nullopt for names that would still not stay inside the output
+// directory ("", ".", "..").
+static std::optional<std::string> symbol_file_stem(const std::string &symbol)
+{
+    if (symbol.empty() || symbol == "." || symbol == "..")
+        return std::nullopt;
+    std::string stem = symbol;
+    for (char &c : stem)
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '.' && c != '_' && c != '-')
+            c = '_';
+    return stem;
+}
+
+// Timestamp,open,high,low,close,volume with epoch-ms timestamps.
+static bool write_candles_csv(const std::filesystem::path &path, const fin::core::CandleSeriesView &bars)
+{
+    std::ofstream ofs(path);
+    if (!ofs)
+    {
+        std::cerr << "Failed to write " << path.string() << "\n";
+        return false;
+    }
+    ofs << "Timestamp,open,high,low,close,volume\n";
+    for (std::size_t i = 0; i < bars.size(); ++i)
+        ofs << std::chrono::duration_cast<std::chrono::milliseconds>(bars.ts[i].time_since_epoch()).count() << ','
+            << bars.open[i] << ',' << bars.high[i] << ',' << bars.low[i] << ',' << bars.close[i] << ',' << bars.volume[i] << "\n";
+    return true;
+}
+
+static int cmd_symbols(const std::vector<std::string> &args)
+{
+    if (args.empty())
+    {
+        std::cerr << "Usage: aiquant symbols <ticks.csv> [--tf TF] [--threads N] [--partitions N] [--features LIST] [--out-dir dir]\n";
+        return 2;
+    }
+
+    fin::io::SymbolPipelineOptions sopt{};
+    sopt.ingest_threads = parse_size_flag(args, "--threads").value_or(1);
+    sopt.partition_threads = parse_size_flag(args, "--partitions").value_or(1);
+    if (auto text = parse_string_flag(args, "--features"))
+    {
+        auto specs = fin::indicators::parse_feature_specs(*text);
+        if (!specs)
+        {
+            std::cerr << "Invalid --features list: " << *text << "\n";
+            return 2;
+        }
+        sopt.features = std::move(*specs);
+    }
+
+    try
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        auto res = fin::io::resample_by_symbol(args[0], parse_timeframe_flag(args), {}, sopt);
+        const auto secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+        std::cout << "Rows: " << res.stats.rows << ", Parsed: " << res.stats.parsed << ", Skipped: " << res.stats.skipped << "\n";
+        std::cout << "Symbols: " << res.symbols.size() << " in " << secs << " s\n";
+        std::cout << "symbol\tticks\tcandles" << (sopt.features.empty() ? "" : "\tfeature_rows") << "\n";
+        for (const auto &s : res.symbols)
+        {
+            std::cout << s.symbol.value() << '\t' << s.ticks << '\t' << s.candles.size();
+            if (s.features)
+                std::cout << '\t' << s.features->rows();
+            std::cout << "\n";
+        }
+
+        if (auto dir = parse_string_flag(args, "--out-dir"))
+        {
+            std::filesystem::create_directories(*dir);
+            std::vector<std::string> stems;
+            for (const auto &s : res.symbols)
+            {
+                const auto stem = symbol_file_stem(s.symbol.value());
+                if (!stem || std::find(stems.begin(), stems.end(), *stem) != stems.end())
+                {
+                    std::cerr << "Skipping symbol '" << s.symbol.value() << "': no unique file name\n";
+                    continue;
+                }
+                stems.push_back(*stem);
+                if (!write_candles_csv(std::filesystem::path(*dir) / (*stem + ".csv"), s.candles.view()))
+                    return 1;
+                const auto features_path = std::filesystem::path(*dir) / (*stem + ".features.csv");
+                if (s.features && !fin::app::write_feature_matrix_csv(s.features->view(), features_path.string()))
+                {
+                    std::cerr << "Failed to write " << features_path.string() << "\n";
+                    return 1;
+                }
+            }
+        }
+        return 0;
+    }
+    catch (const std::exception &ex)
+    {
+        std::cerr << "symbols failed: " << ex.what() << "\n";
+        return 1;
+    }
+}
+
+// Several timeframes from one read of the ticks (cascading resampler).
+static int cmd_candles(const std::vector<std::string> &args)
+{
+    if (args.empty())
+    {
+        std::cerr << "Usage: aiquant candles <ticks.csv> [--tf LIST, e.g. M1,M5,H1] [--max-lateness DUR] [--out-dir dir]\n";
+        return 2;
+    }
+
+    std::vector<fin::io::Timeframe> tfs{fin::io::Timeframe::M1};
+    if (auto list = parse_string_flag(args, "--tf"))
+    {
+        auto parsed = fin::app::parse_timeframe_list(*list);
+        if (!parsed)
+        {
+            std::cerr << "Invalid --tf list: " << *list << "\n";
+            return 2;
+        }
+        tfs = std::move(*parsed);
+    }
+
+    try
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        auto res = fin::io::resample_ticks_multi(args[0], std::move(tfs), {}, parse_lateness_flag(args));
+        const auto secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+        std::cout << "Rows: " << res.stats.rows << ", Parsed: " << res.stats.parsed << ", Skipped: " << res.stats.skipped << "\n";
+        std::cout << "Late ticks: merged " << res.late.merged << ", dropped " << res.late.dropped << "\n";
+        std::cout << "Resampled in " << secs << " s\n";
+        std::cout << "timeframe\tcandles\n";
+        for (const auto &s : res.series)
+            std::cout << fin::io::to_string(s.tf) << '\t' << s.candles.size() << "\n";
+
+        if (auto dir = parse_string_flag(args, "--out-dir"))
+        {
+            std::filesystem::create_directories(*dir);
+            for (const auto &s : res.series)
+                if (!write_candles_csv(std::filesystem::path(*dir) / (fin::io::to_string(s.tf) + ".csv"), s.candles.view()))
+                    return 1;
+        }
+        return 0;
+    }
+    catch (const std::exception &ex)
+    {
+        std::cerr << "candles failed: " << ex.what() << "\n";
+        return 1;
+    }
+}
+
+static int cmd_convert(const std::vector<std::string> &args)
+{
+    if (args.size() < 2)
+    {
+        std::cerr << "Usage: aiquant convert <ticks.csv> <out.aqt> [--threads N]\n";
+        return 2;
+    }
+
+    fin::io::TickCsvOptions opt{};
+    fin::io::ParallelIngestOptions popt{};
+    popt.threads = parse_size_flag(args, "--threads").value_or(1);
+
+    try
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        auto stats = fin::io::convert_csv_to_tick_store(args[0], args[1], opt, popt);
+        const auto secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+        fin::io::TickStoreSource check(args[1]);
+        std::cout << "Rows: " << stats.rows << ", Parsed: " << stats.parsed << ", Skipped: " << stats.skipped << "\n";
+        std::cout << "Wrote " << check.size() << " ticks to " << args[1] << " in " << secs << " s\n";
+        return 0;
+    }
+    catch (const std::exception &ex)
+    {
+        std::cerr << "convert failed: " << ex.what() << "\n";
+        return 1;
+    }
+}
+
 static int cmd_run_config(const std::vector<std::string> &args)
 {
     if (args.empty())
@@ -490,12 +817,18 @@ int main(int argc, char **argv)
     {
         std::cout << "AiQuant CLI (MVP)\n";
         std::cout << "Commands: \n";
-        std::cout << "  backtest <ticks.csv> [--tf S1|S5|M1|M5|H1] [--cash N] [--qty N] [--fee N] [--ema-fast N] [--ema-slow N] [--rsi N] [--macd-fast N] [--macd-slow N] [--macd-signal N] [--rsi-buy N] [--rsi-sell N] [--no-ema-xover] [--candles-out path] [--model-linear path]\n";
-        std::cout << "  features <ticks.csv> [--tf S1|S5|M1|M5|H1] [--ema-fast N] [--rsi N] [--macd-fast N] [--macd-slow N] [--macd-signal N]\n";
+        std::cout << "  backtest <ticks.csv> [--tf TF] [--max-lateness DUR] [--cash N] [--qty N] [--fee N] [--ema-fast N] [--ema-slow N] [--rsi N] [--macd-fast N] [--macd-slow N] [--macd-signal N] [--rsi-buy N] [--rsi-sell N] [--no-ema-xover] [--candles-out path] [--model-linear path]\n";
+        std::cout << "  features <ticks.csv> [--tf TF] [--max-lateness DUR] [--ema-fast N] [--rsi N] [--macd-fast N] [--macd-slow N] [--macd-signal N]\n";
         std::cout << "    Resample candles and run RSI+EMA strategy\n";
-        std::cout << "  train-linear <ticks.csv> [--tf ...] [--ema-fast N] [--rsi N] [--macd-fast N] [--macd-slow N] [--macd-signal N] [--out path]\n";
+        std::cout << "  train-linear <ticks.csv> [--tf ...] [--max-lateness DUR] [--ema-fast N] [--rsi N] [--macd-fast N] [--macd-slow N] [--macd-signal N] [--out path]\n";
         std::cout << "  run-mvp <ticks.csv> [end-to-end training + signal backtest]\n";
         std::cout << "  run-config <scenario.ini> [execute configuration-driven scenario]\n";
+        std::cout << "  sweep <ticks.csv> [--ema-fast LIST] [--ema-slow LIST] [--rsi LIST] [--rsi-buy LIST] [--rsi-sell LIST] [--ridge LIST] [--jobs N] [rank a parameter grid in parallel]\n";
+        std::cout << "  symbols <ticks.csv> [--tf ...] [--threads N] [--partitions N] [--features LIST] [--out-dir dir] [resample every symbol separately]\n";
+        std::cout << "  candles <ticks.csv> [--tf M1,M5,H1] [--max-lateness DUR] [--out-dir dir] [several timeframes from one read]\n";
+        std::cout << "  convert <ticks.csv> <out.aqt> [--threads N] [write binary tick store; commands above accept either]\n";
+        std::cout << "TF: S1, S5, M1, M5, H1 or any width such as 250ms, 15s, M15, 4h, D1 (default M1)\n";
+        std::cout << "DUR: merge out-of-order ticks up to this late, e.g. 500ms or 2s (default 0: drop them)\n";
 
         return 0;
     }
@@ -521,6 +854,22 @@ int main(int argc, char **argv)
     {
         return cmd_run_config({args.begin() + 1, args.end()});
     }
+    if (cmd == "sweep")
+    {
+        return cmd_sweep({args.begin() + 1, args.end()});
+    }
+    if (cmd == "symbols")
+    {
+        return cmd_symbols({args.begin() + 1, args.end()});
+    }
+    if (cmd == "candles")
+    {
+        return cmd_candles({args.begin() + 1, args.end()});
+    }
+    if (cmd == "convert")
+    {
+        return cmd_convert({args.begin() + 1, args.end()});
+    }
 
     std::cerr << "Unknown command: " << cmd << "\n";
     return 1;
@@ -0,0 +1,121 @@
+#include "catch2_compat.hpp"
+
+#include <cmath>
+#include <filesystem>
+#include <limits>
+#include <vector>
+
+#include "fin/app/ParameterSweep.hpp"
+#include "app/TestScenarioHelpers.hpp"
+
+TEST_CASE("Sweep grid expands to the cartesian product", "[app][sweep]")
+{
+    fin::app::ScenarioConfig base{};
+    base.macd_signal = 7;
+
+    fin::app::SweepGrid grid{};
+    grid.ema_fast = {5, 8};
+    grid.rsi_buy = {20.0, 25.0, 30.0};
+    REQUIRE(grid.combinations() == 6u);
+
+    const auto configs = fin::app::expand_sweep_grid(base, grid);
+    REQUIRE(configs.size() == 6u);
+    REQUIRE(configs[0].ema_fast == 5u);
+    REQUIRE(configs[0].rsi_buy == 20.0);
+    REQUIRE(configs[1].rsi_buy == 25.0);
+    REQUIRE(configs[5].ema_fast == 8u);
+    REQUIRE(configs[5].rsi_buy == 30.0);
+    for (const auto &c : configs)
+    {
+        REQUIRE(c.ema_slow == base.ema_slow);
+        REQUIRE(c.macd_signal == 7u);
+    }
+
+    REQUIRE(fin::app::expand_sweep_grid(base, fin::app::SweepGrid{}).size() == 1u);
+}
+
+TEST_CASE("Sweep value lists accept items and ranges", "[app][sweep]")
+{
+    std::vector<std::size_t> sizes;
+    REQUIRE(fin::app::parse_sweep_values("5,10:20:5", sizes));
+    REQUIRE((sizes == std::vector<std::size_t>{5, 10, 15, 20}));
+
+    std::vector<double> doubles;
+    REQUIRE(fin::app::parse_sweep_values("0.1:0.3:0.1", doubles));
+    REQUIRE(doubles.size() == 3u);
+    REQUIRE(doubles[2] == Approx(0.3));
+
+    REQUIRE(!fin::app::parse_sweep_values("1.5", sizes));
+    REQUIRE(!fin::app::parse_sweep_values("1,,2", doubles));
+    REQUIRE(!fin::app::parse_sweep_values("1:5:0", doubles));
+    REQUIRE(!fin::app::parse_sweep_values("x", doubles));
+}
+
+TEST_CASE("Parallel sweep matches individual scenario runs and is ranked", "[app][sweep]")
+{
+    using namespace scenario_test;
+    const auto ticks = write_temp_ticks_csv(400);
+
+    fin::app::ScenarioConfig base{};
+    base.ticks_path = ticks.string();
+
+    fin::app::SweepGrid grid{};
+    grid.ema_fast = {5, 12};
+    grid.rsi_period = {7, 14};
+    grid.rsi_buy = {30.0, 45.0};
+
+    fin::app::SweepOptions opt{};
+    opt.threads = 4;
+    const auto sweep = fin::app::run_sweep(base, grid, opt);
+    REQUIRE(sweep.entries.size() == 8u);
+
+    const auto configs = fin::app::expand_sweep_grid(base, grid);
+    for (std::size_t i = 0; i < sweep.entries.size(); ++i)
+    {
+        const auto &e = sweep.entries[i];
+        REQUIRE(e.ok);
+        const auto single = fin::app::run_scenario(configs[e.index]);
+        REQUIRE(e.result.candles == sweep.candles);
+        REQUIRE(e.result.metrics.final_cash == single.metrics.final_cash);
+        REQUIRE(e.result.validation_rmse == single.validation_rmse);
+        if (i > 0)
+            REQUIRE(sweep.entries[i - 1].result.metrics.return_pct >= e.result.metrics.return_pct);
+    }
+
+    opt.threads = 1;
+    opt.rank_by = fin::app::SweepRankBy::ValidationRmse;
+    const auto serial = fin::app::run_sweep(base, grid, opt);
+    for (std::size_t i = 1; i < serial.entries.size(); ++i)
+        REQUIRE(serial.entries[i - 1].result.validation_rmse <= serial.entries[i].result.validation_rmse);
+
+    std::filesystem::remove(ticks);
+}
+
+TEST_CASE("Sweep ranking puts NaN metrics after finite ones", "[app][sweep]")
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double returns[] = {nan, 1.5, nan, -2.0, 3.0, nan, 0.0, 1.5};
+    std::vector<fin::app::SweepEntry> entries;
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        fin::app::SweepEntry e{};
+        e.index = i;
+        e.ok = i != 6; // one failed run
+        e.result.metrics.return_pct = returns[i];
+        e.result.validation_rmse = returns[i];
+        entries.push_back(e);
+    }
+
+    auto by_return = entries;
+    fin::app::rank_sweep_entries(by_return, fin::app::SweepRankBy::ReturnPct);
+    const std::size_t expect_return[] = {4, 1, 7, 3, 0, 2, 5, 6};
+    for (std::size_t i = 0; i < 8; ++i)
+        REQUIRE(by_return[i].index == expect_return[i]);
+
+    auto by_rmse = entries;
+    fin::app::rank_sweep_entries(by_rmse, fin::app::SweepRankBy::ValidationRmse);
+    const std::size_t expect_rmse[] = {3, 1, 7, 4, 0, 2, 5, 6};
+    for (std::size_t i = 0; i < 8; ++i)
+        REQUIRE(by_rmse[i].index == expect_rmse[i]);
+    REQUIRE(std::isnan(by_rmse[4].result.validation_rmse));
+}
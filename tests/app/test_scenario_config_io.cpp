@@ -10,6 +10,7 @@ TEST_CASE("load_scenario_file parses canonical config", "[scenario][config]")
         # Comment line
         ticks = sample.csv
         tf = M5
+        max_lateness = 500ms
         train_ratio = 0.8
         ema_fast = 8
         ema_slow = 20
@@ -17,6 +18,7 @@ TEST_CASE("load_scenario_file parses canonical config", "[scenario][config]")
         use_ema_crossover = off
         no_ema_xover = on
         preview = 7
+        features_out = features.csv
     )");
 
     fin::app::ScenarioConfig cfg{};
@@ -24,12 +26,14 @@ TEST_CASE("load_scenario_file parses canonical config", "[scenario][config]")
     REQUIRE(fin::app::load_scenario_file(path.string(), cfg, error));
     REQUIRE(cfg.ticks_path == "sample.csv");
     REQUIRE(cfg.timeframe == fin::io::Timeframe::M5);
+    REQUIRE(cfg.max_lateness == std::chrono::milliseconds(500));
     REQUIRE(cfg.train_ratio == Approx(0.8));
     REQUIRE(cfg.ema_fast == 8);
     REQUIRE(cfg.ema_slow == 20);
     REQUIRE(cfg.rsi_period == 10);
     REQUIRE_FALSE(cfg.use_ema_crossover);
     REQUIRE(cfg.validation_preview_limit == 7);
+    REQUIRE(cfg.features_output_path.value() == "features.csv");
 
     std::filesystem::remove(path);
 }
@@ -0,0 +1,108 @@
+#include "catch2_compat.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "fin/app/ScenarioConfigIO.hpp"
+#include "fin/app/ScenarioRunner.hpp"
+#include "fin/app/ScenarioUtils.hpp"
+#include "fin/indicators/FeatureBus.hpp"
+#include "app/TestScenarioHelpers.hpp"
+
+TEST_CASE("Streaming scenario matches batch training and validation", "[scenario][streaming]")
+{
+    using namespace scenario_test;
+    const auto ticks = write_temp_ticks_csv(600);
+
+    fin::app::ScenarioConfig cfg{};
+    cfg.ticks_path = ticks.string();
+    cfg.validation_preview_limit = 5;
+    const auto batch = fin::app::run_scenario(cfg);
+
+    cfg.mode = fin::app::ScenarioMode::Streaming;
+    const auto stream = fin::app::run_scenario(cfg);
+
+    REQUIRE(stream.candles == batch.candles);
+    REQUIRE(stream.warmup_candles == batch.warmup_candles);
+    REQUIRE(stream.feature_rows == batch.feature_rows);
+    REQUIRE(stream.training.samples == batch.training.samples);
+    // The streamed MSE comes from the accumulated sums, not the residuals.
+    REQUIRE(stream.training.mse == Approx(batch.training.mse).margin(1e-6));
+    REQUIRE(stream.validation_samples == batch.validation_samples);
+    REQUIRE(stream.validation_rmse == Approx(batch.validation_rmse).margin(1e-9));
+    REQUIRE(stream.validation_preview.size() == batch.validation_preview.size());
+    for (std::size_t i = 0; i < batch.validation_preview.size(); ++i)
+    {
+        REQUIRE(stream.validation_preview[i].ts_ms == batch.validation_preview[i].ts_ms);
+        REQUIRE(stream.validation_preview[i].actual_delta == batch.validation_preview[i].actual_delta);
+        REQUIRE(stream.validation_preview[i].predicted_delta == Approx(batch.validation_preview[i].predicted_delta).margin(1e-9));
+    }
+    REQUIRE(stream.peak_rss_bytes > 0u);
+    REQUIRE(batch.peak_rss_bytes > 0u);
+
+    // Both modes write the same feature CSV.
+    const auto batch_features = std::filesystem::temp_directory_path() / "aiquant_features_batch.csv";
+    const auto stream_features = std::filesystem::temp_directory_path() / "aiquant_features_stream.csv";
+    cfg.features_output_path = stream_features.string();
+    REQUIRE(fin::app::run_scenario(cfg).features_saved);
+    cfg.mode = fin::app::ScenarioMode::Batch;
+    cfg.features_output_path = batch_features.string();
+    const auto saved = fin::app::run_scenario(cfg);
+    REQUIRE(saved.features_saved);
+    REQUIRE(saved.feature_schema->names() == fin::indicators::FeatureBus::schema()->names());
+    std::ifstream a(batch_features), b(stream_features);
+    std::string la, lb;
+    REQUIRE(std::getline(a, la));
+    REQUIRE(la == "ts_ms,close,ema_fast,rsi,macd,macd_signal,macd_hist");
+    std::size_t lines = 0;
+    for (std::getline(b, lb); std::getline(a, la); ++lines)
+    {
+        REQUIRE(std::getline(b, lb));
+        REQUIRE(la == lb);
+    }
+    REQUIRE_FALSE(std::getline(b, lb));
+    REQUIRE(lines == batch.feature_rows);
+    a.close();
+    b.close();
+    std::filesystem::remove(batch_features);
+    std::filesystem::remove(stream_features);
+    cfg.features_output_path.reset();
+    cfg.mode = fin::app::ScenarioMode::Streaming;
+
+    // An explicit split skips the counting pass.
+    cfg.stream_train_rows = 100;
+    const auto fixed = fin::app::run_scenario(cfg);
+    REQUIRE(fixed.training.samples == 100u);
+    REQUIRE(fixed.validation_samples == fixed.feature_rows - 101);
+
+    cfg.stream_train_rows = fixed.feature_rows;
+    bool threw = false;
+    try
+    {
+        fin::app::run_scenario(cfg);
+    }
+    catch (const std::runtime_error &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+
+    std::filesystem::remove(ticks);
+}
+
+TEST_CASE("load_scenario_file parses streaming mode", "[scenario][config]")
+{
+    auto path = scenario_test::write_temp_config("ticks = a.csv\nmode = streaming\ntrain_rows = 250\n");
+    fin::app::ScenarioConfig cfg{};
+    std::string error;
+    REQUIRE(fin::app::load_scenario_file(path.string(), cfg, error));
+    REQUIRE(cfg.mode == fin::app::ScenarioMode::Streaming);
+    REQUIRE(cfg.stream_train_rows == 250u);
+    std::filesystem::remove(path);
+
+    path = scenario_test::write_temp_config("ticks = a.csv\nmode = lazy\n");
+    REQUIRE_FALSE(fin::app::load_scenario_file(path.string(), cfg, error));
+    std::filesystem::remove(path);
+}
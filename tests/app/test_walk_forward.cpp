@@ -0,0 +1,106 @@
+#include "catch2_compat.hpp"
+
+#include <filesystem>
+#include <vector>
+
+#include "fin/app/ScenarioConfigIO.hpp"
+#include "fin/app/WalkForward.hpp"
+#include "fin/indicators/FeatureBus.hpp"
+#include "fin/ml/FeatureVector.hpp"
+#include "app/TestScenarioHelpers.hpp"
+
+TEST_CASE("Walk-forward plan rolls or anchors the training window", "[scenario][walkforward]")
+{
+    const auto rolling = fin::app::plan_walk_forward(100, 40, 25, false);
+    REQUIRE(rolling.size() == 3u);
+    REQUIRE(rolling[0].train_begin == 0u);
+    REQUIRE(rolling[0].train_end == 40u);
+    REQUIRE(rolling[0].test_end == 65u);
+    REQUIRE(rolling[1].train_begin == 25u);
+    REQUIRE(rolling[1].test_begin == 65u);
+    REQUIRE(rolling[2].test_begin == 90u);
+    REQUIRE(rolling[2].test_end == 100u);
+
+    const auto anchored = fin::app::plan_walk_forward(100, 40, 25, true);
+    REQUIRE(anchored.size() == 3u);
+    REQUIRE(anchored[2].train_begin == 0u);
+    REQUIRE(anchored[2].train_end == 90u);
+
+    REQUIRE(fin::app::plan_walk_forward(40, 40, 10, false).empty());
+}
+
+TEST_CASE("Walk-forward folds match batch fits and do not depend on threads", "[scenario][walkforward]")
+{
+    using namespace scenario_test;
+    const auto ticks = write_temp_ticks_csv(900);
+
+    fin::app::ScenarioConfig cfg{};
+    cfg.ticks_path = ticks.string();
+    const auto loaded = fin::app::load_scenario_candles(cfg);
+    const auto bars = loaded.candles.view();
+    const auto batch = fin::app::run_scenario_on_candles(cfg, bars);
+
+    // One anchored fold covering every remaining row is the batch split.
+    cfg.walk_forward_test = batch.feature_rows;
+    const auto single = fin::app::run_scenario_on_candles(cfg, bars);
+    REQUIRE(single.folds.size() == 1u);
+    REQUIRE(single.training.samples == batch.training.samples);
+    REQUIRE(single.validation_samples == batch.validation_samples);
+    REQUIRE(single.validation_rmse == Approx(batch.validation_rmse).margin(1e-9));
+
+    cfg.walk_forward_train = 200;
+    cfg.walk_forward_test = 150;
+    cfg.walk_forward_threads = 1;
+    const auto serial = fin::app::run_scenario_on_candles(cfg, bars);
+    cfg.walk_forward_threads = 4;
+    const auto parallel = fin::app::run_scenario_on_candles(cfg, bars);
+
+    REQUIRE(serial.folds.size() == parallel.folds.size());
+    REQUIRE(serial.folds.size() == (serial.feature_rows - 1 - 200 + 149) / 150);
+    REQUIRE(serial.validation_samples == serial.feature_rows - 1 - 200);
+    REQUIRE(serial.validation_rmse == parallel.validation_rmse);
+    REQUIRE(serial.metrics.final_cash == parallel.metrics.final_cash);
+
+    double pnl = 0.0;
+    for (std::size_t i = 0; i < serial.folds.size(); ++i)
+    {
+        const auto &f = serial.folds[i];
+        REQUIRE(f.train_end - f.train_begin == 200u);
+        REQUIRE(f.validation_rmse == parallel.folds[i].validation_rmse);
+        REQUIRE(f.metrics.pnl == parallel.folds[i].metrics.pnl);
+        REQUIRE(f.test_start_ms < f.test_end_ms);
+        pnl += f.metrics.pnl;
+    }
+    REQUIRE(serial.metrics.pnl == Approx(pnl).margin(1e-9));
+
+    // The slid accumulator of the last fold equals a fresh fit on its window.
+    fin::indicators::FeatureBus bus(cfg.ema_fast, cfg.rsi_period, cfg.macd_fast, cfg.macd_slow, cfg.macd_signal);
+    const auto rows = bus.update(bars);
+    const auto &last = serial.folds.back();
+    const std::vector<fin::indicators::FeatureRow> window(rows.begin() + static_cast<std::ptrdiff_t>(last.train_begin),
+                                                          rows.begin() + static_cast<std::ptrdiff_t>(last.train_end + 1));
+    const auto fresh = fin::ml::train_linear_from_feature_rows(window);
+    REQUIRE(serial.training.samples == fresh.samples);
+    // macd_hist = macd - macd_signal makes the weights ill-conditioned, so
+    // compare predictions, which are not.
+    for (std::size_t j = last.test_begin; j < last.test_end; j += 25)
+    {
+        const auto fv = fin::ml::FeatureVector::from_feature_row(rows[j]);
+        REQUIRE(serial.training.model.predict(fv) == Approx(fresh.model.predict(fv)).margin(1e-3));
+    }
+
+    std::filesystem::remove(ticks);
+}
+
+TEST_CASE("load_scenario_file parses walk-forward keys", "[scenario][config]")
+{
+    auto path = scenario_test::write_temp_config("ticks = a.csv\nwf_train = 500\nwalk_forward_test = 50\nwf_anchored = yes\nwf_threads = 2\n");
+    fin::app::ScenarioConfig cfg{};
+    std::string error;
+    REQUIRE(fin::app::load_scenario_file(path.string(), cfg, error));
+    REQUIRE(cfg.walk_forward_train == 500u);
+    REQUIRE(cfg.walk_forward_test == 50u);
+    REQUIRE(cfg.walk_forward_anchored);
+    REQUIRE(cfg.walk_forward_threads == 2u);
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,77 @@
+#include "catch2_compat.hpp"
+
+#include <chrono>
+#include <vector>
+
+#include "fin/core/CandleSeries.hpp"
+#include "fin/indicators/FeatureBus.hpp"
+#include "fin/indicators/SMA.hpp"
+
+using namespace fin::core;
+
+namespace
+{
+    std::vector<Candle> make_candles(std::size_t n)
+    {
+        std::vector<Candle> out;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double c = 100.0 + static_cast<double>(i % 13) - static_cast<double>(i % 5) * 0.5;
+            out.emplace_back(Timestamp(std::chrono::minutes(static_cast<long long>(i))), Price{c - 0.25}, Price{c + 1.0},
+                             Price{c - 1.0}, Price{c}, Volume{static_cast<double>(i + 1)});
+        }
+        return out;
+    }
+}
+
+TEST_CASE("CandleSeries stores candles column-wise and round-trips", "[CandleSeries]")
+{
+    const auto candles = make_candles(10);
+    CandleSeries s(candles);
+
+    REQUIRE(s.size() == 10u);
+    REQUIRE(s.close().size() == 10u);
+    REQUIRE(s.close()[3] == candles[3].close().value());
+    REQUIRE(s.volume()[9] == 10.0);
+    REQUIRE(s[4].same_bar(candles[4]));
+
+    const auto back = s.to_candles();
+    REQUIRE(back.size() == candles.size());
+    for (std::size_t i = 0; i < back.size(); ++i)
+        REQUIRE(back[i].same_bar(candles[i]));
+
+    const auto v = s.view().subview(7);
+    REQUIRE(v.size() == 3u);
+    REQUIRE(v.ts[0] == candles[7].start_time());
+    REQUIRE(v.candle(2).same_bar(candles[9]));
+    REQUIRE(s.view().subview(20).empty());
+    REQUIRE(s.view().subview(2, 3).high[2] == candles[4].high().value());
+}
+
+TEST_CASE("Series consumers match their per-candle counterparts", "[CandleSeries]")
+{
+    const auto candles = make_candles(80);
+    CandleSeries s(candles);
+
+    fin::indicators::FeatureBus a(5, 7, 4, 9, 3), b(5, 7, 4, 9, 3);
+    std::vector<fin::indicators::FeatureRow> expected;
+    for (const auto &c : candles)
+        if (auto row = a.update(c))
+            expected.push_back(*row);
+    const auto rows = b.update(s.view());
+
+    REQUIRE(rows.size() == expected.size());
+    REQUIRE(!rows.empty());
+    for (std::size_t i = 0; i < rows.size(); ++i)
+    {
+        REQUIRE(rows[i].ts == expected[i].ts);
+        REQUIRE(rows[i].macd_hist == expected[i].macd_hist);
+    }
+
+    std::vector<double> closes;
+    for (const auto &c : candles)
+        closes.push_back(c.close().value());
+    const auto from_vec = fin::indicators::SMA::compute(closes, 6);
+    const auto from_view = fin::indicators::SMA::compute(s.view().close, 6);
+    REQUIRE(from_vec == from_view);
+}
@@ -0,0 +1,106 @@
+#include "catch2_compat.hpp"
+
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+#include "fin/core/CandleSeries.hpp"
+#include "fin/core/FeatureMatrix.hpp"
+#include "fin/indicators/FeatureBus.hpp"
+#include "fin/ml/LinearTrainer.hpp"
+
+using namespace fin::core;
+
+TEST_CASE("FeatureSchema maps names to columns and rejects duplicates", "[FeatureMatrix]")
+{
+    const auto schema = FeatureSchema::make({"a", "b", "c"});
+    REQUIRE(schema->size() == 3u);
+    REQUIRE(schema->index_of("b").value() == 1u);
+    REQUIRE_FALSE(schema->index_of("z").has_value());
+
+    bool threw = false;
+    try
+    {
+        FeatureSchema dup({"a", "b", "a"});
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+}
+
+TEST_CASE("FeatureMatrix stores rows contiguously and slices them", "[FeatureMatrix]")
+{
+    FeatureMatrix m(FeatureSchema::make({"x", "y"}));
+    for (int i = 0; i < 5; ++i)
+    {
+        const std::vector<double> row = {static_cast<double>(i), 10.0 * i};
+        m.append(Timestamp(std::chrono::seconds(i)), row);
+    }
+    REQUIRE(m.rows() == 5u);
+    REQUIRE(m.cols() == 2u);
+    REQUIRE(m.values().size() == 10u);
+    REQUIRE(m.row(3)[1] == 30.0);
+
+    const auto v = m.view().subview(1, 3);
+    REQUIRE(v.rows() == 3u);
+    REQUIRE(v.at(0, 0) == 1.0);
+    REQUIRE(v.row(2)[1] == 30.0);
+    REQUIRE(v.ts[2] == Timestamp(std::chrono::seconds(3)));
+    REQUIRE(m.view().subview(4, 10).rows() == 1u);
+
+    bool threw = false;
+    try
+    {
+        const std::vector<double> narrow = {1.0};
+        m.append(Timestamp{}, narrow);
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+}
+
+TEST_CASE("FeatureBus appends the same rows into a FeatureMatrix", "[FeatureMatrix][features]")
+{
+    CandleSeries series;
+    for (int i = 0; i < 200; ++i)
+    {
+        const double c = 100.0 + (i % 17) * 0.3 - (i % 7) * 0.2;
+        series.push_back(Timestamp(std::chrono::minutes(i)), c, c + 0.5, c - 0.5, c, 1.0);
+    }
+
+    fin::indicators::FeatureBus row_bus, matrix_bus;
+    const auto rows = row_bus.update(series.view());
+    FeatureMatrix m(fin::indicators::FeatureBus::schema());
+    REQUIRE(matrix_bus.update(series.view(), m) == rows.size());
+    REQUIRE(m.schema() == fin::indicators::FeatureBus::schema());
+
+    for (std::size_t i = 0; i < rows.size(); ++i)
+    {
+        REQUIRE(m.ts()[i] == rows[i].ts);
+        const auto expected = fin::indicators::FeatureBus::row_values(rows[i]);
+        for (std::size_t j = 0; j < expected.size(); ++j)
+            REQUIRE(m.row(i)[j] == expected[j]);
+    }
+
+    const auto from_rows = fin::ml::train_linear_from_feature_rows(rows);
+    const auto from_matrix = fin::ml::train_linear_from_features(m.view());
+    REQUIRE(from_matrix.samples == from_rows.samples);
+    REQUIRE(from_matrix.mse == from_rows.mse);
+    REQUIRE(from_matrix.model.is_bound());
+
+    FeatureMatrix other(FeatureSchema::make({"close"}));
+    bool threw = false;
+    try
+    {
+        matrix_bus.update(series.view(), other);
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+}
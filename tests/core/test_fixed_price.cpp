@@ -0,0 +1,39 @@
+#include "catch2_compat.hpp"
+
+#include "fin/core/FixedPrice.hpp"
+#include "fin/core/Tick.hpp"
+
+using namespace fin::core;
+
+TEST_CASE("FixedPrice rounds to the nearest tick and compares exactly", "[FixedPrice]")
+{
+    const PriceScale cents{100};
+    auto a = FixedPrice::from_double(0.1 + 0.2, cents); // 0.30000000000000004
+    auto b = FixedPrice::from_double(0.3, cents);
+
+    REQUIRE(a == b);
+    REQUIRE(a.ticks() == 30);
+    REQUIRE((a + b).ticks() == 60);
+    REQUIRE((b - FixedPrice{31}).ticks() == -1);
+    REQUIRE(FixedPrice{29} < a);
+    REQUIRE(a.to_double(cents) == 0.3);
+
+    const PriceScale pips{100000};
+    REQUIRE(FixedPrice::from_double(1.23456, pips).ticks() == 123456);
+}
+
+TEST_CASE("Per-symbol price scale drives tick conversion", "[FixedPrice]")
+{
+    const Symbol eur("FIXEDTEST_EURUSD");
+    REQUIRE(price_scale(eur) == PriceScale{});
+
+    set_price_scale(eur, PriceScale{100000});
+    REQUIRE(price_scale(eur).ticks_per_unit == 100000);
+
+    Tick t{Timestamp{}, eur, Price{1.08125}, Volume{3.0}};
+    FixedTick f = to_fixed(t);
+    REQUIRE(f.price().ticks() == 108125);
+    REQUIRE(f.symbol() == eur);
+    REQUIRE(f.volume().value() == 3.0);
+    REQUIRE(to_double(f).price().value() == 1.08125);
+}
@@ -16,3 +16,21 @@ TEST_CASE("Price basic operations", "[Price]")
     REQUIRE(p1 == Price(100.0));
     REQUIRE(p2 < p1);
 }
+
+TEST_CASE("Price is a constexpr strong type with full arithmetic", "[Price]")
+{
+    static_assert(Price(2.0) * 3.0 == Price(6.0));
+    static_assert(0.5 * Price(4.0) == Price(2.0));
+    static_assert(Price(6.0) / 4.0 == Price(1.5));
+    static_assert(Price(6.0) / Price(4.0) == 1.5);
+    static_assert(-Price(1.0) < Price());
+    static_assert(Price(2.0) >= Price(2.0) && Price(3.0) > Price(2.0) && Price(1.0) != Price(2.0));
+
+    Price p(10.0);
+    p += Price(5.0);
+    p -= Price(3.0);
+    p *= 2.0;
+    p /= 4.0;
+    REQUIRE(p.value() == 6.0);
+    REQUIRE(p <= Price(6.0));
+}
@@ -0,0 +1,82 @@
+#include "catch2_compat.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "fin/core/DynamicRingBuffer.hpp"
+#include "fin/core/MonotonicDeque.hpp"
+
+using namespace fin::core;
+
+TEST_CASE("DynamicRingBuffer keeps FIFO order across wraparound", "[RingBuffer]")
+{
+    DynamicRingBuffer<int> buf(4);
+    REQUIRE(buf.capacity() == 4u);
+    REQUIRE(buf.empty());
+
+    for (int i = 0; i < 100; ++i)
+    {
+        buf.push_back(i);
+        if (buf.size() > 3)
+            buf.pop_front();
+        REQUIRE(buf.back() == i);
+        REQUIRE(buf.front() == std::max(0, i - 2));
+        for (std::size_t k = 0; k < buf.size(); ++k)
+            REQUIRE(buf[k] == buf.front() + static_cast<int>(k));
+    }
+    REQUIRE(buf.capacity() == 4u); // steady state never grows
+}
+
+TEST_CASE("DynamicRingBuffer grows only when full and preserves contents", "[RingBuffer]")
+{
+    DynamicRingBuffer<int> buf(3); // rounded up to a power of two
+    REQUIRE(buf.capacity() == 4u);
+
+    buf.push_back(1);
+    buf.push_back(2);
+    buf.pop_front();
+    for (int i = 3; i <= 9; ++i)
+        buf.push_back(i);
+
+    REQUIRE(buf.capacity() == 8u);
+    REQUIRE(buf.size() == 8u);
+    for (std::size_t k = 0; k < buf.size(); ++k)
+        REQUIRE(buf[k] == static_cast<int>(k) + 2);
+
+    buf.pop_back();
+    REQUIRE(buf.back() == 8);
+
+    DynamicRingBuffer<int> copy(buf);
+    buf.clear();
+    REQUIRE(buf.empty());
+    REQUIRE(copy.size() == 7u);
+    REQUIRE(copy.front() == 2);
+}
+
+TEST_CASE("Monotonic deques match brute-force rolling min and max", "[RingBuffer]")
+{
+    const std::size_t window = 7;
+    RollingMax<double> hi(window);
+    RollingMin<double> lo(window);
+
+    std::vector<double> xs;
+    unsigned state = 12345u;
+    for (std::size_t i = 0; i < 500; ++i)
+    {
+        state = state * 1103515245u + 12345u;
+        const double x = static_cast<double>((state >> 16) % 50);
+        xs.push_back(x);
+
+        hi.push(x, i);
+        lo.push(x, i);
+        const std::size_t start = i + 1 >= window ? i + 1 - window : 0;
+        hi.evict_before(start);
+        lo.evict_before(start);
+
+        const auto first = xs.begin() + static_cast<std::ptrdiff_t>(start);
+        REQUIRE(hi.front() == *std::max_element(first, xs.end()));
+        REQUIRE(lo.front() == *std::min_element(first, xs.end()));
+        REQUIRE(hi.size() <= window);
+    }
+}
@@ -0,0 +1,56 @@
+#include "catch2_compat.hpp"
+
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "fin/core/SymbolTable.hpp"
+#include "fin/core/Tick.hpp"
+
+using namespace fin::core;
+
+TEST_CASE("Symbols with the same name share one interned id", "[Symbol]")
+{
+    Symbol a("EURUSD");
+    Symbol b(std::string("EURUSD"));
+    Symbol c("GBPUSD");
+
+    REQUIRE(a == b);
+    REQUIRE(!(a == c));
+    REQUIRE(a.id() == b.id());
+    REQUIRE(a.value() == "EURUSD");
+    REQUIRE(Symbol::from_id(c.id()).value() == "GBPUSD");
+
+    std::unordered_set<Symbol> set{a, b, c};
+    REQUIRE(set.size() == 2u);
+
+    REQUIRE(Symbol{}.empty());
+    REQUIRE(Symbol{""} == Symbol{});
+    REQUIRE(Symbol{}.value().empty());
+}
+
+TEST_CASE("Symbol table interning is thread-safe", "[Symbol]")
+{
+    std::vector<std::uint32_t> ids(8);
+    std::vector<std::thread> pool;
+    for (std::size_t i = 0; i < ids.size(); ++i)
+        pool.emplace_back([&, i]
+                          {
+                              for (int k = 0; k < 200; ++k)
+                                  SymbolTable::instance().intern("SYM" + std::to_string(k));
+                              ids[i] = SymbolTable::instance().intern("SHARED_NAME"); });
+    for (auto &t : pool)
+        t.join();
+
+    for (auto id : ids)
+        REQUIRE(id == ids[0]);
+    REQUIRE(SymbolTable::instance().name(ids[0]) == "SHARED_NAME");
+}
+
+TEST_CASE("Tick is trivially copyable", "[Tick]")
+{
+    REQUIRE(std::is_trivially_copyable_v<Tick>);
+    REQUIRE(sizeof(Symbol) == sizeof(std::uint32_t));
+}
@@ -1,4 +1,5 @@
 #include "catch2_compat.hpp"
+#include "fin/core/Candle.hpp"
 #include "fin/core/Tick.hpp"
 
 using namespace fin::core;
@@ -17,3 +18,15 @@ TEST_CASE("Tick holds correct data", "[Tick]")
     REQUIRE(tick.price() == price);
     REQUIRE(tick.volume().value() == 200);
 }
+
+TEST_CASE("Tick and Candle accessors are usable in constant expressions", "[Tick]")
+{
+    constexpr Timestamp ts{std::chrono::seconds(60)};
+    constexpr Tick tick(ts, Symbol{}, Price(101.25), Volume(3.0));
+    static_assert(tick.price() == Price(101.25) && tick.volume() == Volume(3.0));
+
+    constexpr Candle bar(ts, Price(1.0), Price(3.0), Price(0.5), Price(2.0), Volume(10.0));
+    static_assert(bar.high() - bar.low() == Price(2.5));
+    static_assert(bar.same_bar(Candle(ts, Price(1.0), Price(3.0), Price(0.5), Price(2.0), Volume(1.0))));
+    REQUIRE(bar.close().value() == 2.0);
+}
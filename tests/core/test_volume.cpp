@@ -11,3 +11,16 @@ TEST_CASE("Volume operations", "[Volume]")
     REQUIRE((v1 + v2).value() == 25.0);
     REQUIRE(v1.value() == 10.0);
 }
+
+TEST_CASE("Volume arithmetic and comparisons are constexpr", "[Volume]")
+{
+    static_assert((Volume(4.0) - Volume(1.0)) * 2.0 == Volume(6.0));
+    static_assert(Volume(3.0) / Volume(2.0) == 1.5);
+    static_assert(Volume() < Volume(1.0));
+
+    Volume v(1.0);
+    v += Volume(2.0);
+    v *= 3.0;
+    REQUIRE(v.value() == 9.0);
+    REQUIRE(v > Volume(8.0));
+}
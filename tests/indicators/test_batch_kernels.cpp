@@ -0,0 +1,122 @@
+#include "catch2_compat.hpp"
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "fin/indicators/BollingerBands.hpp"
+#include "fin/indicators/EMA.hpp"
+#include "fin/indicators/SMA.hpp"
+#include "fin/indicators/ZScore.hpp"
+
+using namespace fin::indicators;
+
+namespace
+{
+    // Deterministic wiggly series with a drift, long enough to accumulate
+    // rounding in the running sums.
+    std::vector<double> series(std::size_t n)
+    {
+        std::vector<double> x(n);
+        for (std::size_t i = 0; i < n; ++i)
+            x[i] = 100.0 + 0.01 * static_cast<double>(i) + 3.0 * std::sin(0.37 * static_cast<double>(i)) +
+                   static_cast<double>(i % 7) * 0.125;
+        return x;
+    }
+
+    template <class Streaming>
+    void require_matches_streaming(const std::vector<double> &x, const std::vector<double> &out,
+                                   std::size_t from, Streaming ind)
+    {
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            auto v = ind.update(x[i]);
+            REQUIRE(v.has_value() == (i >= from));
+            if (v)
+                REQUIRE(out[i] == Approx(*v).margin(1e-9));
+            else
+                REQUIRE(std::isnan(out[i]));
+        }
+    }
+}
+
+TEST_CASE("SMA/EMA/ZScore batch kernels match the streaming classes", "[indicators][batch]")
+{
+    const auto x = series(5000);
+    std::vector<double> out(x.size()), scratch(x.size());
+
+    for (std::size_t p : {1u, 2u, 14u, 50u})
+    {
+        auto from = SMA::compute_into(x, out, p);
+        REQUIRE(from == p - 1);
+        require_matches_streaming(x, out, from, SMA(p));
+
+        from = EMA::compute_into(x, out, p);
+        REQUIRE(from == p - 1);
+        require_matches_streaming(x, out, from, EMA(p));
+
+        from = ZScore::compute_into(x, out, p);
+        REQUIRE(from == p - 1);
+        require_matches_streaming(x, out, from, ZScore(p));
+
+        from = ZScore::compute_into(x, out, scratch, p);
+        REQUIRE(from == p - 1);
+        require_matches_streaming(x, out, from, ZScore(p));
+    }
+}
+
+TEST_CASE("BollingerBands batch kernel matches the streaming class", "[indicators][batch]")
+{
+    const auto x = series(3000);
+    std::vector<double> mid(x.size()), up(x.size()), lo(x.size());
+
+    const auto from = BollingerBands::compute_into(x, mid, up, lo, 20, 2.5);
+    REQUIRE(from == 19u);
+
+    BollingerBands bb(20, 2.5);
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        auto b = bb.update(x[i]);
+        REQUIRE(b.has_value() == (i >= from));
+        if (!b)
+            continue;
+        REQUIRE(mid[i] == Approx(b->middle).margin(1e-9));
+        REQUIRE(up[i] == Approx(b->upper).margin(1e-9));
+        REQUIRE(lo[i] == Approx(b->lower).margin(1e-9));
+    }
+}
+
+TEST_CASE("Batch kernels report no valid output for short input and reject short buffers", "[indicators][batch]")
+{
+    const std::vector<double> x{1.0, 2.0, 3.0};
+    std::vector<double> out(3, 0.0);
+
+    REQUIRE(SMA::compute_into(x, out, 5) == x.size());
+    REQUIRE(std::isnan(out[2]));
+    REQUIRE(EMA::compute_into(x, out, 0) == x.size());
+    REQUIRE(SMA::compute_into(x, out, 3) == 2u);
+    REQUIRE(out[2] == Approx(2.0));
+
+    std::vector<double> small(2);
+    bool threw = false;
+    try
+    {
+        ZScore::compute_into(x, small, 2);
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+
+    threw = false;
+    try
+    {
+        ZScore::compute_into(x, out, small, 2);
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+}
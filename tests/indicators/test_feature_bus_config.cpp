@@ -0,0 +1,233 @@
+#include "catch2_compat.hpp"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+
+#include "fin/app/ScenarioConfigIO.hpp"
+#include "fin/app/ScenarioRunner.hpp"
+#include "fin/core/CandleSeries.hpp"
+#include "fin/indicators/DynamicFeatureBus.hpp"
+#include "fin/indicators/FeatureBus.hpp"
+#include "fin/indicators/FeatureSpec.hpp"
+#include "fin/indicators/StaticFeatureBus.hpp"
+#include "app/TestScenarioHelpers.hpp"
+
+using namespace fin::indicators;
+
+namespace
+{
+    fin::core::CandleSeries make_bars(std::size_t n)
+    {
+        fin::core::CandleSeries bars;
+        const auto t0 = fin::core::Timestamp{} + std::chrono::minutes(1);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double x = static_cast<double>(i);
+            const double close = 100.0 + 5.0 * std::sin(x * 0.1) + 0.01 * x;
+            bars.push_back(t0 + std::chrono::minutes(i), close - 0.2, close + 0.6, close - 0.7, close,
+                           1.0 + static_cast<double>(i % 7));
+        }
+        return bars;
+    }
+}
+
+TEST_CASE("Feature specs parse, name and round-trip", "[indicators][features]")
+{
+    auto ema = parse_feature_spec("ema:5");
+    REQUIRE(ema.has_value());
+    REQUIRE(ema->kind == FeatureKind::Ema);
+    REQUIRE(ema->name == "ema_5");
+    REQUIRE(ema->period(0) == 5);
+
+    auto bb = parse_feature_spec(" band=BBANDS:20:2.5 ");
+    REQUIRE(bb.has_value());
+    REQUIRE(bb->kind == FeatureKind::Bollinger);
+    REQUIRE(bb->params[1] == Approx(2.5));
+    REQUIRE((feature_columns(*bb) == std::vector<std::string>{"band", "band_upper", "band_lower"}));
+    REQUIRE(feature_columns(*parse_feature_spec("bbands:20:2.5"))[0] == "bbands_20_2p5");
+
+    auto macd = parse_feature_spec("macd");
+    REQUIRE((macd->params == std::vector<double>{12, 26, 9}));
+    REQUIRE(feature_columns(*macd).size() == 3);
+
+    for (const char *bad : {"", "foo", "ema:0", "ema:1.5", "ema:5:6", "macd:26:12", "bad name=ema", "rsi:x"})
+        REQUIRE_FALSE(parse_feature_spec(bad).has_value());
+    REQUIRE_FALSE(parse_feature_specs(" , ").has_value());
+    REQUIRE_FALSE(parse_feature_specs("close,nope").has_value());
+
+    const auto specs = parse_feature_specs("close, ema:5, slow=ema:30, stoch:9, bbands:20:2.5").value();
+    REQUIRE(specs.size() == 5);
+    for (const auto &s : specs)
+    {
+        const auto again = parse_feature_spec(to_string(s));
+        REQUIRE(again.has_value());
+        REQUIRE(again->kind == s.kind);
+        REQUIRE(again->name == s.name);
+        REQUIRE(again->params == s.params);
+    }
+    REQUIRE(to_string(specs[2]) == "slow=ema:30");
+
+    // Parameters print in shortest round-trip form and stay distinct.
+    REQUIRE(to_string(*parse_feature_spec("ema:1234567")) == "ema:1234567");
+    REQUIRE(parse_feature_spec(to_string(*parse_feature_spec("ema:1234567")))->period(0) == 1234567);
+    const auto fine_k = parse_feature_spec("bbands:20:2.0000001").value();
+    REQUIRE(fine_k.name == "bbands_20_2p0000001");
+    REQUIRE(parse_feature_spec(to_string(fine_k))->params == fine_k.params);
+
+    // Periods must fit comfortably in std::size_t.
+    for (const char *bad : {"ema:1e300", "ema:1e10", "rsi:inf", "bbands:20:inf", "zscore:nan"})
+        REQUIRE_FALSE(parse_feature_spec(bad).has_value());
+    REQUIRE(parse_feature_spec("ema:1e9").has_value());
+}
+
+TEST_CASE("Feature sets reject duplicate and misnamed columns", "[indicators][features]")
+{
+    // An alias must not take over the regression target's name.
+    REQUIRE_FALSE(parse_feature_spec("close=ema:5").has_value());
+    REQUIRE_FALSE(parse_feature_specs("close=ema:5, close").has_value());
+    REQUIRE(parse_feature_spec("close=close").has_value());
+
+    // Duplicate columns, direct or through an output suffix.
+    REQUIRE_FALSE(parse_feature_specs("close, ema:12, ema:12").has_value());
+    REQUIRE_FALSE(parse_feature_specs("close, ema_12=sma:5, ema:12").has_value());
+    REQUIRE_FALSE(parse_feature_specs("close, m_signal=ema:3, m=macd").has_value());
+    REQUIRE(parse_feature_specs("close, ema:12, ema:13").has_value());
+
+    // Specs built in code hit the same checks.
+    const std::vector<FeatureSpec> dup{{FeatureKind::Close, "close", {}}, {FeatureKind::Ema, "ema_12", {12}}, {FeatureKind::Ema, "ema_12", {12}}};
+    REQUIRE(feature_spec_error(dup).has_value());
+    bool threw = false;
+    try
+    {
+        DynamicFeatureBus bus(dup);
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+
+    const std::vector<FeatureSpec> fake_close{{FeatureKind::Ema, "close", {5}}, {FeatureKind::Close, "price", {}}};
+    REQUIRE(feature_spec_error(fake_close).has_value());
+    fin::app::ScenarioConfig cfg{};
+    cfg.ticks_path = "unused.csv";
+    cfg.features = fake_close;
+    threw = false;
+    try
+    {
+        fin::app::run_scenario_on_candles(cfg, make_bars(50).view());
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+}
+
+TEST_CASE("Static, dynamic and legacy feature buses agree", "[indicators][features]")
+{
+    const auto bars = make_bars(400);
+
+    // Default set: the dynamic bus reproduces FeatureBus rows exactly.
+    FeatureBus legacy;
+    DynamicFeatureBus dyn(default_feature_specs());
+    REQUIRE(dyn.schema()->names() == FeatureBus::schema()->names());
+    std::vector<double> row(dyn.width());
+    std::size_t rows = 0;
+    for (std::size_t i = 0; i < bars.size(); ++i)
+    {
+        const auto candle = bars.view().candle(i);
+        const auto expected = legacy.update(candle);
+        const bool ready = dyn.update(FeatureInput{candle.close().value(), candle.close().value(), candle.close().value(), 0.0}, row);
+        REQUIRE(ready == expected.has_value());
+        if (!ready)
+            continue;
+        ++rows;
+        const auto values = FeatureBus::row_values(*expected);
+        for (std::size_t c = 0; c < values.size(); ++c)
+            REQUIRE(row[c] == values[c]);
+    }
+    REQUIRE(rows > 300);
+
+    // A wider set, composed at compile time and at run time.
+    const auto specs = parse_feature_specs("close,atr:10,bbands:20:2,stoch:14:3,vwap,zscore,momentum:5,adx,sma:7").value();
+    DynamicFeatureBus wide(specs);
+    StaticFeatureBus<features::Close, features::Atr, features::Bollinger, features::Stoch, features::Vwap,
+                     features::ZScoreOf, features::MomentumOf, features::Adx, features::Sma>
+        fixed(wide.schema(), features::Close{}, features::Atr(10), features::Bollinger(20, 2.0), features::Stoch(14, 3),
+              features::Vwap{}, features::ZScoreOf(20), features::MomentumOf(5), features::Adx(14), features::Sma(7));
+    REQUIRE(fixed.width() == wide.width());
+    REQUIRE(wide.width() == 12);
+
+    fin::core::FeatureMatrix a(wide.schema()), b(wide.schema());
+    REQUIRE(fixed.update(bars.view(), a) == wide.update(bars.view(), b));
+    REQUIRE(a.rows() > 300);
+    REQUIRE(a.ts().front() == b.ts().front());
+    const auto av = a.values(), bv = b.values();
+    REQUIRE(av.size() == bv.size());
+    for (std::size_t i = 0; i < av.size(); ++i)
+        REQUIRE(av[i] == bv[i]);
+
+    // reset() starts both over.
+    fixed.reset();
+    typename decltype(fixed)::Row first{};
+    REQUIRE_FALSE(fixed.update(FeatureInput::from(bars.view(), 0), first));
+
+    bool threw = false;
+    try
+    {
+        fin::core::FeatureMatrix wrong(FeatureBus::schema());
+        wide.update(bars.view(), wrong);
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+}
+
+TEST_CASE("Scenario runs on a configured feature set", "[scenario][features]")
+{
+    using namespace scenario_test;
+    const auto ticks = write_temp_ticks_csv(600);
+    const auto config = write_temp_config("ticks = " + ticks.string() + "\nfeatures = close, fast=ema:5, rsi:7, atr, bbands\n");
+
+    fin::app::ScenarioConfig cfg{};
+    std::string error;
+    REQUIRE(fin::app::load_scenario_file(config.string(), cfg, error));
+    REQUIRE(cfg.features.size() == 5);
+    REQUIRE(cfg.features[1].name == "fast");
+
+    const auto batch = fin::app::run_scenario(cfg);
+    const std::vector<std::string> columns{"close", "fast", "rsi_7", "atr_14", "bbands_20_2", "bbands_20_2_upper", "bbands_20_2_lower"};
+    REQUIRE(batch.feature_schema->names() == columns);
+    REQUIRE(batch.training.model.is_bound());
+    REQUIRE(batch.validation_samples > 0);
+
+    cfg.mode = fin::app::ScenarioMode::Streaming;
+    const auto stream = fin::app::run_scenario(cfg);
+    REQUIRE(stream.feature_rows == batch.feature_rows);
+    REQUIRE(stream.validation_rmse == Approx(batch.validation_rmse).margin(1e-9));
+
+    // The close column is the regression target.
+    cfg.features = parse_feature_specs("ema:5,rsi").value();
+    bool threw = false;
+    try
+    {
+        fin::app::run_scenario(cfg);
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+
+    REQUIRE_FALSE(fin::app::load_scenario_file(write_temp_config("ticks = x.csv\nfeatures = ema:0\n").string(), cfg, error));
+
+    std::filesystem::remove(config);
+    std::filesystem::remove(ticks);
+}
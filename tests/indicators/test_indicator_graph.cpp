@@ -0,0 +1,134 @@
+#include "catch2_compat.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "fin/backtest/Backtester.hpp"
+#include "fin/core/CandleSeries.hpp"
+#include "fin/indicators/DynamicFeatureBus.hpp"
+#include "fin/indicators/EMA.hpp"
+#include "fin/indicators/IndicatorGraph.hpp"
+#include "fin/indicators/MACD.hpp"
+#include "fin/indicators/RSI.hpp"
+#include "fin/indicators/SMA.hpp"
+
+using namespace fin::indicators;
+
+namespace
+{
+    fin::core::CandleSeries make_bars(std::size_t n)
+    {
+        fin::core::CandleSeries bars;
+        const auto t0 = fin::core::Timestamp{} + std::chrono::minutes(1);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double x = static_cast<double>(i);
+            const double close = 100.0 + 4.0 * std::sin(x * 0.07) + 2.0 * std::sin(x * 0.31);
+            bars.push_back(t0 + std::chrono::minutes(i), close, close + 0.5, close - 0.5, close, 1.0);
+        }
+        return bars;
+    }
+}
+
+TEST_CASE("IndicatorGraph deduplicates identical nodes", "[indicators][graph]")
+{
+    IndicatorGraph g;
+    const auto ema12 = g.ema(12);
+    REQUIRE(g.ema(12) == ema12);
+    REQUIRE(g.ema(26) != ema12);
+    REQUIRE(g.rsi(14) == g.rsi(14));
+
+    // MACD reuses the EMA(12) above: only EMA(26) was new, plus line, signal, hist.
+    const std::size_t before = g.size();
+    const auto m = g.macd(12, 26, 9);
+    REQUIRE(g.size() == before + 3);
+    REQUIRE(g.macd(12, 26, 9).hist == m.hist);
+
+    // Default features plus a backtester's EMA(12), EMA(26), RSI(14): seven nodes
+    // (close, two EMAs, RSI, MACD line, signal, hist) instead of nine indicators.
+    IndicatorGraph shared;
+    DynamicFeatureBus bus(default_feature_specs(), shared);
+    const std::size_t feature_nodes = shared.size();
+    shared.ema(12);
+    shared.ema(26);
+    shared.rsi(14);
+    REQUIRE(shared.size() == feature_nodes);
+    REQUIRE(feature_nodes == 7);
+}
+
+TEST_CASE("IndicatorGraph values match the standalone indicators", "[indicators][graph]")
+{
+    const auto bars = make_bars(300);
+    IndicatorGraph g;
+    const auto e = g.ema(10);
+    const auto r = g.rsi(14);
+    const auto m = g.macd(12, 26, 9);
+    const auto smoothed = g.sma(5, e);
+
+    EMA ema(10), ema_for_sma(10);
+    RSI rsi(14);
+    MACD macd(12, 26, 9);
+    SMA sma(5);
+    for (std::size_t i = 0; i < bars.size(); ++i)
+    {
+        const double close = bars.view().close[i];
+        g.update(FeatureInput::from(bars.view(), i));
+
+        REQUIRE(g.get(e) == ema.update(close));
+        rsi.update(fin::core::Price(close));
+        REQUIRE(g.ready(r) == rsi.is_ready());
+        if (rsi.is_ready())
+            REQUIRE(g.value(r) == rsi.value());
+
+        const auto mv = macd.update(close);
+        REQUIRE(g.ready(m.hist) == mv.has_value());
+        if (mv)
+        {
+            REQUIRE(g.value(m.macd) == mv->macd);
+            REQUIRE(g.value(m.signal) == mv->signal);
+            REQUIRE(g.value(m.hist) == mv->hist);
+        }
+
+        std::optional<double> expected;
+        if (auto ev = ema_for_sma.update(close))
+            expected = sma.update(*ev);
+        REQUIRE(g.get(smoothed) == expected);
+    }
+
+    g.reset();
+    REQUIRE_FALSE(g.ready(e));
+    g.update(FeatureInput::from(bars.view(), 0));
+    REQUIRE(g.ready(g.close()));
+    REQUIRE_FALSE(g.ready(e));
+}
+
+TEST_CASE("Backtester reading a shared graph matches its own indicators", "[backtest][graph]")
+{
+    const auto bars = make_bars(2000);
+    fin::backtest::BacktestConfig cfg{};
+    cfg.ema_fast = 8;
+    cfg.ema_slow = 21;
+    cfg.rsi_period = 9;
+
+    fin::backtest::Backtester own(cfg);
+    fin::backtest::Backtester shared(cfg);
+    IndicatorGraph graph;
+    DynamicFeatureBus bus(default_feature_specs(8, 9), graph);
+    shared.share_indicators(graph);
+
+    std::vector<double> row(bus.width());
+    for (std::size_t i = 0; i < bars.size(); ++i)
+    {
+        const auto c = bars.view().candle(i);
+        own.on_candle(c);
+        bus.update(c, row);
+        shared.on_candle(c);
+    }
+    const auto a = own.finalize();
+    const auto b = shared.finalize();
+    REQUIRE(a.trades > 0);
+    REQUIRE(b.trades == a.trades);
+    REQUIRE(b.final_cash == a.final_cash);
+    REQUIRE(b.max_drawdown == a.max_drawdown);
+}
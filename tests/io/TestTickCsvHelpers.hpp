@@ -0,0 +1,69 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace tick_csv_test
+{
+    inline std::filesystem::path temp_path(const std::string &prefix, const std::string &suffix)
+    {
+        const auto ts = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        std::string filename = prefix + std::to_string(ts) + suffix;
+        return std::filesystem::temp_directory_path() / filename;
+    }
+
+    // Shape of a synthetic tick CSV. Row i is stamped start_ms + i * step_ms
+    // and cycles through the symbols, prices and volumes below; optional late
+    // rows and malformed lines exercise the drop and skip paths.
+    struct TickCsvSpec
+    {
+        std::size_t rows = 1000;
+        long long start_ms = 1693492800000LL;
+        long long step_ms = 1000;
+        std::vector<std::string> symbols{"ABC"}; // row i: symbols[i % size]
+        std::vector<double> price_base{100.0};   // per symbol, or one for all
+        std::size_t price_cycle = 37;            // price = base + (i % price_cycle) * price_step
+        double price_step = 0.25;
+        double volume_base = 1.0; // volume = volume_base + i % volume_cycle
+        std::size_t volume_cycle = 5;
+        std::size_t late_every = 0; // rows with i % late_every == late_offset are late_ms early; 0 => none
+        std::size_t late_offset = 0;
+        long long late_ms = 0;
+        std::size_t bad_every = 0; // malformed line after rows with i % bad_every == bad_offset; 0 => none
+        std::size_t bad_offset = 0;
+    };
+
+    inline std::filesystem::path write_temp_ticks_csv(const TickCsvSpec &spec, const std::string &prefix)
+    {
+        auto path = temp_path(prefix, ".csv");
+        std::ofstream out(path);
+        out << "Timestamp,symbol,price,volume\n";
+        for (std::size_t i = 0; i < spec.rows; ++i)
+        {
+            const std::size_t sym = i % spec.symbols.size();
+            long long ts = spec.start_ms + static_cast<long long>(i) * spec.step_ms;
+            if (spec.late_every && i % spec.late_every == spec.late_offset)
+                ts -= spec.late_ms;
+            const double price = spec.price_base[sym % spec.price_base.size()] +
+                                 static_cast<double>(i % spec.price_cycle) * spec.price_step;
+            const double volume = spec.volume_base + static_cast<double>(i % spec.volume_cycle);
+            out << ts << ',' << spec.symbols[sym] << ',' << price << ',' << volume << '\n';
+            if (spec.bad_every && i % spec.bad_every == spec.bad_offset)
+                out << "bad,row,x,y\n";
+        }
+        return path;
+    }
+
+    // Literal contents, written byte for byte (CRLF, missing trailing newline).
+    inline std::filesystem::path write_temp_csv(const std::string &prefix, const std::string &contents)
+    {
+        auto path = temp_path(prefix, ".csv");
+        std::ofstream out(path, std::ios::binary);
+        out << contents;
+        return path;
+    }
+}
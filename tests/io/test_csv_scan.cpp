@@ -0,0 +1,57 @@
+#include "catch2_compat.hpp"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "fin/io/CsvScan.hpp"
+
+using fin::io::ScanKernel;
+
+namespace
+{
+    std::vector<std::uint32_t> scan_with(ScanKernel k, const std::string &text, char delim)
+    {
+        std::vector<std::uint32_t> out(text.size() + 1);
+        const std::size_t n = fin::io::scan_function(k)(text.data(), text.size(), delim, out.data());
+        out.resize(n);
+        return out;
+    }
+}
+
+TEST_CASE("Scalar scanner reports every delimiter and newline offset", "[io][scan]")
+{
+    const std::string text = "ts,sym\n1,A\n";
+    auto offs = scan_with(ScanKernel::Scalar, text, ',');
+    REQUIRE((offs == std::vector<std::uint32_t>{2, 6, 8, 10}));
+}
+
+TEST_CASE("SIMD scanners agree with the scalar kernel at every length", "[io][scan]")
+{
+    std::mt19937 rng(1234);
+    const char alphabet[] = "0123456789.,;\nABC\r ";
+    for (std::size_t len = 0; len < 300; ++len)
+    {
+        std::string text(len, ' ');
+        for (auto &ch : text)
+            ch = alphabet[rng() % (sizeof(alphabet) - 1)];
+
+        for (char delim : {',', ';'})
+        {
+            const auto ref = scan_with(ScanKernel::Scalar, text, delim);
+            for (auto k : {ScanKernel::SSE2, ScanKernel::AVX2})
+            {
+                // Unsupported kernels fall back to scalar, so the check still holds.
+                REQUIRE(scan_with(k, text, delim) == ref);
+            }
+        }
+    }
+}
+
+TEST_CASE("Best kernel is always supported", "[io][scan]")
+{
+    REQUIRE(fin::io::scan_kernel_supported(fin::io::best_scan_kernel()));
+    REQUIRE(fin::io::scan_kernel_supported(ScanKernel::Scalar));
+    REQUIRE(std::string(fin::io::scan_kernel_name(ScanKernel::AVX2)) == "avx2");
+}
@@ -0,0 +1,149 @@
+#include "catch2_compat.hpp"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "fin/io/Sources.hpp"
+
+#include "io/TestTickCsvHelpers.hpp"
+
+namespace
+{
+    std::filesystem::path write_csv(const std::string &tag, const std::string &contents)
+    {
+        return tick_csv_test::write_temp_csv("aiquant_mmap_" + tag + "_", contents);
+    }
+
+    template <class Source>
+    std::vector<fin::core::Tick> drain(Source &src)
+    {
+        std::vector<fin::core::Tick> out;
+        while (auto t = src.next())
+            out.push_back(*t);
+        return out;
+    }
+}
+
+TEST_CASE("MmapTickSource matches FileTickSource on clean and malformed rows", "[io][mmap]")
+{
+    const auto path = write_csv("mixed",
+                                "Timestamp,symbol,price,volume\n"
+                                "1693492800000,ABC,100.0,1\n"
+                                " 1693492803000 ,ABC,101.5,2\r\n" // padded ts + CRLF
+                                "oops,ABC,1,1\n"                  // bad ts
+                                "1693492804000,ABC,abc,1\n"       // bad price
+                                "1693492805000,ABC,99.0\n"        // missing volume
+                                "\n"                              // empty line
+                                "-5,ABC,1,1\n"                    // negative ts
+                                "1693492806000,XYZ,98.5,3,extra\n"
+                                "1693492807000,XYZ,97.0,4"); // no trailing newline
+
+    fin::io::FileTickSource ref(path.string());
+    fin::io::MmapTickSource mm(path.string());
+    auto a = drain(ref);
+    auto b = drain(mm);
+
+    REQUIRE(a.size() == 4);
+    REQUIRE(b.size() == a.size());
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        REQUIRE(b[i].timestamp() == a[i].timestamp());
+        REQUIRE(b[i].symbol() == a[i].symbol());
+        REQUIRE(b[i].price() == a[i].price());
+        REQUIRE(b[i].volume().value() == a[i].volume().value());
+    }
+
+    REQUIRE(mm.stats().rows == ref.stats().rows);
+    REQUIRE(mm.stats().parsed == ref.stats().parsed);
+    REQUIRE(mm.stats().skipped == ref.stats().skipped);
+    REQUIRE(mm.stats().rows == 10);
+    REQUIRE(mm.stats().skipped == 5);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("MmapTickSource honours custom delimiter and reordered header", "[io][mmap]")
+{
+    const auto path = write_csv("semi",
+                                "volume;price;symbol;Timestamp\n"
+                                "7;10.5;ABC;1693492800000\n");
+    fin::io::TickCsvOptions opt{};
+    opt.delimiter = ';';
+    fin::io::MmapTickSource src(path.string(), opt);
+    auto t = src.next();
+    REQUIRE(t.has_value());
+    REQUIRE(t->symbol().value() == "ABC");
+    REQUIRE(t->price().value() == Approx(10.5));
+    REQUIRE(t->volume().value() == Approx(7.0));
+    REQUIRE_FALSE(src.next().has_value());
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("MmapTickSource without header parses the first line as data", "[io][mmap]")
+{
+    const auto path = write_csv("nohdr", "1693492800000,ABC,100.0,1\n1693492860000,ABC,101.0,2\n");
+    fin::io::TickCsvOptions opt{};
+    opt.has_header = false;
+    fin::io::MmapTickSource src(path.string(), opt);
+    auto ticks = drain(src);
+    REQUIRE(ticks.size() == 2);
+    REQUIRE(src.stats().rows == 2);
+    REQUIRE(src.stats().parsed == 2);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("MmapTickSource skips every row when the header lacks a column", "[io][mmap]")
+{
+    const auto path = write_csv("nocol", "Timestamp,symbol,price\n1693492800000,ABC,100.0\n");
+    fin::io::MmapTickSource src(path.string());
+    REQUIRE_FALSE(src.next().has_value());
+    REQUIRE(src.stats().skipped == 1);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("MmapTickSource yields nothing for missing and empty files", "[io][mmap]")
+{
+    fin::io::MmapTickSource missing("/nonexistent/aiquant_ticks.csv");
+    REQUIRE_FALSE(missing.next().has_value());
+    REQUIRE(missing.stats().rows == 0);
+
+    const auto path = write_csv("empty", "");
+    fin::io::MmapTickSource empty(path.string());
+    REQUIRE_FALSE(empty.next().has_value());
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("MmapTickSource handles rows spanning scanner blocks with every kernel", "[io][mmap][scan]")
+{
+    // ~200 KB so rows straddle several 64 KB scanner blocks.
+    std::string csv = "Timestamp,symbol,price,volume\n";
+    for (int i = 0; i < 8000; ++i)
+    {
+        csv += std::to_string(1693492800000LL + i * 250) + ",SYM" + std::to_string(i % 7) + "," +
+               std::to_string(100 + i % 50) + "." + std::to_string(i % 10) + "," + std::to_string(1 + i % 9) + "\n";
+        if (i % 997 == 0)
+            csv += "broken,row\n";
+    }
+    const auto path = write_csv("blocks", csv);
+
+    fin::io::FileTickSource ref(path.string());
+    const auto expected = drain(ref);
+    REQUIRE(expected.size() == 8000);
+
+    for (auto k : {fin::io::ScanKernel::Scalar, fin::io::ScanKernel::SSE2, fin::io::ScanKernel::AVX2})
+    {
+        fin::io::MmapTickSource mm(path.string(), {}, k);
+        const auto got = drain(mm);
+        REQUIRE(got.size() == expected.size());
+        for (std::size_t i = 0; i < got.size(); ++i)
+        {
+            REQUIRE(got[i].timestamp() == expected[i].timestamp());
+            REQUIRE(got[i].symbol() == expected[i].symbol());
+            REQUIRE(got[i].price() == expected[i].price());
+        }
+        REQUIRE(mm.stats().rows == ref.stats().rows);
+        REQUIRE(mm.stats().skipped == ref.stats().skipped);
+    }
+    std::filesystem::remove(path);
+}
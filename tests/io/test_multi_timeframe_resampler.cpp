@@ -0,0 +1,139 @@
+#include "catch2_compat.hpp"
+
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+#include "fin/app/ScenarioUtils.hpp"
+#include "fin/core/CandleSeries.hpp"
+#include "fin/io/MultiTimeframeResampler.hpp"
+#include "fin/io/Resampler.hpp"
+#include "fin/io/TickBatch.hpp"
+
+using namespace fin::io;
+
+namespace
+{
+    // ~3 hours of ticks with gaps (empty buckets) and a few late ticks.
+    std::vector<fin::core::Tick> make_ticks()
+    {
+        std::vector<fin::core::Tick> ticks;
+        const fin::core::Symbol sym("MTF");
+        long long ms = 1693492800000LL + 1234;
+        for (int i = 0; i < 20000; ++i)
+        {
+            ms += (i % 500 == 499) ? 400000 : 530;
+            const long long late = (i % 211 == 7) ? 2500 : 0;
+            ticks.emplace_back(fin::core::Timestamp(std::chrono::milliseconds(ms - late)), sym,
+                               fin::core::Price(100.0 + (i % 67) * 0.25 - (i % 13) * 0.5),
+                               fin::core::Volume(static_cast<double>(1 + i % 9)));
+        }
+        return ticks;
+    }
+
+    fin::core::CandleSeries direct(const std::vector<fin::core::Tick> &ticks, Timeframe tf)
+    {
+        TickToCandleResampler res(tf);
+        fin::core::CandleSeries out;
+        for (const auto &t : ticks)
+            res.update(t, out);
+        res.flush(out);
+        return out;
+    }
+
+    void require_same(const fin::core::CandleSeries &a, const fin::core::CandleSeries &b)
+    {
+        REQUIRE(a.size() == b.size());
+        const auto av = a.view(), bv = b.view();
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            REQUIRE(av.ts[i] == bv.ts[i]);
+            REQUIRE(av.open[i] == bv.open[i]);
+            REQUIRE(av.high[i] == bv.high[i]);
+            REQUIRE(av.low[i] == bv.low[i]);
+            REQUIRE(av.close[i] == bv.close[i]);
+            REQUIRE(av.volume[i] == bv.volume[i]); // integer sizes: exact
+        }
+    }
+}
+
+TEST_CASE("Cascading resampler matches one resampler per timeframe", "[io][multi_tf]")
+{
+    const auto ticks = make_ticks();
+
+    MultiTimeframeResampler per_tick({Timeframe::H1, Timeframe::M1, Timeframe::S5, Timeframe::M5, Timeframe::M1});
+    REQUIRE((per_tick.timeframes() == std::vector<Timeframe>{Timeframe::S5, Timeframe::M1, Timeframe::M5, Timeframe::H1}));
+    for (const auto &t : ticks)
+        per_tick.update(t);
+    per_tick.flush();
+
+    MultiTimeframeResampler batched({Timeframe::M1, Timeframe::M5, Timeframe::H1});
+    TickBatch batch(333);
+    for (const auto &t : ticks)
+    {
+        batch.push_back(t);
+        if (batch.full())
+        {
+            batched.update_batch(batch);
+            batch.clear();
+        }
+    }
+    batched.update_batch(batch);
+    batched.flush();
+
+    for (Timeframe tf : per_tick.timeframes())
+    {
+        const auto expected = direct(ticks, tf);
+        REQUIRE(expected.size() > 2);
+        require_same(per_tick.series(tf), expected);
+        if (tf != Timeframe::S5)
+            require_same(batched.series(tf), expected);
+    }
+}
+
+TEST_CASE("Cascading resampler take() and configuration errors", "[io][multi_tf]")
+{
+    const auto ticks = make_ticks();
+    const std::size_t half = ticks.size() / 2;
+
+    // Draining the lower series mid-stream does not disturb the levels above.
+    MultiTimeframeResampler res({Timeframe::M1, Timeframe::M5});
+    fin::core::CandleSeries m1;
+    for (std::size_t i = 0; i < ticks.size(); ++i)
+    {
+        res.update(ticks[i]);
+        if (i == half)
+            m1 = res.take(Timeframe::M1);
+    }
+    res.flush();
+    REQUIRE(m1.size() + res.series(Timeframe::M1).size() == direct(ticks, Timeframe::M1).size());
+    require_same(res.series(Timeframe::M5), direct(ticks, Timeframe::M5));
+
+    bool threw = false;
+    try
+    {
+        res.series(Timeframe::H1);
+    }
+    catch (const std::out_of_range &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+
+    threw = false;
+    try
+    {
+        MultiTimeframeResampler none(std::vector<Timeframe>{});
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+
+    const auto list = fin::app::parse_timeframe_list("M1, M5,H1");
+    REQUIRE(list.has_value());
+    REQUIRE((*list == std::vector<Timeframe>{Timeframe::M1, Timeframe::M5, Timeframe::H1}));
+    REQUIRE_FALSE(fin::app::parse_timeframe_list("M1,,H1").has_value());
+    REQUIRE_FALSE(fin::app::parse_timeframe_list("M1,X7").has_value());
+}
@@ -0,0 +1,111 @@
+#include "catch2_compat.hpp"
+
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "fin/io/Pipeline.hpp"
+
+#include "io/TestTickCsvHelpers.hpp"
+
+namespace
+{
+    // ~700 KB with a malformed row every 500 lines, so several 64 KB chunks
+    // each carry their own skipped rows.
+    std::filesystem::path write_large_ticks()
+    {
+        tick_csv_test::TickCsvSpec spec;
+        spec.rows = 25000;
+        spec.step_ms = 700;
+        spec.bad_every = 500;
+        return tick_csv_test::write_temp_ticks_csv(spec, "aiquant_parallel_");
+    }
+}
+
+TEST_CASE("Parallel ingest replays ticks in file order with exact stats", "[io][parallel]")
+{
+    const auto path = write_large_ticks();
+
+    fin::io::MmapTickSource seq(path.string());
+    std::vector<fin::core::Tick> expected;
+    while (auto t = seq.next())
+        expected.push_back(*t);
+
+    fin::io::ParallelIngestOptions popt{};
+    popt.threads = 4;
+    popt.chunk_bytes = 1; // clamped to the minimum chunk size
+    popt.max_chunks_in_flight = 2;
+
+    std::vector<fin::core::Tick> got;
+    std::size_t chunks = 0;
+    auto stats = fin::io::for_each_tick_chunk_parallel(path.string(), {}, popt, [&](const std::vector<fin::core::Tick> &ticks)
+                                                       {
+                                                           ++chunks;
+                                                           got.insert(got.end(), ticks.begin(), ticks.end()); });
+
+    REQUIRE(chunks > 4);
+    REQUIRE(got.size() == expected.size());
+    for (std::size_t i = 0; i < got.size(); ++i)
+        REQUIRE(got[i].timestamp() == expected[i].timestamp());
+
+    REQUIRE(stats.rows == seq.stats().rows);
+    REQUIRE(stats.parsed == seq.stats().parsed);
+    REQUIRE(stats.skipped == seq.stats().skipped);
+    REQUIRE(stats.skipped == 50);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Parallel resample matches the sequential pipeline", "[io][parallel][pipeline]")
+{
+    const auto path = write_large_ticks();
+
+    auto seq = fin::io::resample_csv_with_stats(path.string(), fin::io::Timeframe::M1);
+    fin::io::ParallelIngestOptions popt{};
+    popt.threads = 3;
+    auto par = fin::io::resample_csv_parallel_with_stats(path.string(), fin::io::Timeframe::M1, {}, popt);
+
+    REQUIRE(par.candles.size() == seq.candles.size());
+    for (std::size_t i = 0; i < par.candles.size(); ++i)
+    {
+        REQUIRE(par.candles[i].start_time() == seq.candles[i].start_time());
+        REQUIRE(par.candles[i].open() == seq.candles[i].open());
+        REQUIRE(par.candles[i].close() == seq.candles[i].close());
+        REQUIRE(par.candles[i].volume().value() == seq.candles[i].volume().value());
+    }
+    REQUIRE(par.stats.rows == seq.stats.rows);
+    REQUIRE(par.stats.parsed == seq.stats.parsed);
+    REQUIRE(par.stats.skipped == seq.stats.skipped);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Parallel ingest propagates sink exceptions and stops workers", "[io][parallel]")
+{
+    const auto path = write_large_ticks();
+    fin::io::ParallelIngestOptions popt{};
+    popt.threads = 4;
+    popt.chunk_bytes = 1;
+
+    std::size_t calls = 0;
+    auto sink = [&](const std::vector<fin::core::Tick> &)
+    {
+        if (++calls == 2)
+            throw std::runtime_error("sink failed");
+    };
+    const fin::io::TickCsvOptions opt{};
+    bool threw = false;
+    try
+    {
+        fin::io::for_each_tick_chunk_parallel(path.string(), opt, popt, sink);
+    }
+    catch (const std::runtime_error &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+    REQUIRE(calls == 2);
+
+    std::filesystem::remove(path);
+}
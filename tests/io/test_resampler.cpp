@@ -171,3 +171,32 @@ TEST_CASE("Aggregates volume & extremes correctly with many ticks", "[io][resamp
     REQUIRE(b.close().value() == Approx(100.1)); // last price within the minute
     REQUIRE(b.volume().value() == Approx(4.0));  // 0.5+1.2+0.3+2.0+0.0
 }
+
+TEST_CASE("Resampler appends into a CandleSeries like the optional path", "[io][resampler]")
+{
+    io::TickToCandleResampler a(io::Timeframe::M1), b(io::Timeframe::M1);
+    std::vector<core::Candle> expected;
+    core::CandleSeries series;
+
+    for (int i = 0; i < 300; ++i)
+    {
+        const auto t = mk_tick(1693492800000LL + i * 1100LL, 100.0 + (i % 9) * 0.5, 1.0 + i % 4);
+        if (auto c = a.update(t))
+            expected.push_back(*c);
+        const std::size_t before = series.size();
+        const bool appended = b.update(t, series);
+        REQUIRE(appended == (series.size() == before + 1));
+        REQUIRE(series.size() == expected.size());
+    }
+    if (auto c = a.flush())
+        expected.push_back(*c);
+    REQUIRE(b.flush(series));
+    REQUIRE_FALSE(b.flush(series));
+
+    REQUIRE(series.size() == expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        REQUIRE(series[i].same_bar(expected[i]));
+        REQUIRE(series.volume()[i] == Approx(expected[i].volume().value()));
+    }
+}
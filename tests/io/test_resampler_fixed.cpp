@@ -0,0 +1,69 @@
+#include "catch2_compat.hpp"
+
+#include <chrono>
+#include <vector>
+
+#include "fin/io/Resampler.hpp"
+
+using namespace fin;
+
+namespace
+{
+    core::Timestamp ts_ms(long long ms)
+    {
+        return core::Timestamp(std::chrono::nanoseconds{ms * 1'000'000LL});
+    }
+}
+
+TEST_CASE("Fixed-price resampler matches the double resampler on tick-aligned prices", "[io][resampler][fixed]")
+{
+    const core::Symbol sym("FIXEDTEST_ABC");
+    const core::PriceScale scale{100};
+    core::set_price_scale(sym, scale);
+
+    io::TickToCandleResampler rd(io::Timeframe::M1);
+    io::FixedTickToCandleResampler rf(io::Timeframe::M1);
+    std::vector<core::Candle> dc;
+    std::vector<core::FixedCandle> fc;
+
+    for (int i = 0; i < 600; ++i)
+    {
+        const core::Tick t{ts_ms(1693492800000LL + i * 700LL), sym, core::Price{100.0 + (i % 23) * 0.01}, core::Volume{1.0 + i % 3}};
+        if (auto c = rd.update(t))
+            dc.push_back(*c);
+        if (auto c = rf.update(core::to_fixed(t)))
+            fc.push_back(*c);
+    }
+    if (auto c = rd.flush())
+        dc.push_back(*c);
+    if (auto c = rf.flush())
+        fc.push_back(*c);
+
+    REQUIRE(dc.size() == fc.size());
+    REQUIRE(dc.size() == 7u); // 600 ticks * 0.7 s = 7 minutes
+    for (std::size_t i = 0; i < dc.size(); ++i)
+    {
+        const auto back = core::to_double(fc[i], scale);
+        REQUIRE(back.same_bar(dc[i]));
+        REQUIRE(back.volume().value() == dc[i].volume().value());
+        REQUIRE(fc[i].high().ticks() == core::FixedPrice::from_double(dc[i].high().value(), scale).ticks());
+    }
+}
+
+TEST_CASE("Fixed-price resampler keeps the out-of-order drop policy", "[io][resampler][fixed]")
+{
+    const core::Symbol sym("FIXEDTEST_ABC");
+    io::FixedTickToCandleResampler r(io::Timeframe::M1);
+
+    REQUIRE(!r.update({ts_ms(1000), sym, core::FixedPrice{10000}, core::Volume{1.0}}));
+    REQUIRE(!r.update({ts_ms(500), sym, core::FixedPrice{99999}, core::Volume{1.0}})); // dropped
+    REQUIRE(!r.update({ts_ms(2000), sym, core::FixedPrice{9990}, core::Volume{2.0}}));
+
+    auto c = r.flush();
+    REQUIRE(c.has_value());
+    REQUIRE(c->open().ticks() == 10000);
+    REQUIRE(c->high().ticks() == 10000);
+    REQUIRE(c->low().ticks() == 9990);
+    REQUIRE(c->close().ticks() == 9990);
+    REQUIRE(c->volume().value() == 3.0);
+}
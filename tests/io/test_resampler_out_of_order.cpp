@@ -3,7 +3,12 @@
 #include "fin/io/Resampler.hpp"
 #include "fin/core/Tick.hpp"
 #include "fin/core/Candle.hpp"
+#include "fin/core/CandleSeries.hpp"
+#include "fin/io/TickBatch.hpp"
+#include <algorithm>
 #include <chrono>
+#include <stdexcept>
+#include <vector>
 using namespace fin;
 
 static core::Timestamp ts_ms(long long ms)
@@ -48,3 +53,144 @@ TEST_CASE("Out-of-order ticks are ignored (MVP)", "[io][resampler][ooo]")
     REQUIRE(to_ms(c1->start_time()) == 1693492860000LL);
     REQUIRE(c1->open().value() == Approx(102.0));
 }
+
+TEST_CASE("Late ticks are counted when dropped", "[io][resampler][ooo]")
+{
+    io::TickToCandleResampler R(io::Timeframe::M1);
+    R.update(tk(1693492801000LL, 100.0));
+    R.update(tk(1693492800500LL, 50.0));
+    R.update(tk(1693492801000LL, 101.0)); // same timestamp is not late
+    REQUIRE(R.late_stats().dropped == 1);
+    REQUIRE(R.late_stats().merged == 0);
+
+    bool threw = false;
+    try
+    {
+        io::TickToCandleResampler bad(io::Timeframe::M1, std::chrono::milliseconds(-1));
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+}
+
+TEST_CASE("Watermark mode merges ticks within the lateness bound", "[io][resampler][ooo]")
+{
+    io::TickToCandleResampler R(io::Timeframe::M1, std::chrono::seconds(2));
+
+    R.update(tk(1693492800000LL, 100.0));
+    R.update(tk(1693492801000LL, 101.0));
+    R.update(tk(1693492800500LL, 50.0)); // 0.5 s late -> merged, new low
+    REQUIRE_FALSE(R.update(tk(1693492860000LL, 102.0)).has_value()); // watermark 12:00:58
+    R.update(tk(1693492859000LL, 99.0));                             // late, closes the 12:00 bar
+    R.update(tk(1693492857000LL, 98.0));                             // 3 s late -> dropped
+
+    auto c0 = R.update(tk(1693492862000LL, 103.0)); // watermark 12:01:00 passes the 12:00 bar
+    REQUIRE(c0.has_value());
+    REQUIRE(to_ms(c0->start_time()) == 1693492800000LL);
+    REQUIRE(c0->open().value() == Approx(100.0));
+    REQUIRE(c0->high().value() == Approx(101.0));
+    REQUIRE(c0->low().value() == Approx(50.0));
+    REQUIRE(c0->close().value() == Approx(99.0));
+    REQUIRE(c0->volume().value() == Approx(4.0));
+    REQUIRE(R.late_stats().merged == 2);
+    REQUIRE(R.late_stats().dropped == 1);
+
+    R.update(tk(1693492861000LL, 97.0)); // late into the open 12:01 bar
+    auto c1 = R.flush();
+    REQUIRE(c1.has_value());
+    REQUIRE(c1->open().value() == Approx(102.0));
+    REQUIRE(c1->close().value() == Approx(103.0));
+    REQUIRE(c1->low().value() == Approx(97.0));
+    REQUIRE_FALSE(R.flush().has_value());
+}
+
+TEST_CASE("Watermark mode equals resampling the time-sorted ticks", "[io][resampler][ooo]")
+{
+    // Arrival order = order of ts + delay with delay < bound, so nothing is dropped.
+    const long long bound_ms = 1500;
+    struct Arrival
+    {
+        core::Tick tick;
+        long long at;
+    };
+    std::vector<Arrival> arrivals;
+    long long ms = 1693492800000LL;
+    for (int i = 0; i < 30000; ++i)
+    {
+        ms += (i % 700 == 699) ? 95000 : 37 + (i % 5) * 11; // gaps leave empty buckets
+        const long long delay = (i * 7919) % bound_ms;
+        arrivals.push_back({tk(ms, 100.0 + (i % 53) * 0.5 - (i % 7), 1.0 + i % 4), ms + delay});
+    }
+    std::stable_sort(arrivals.begin(), arrivals.end(), [](const Arrival &a, const Arrival &b)
+                     { return a.at < b.at; });
+    std::vector<core::Tick> ticks;
+    for (const auto &a : arrivals)
+        ticks.push_back(a.tick);
+    auto sorted = ticks;
+    std::stable_sort(sorted.begin(), sorted.end(), [](const core::Tick &a, const core::Tick &b)
+                     { return a.timestamp() < b.timestamp(); });
+
+    for (const auto tf : {io::Timeframe::S1, io::Timeframe::S5, io::Timeframe::M1})
+    {
+        io::TickToCandleResampler ordered(tf);
+        core::CandleSeries expected;
+        for (const auto &t : sorted)
+            ordered.update(t, expected);
+        ordered.flush(expected);
+        REQUIRE(ordered.late_stats().dropped == 0);
+
+        io::TickToCandleResampler per_tick(tf, std::chrono::milliseconds(bound_ms));
+        core::CandleSeries got;
+        for (const auto &t : ticks)
+            per_tick.update(t, got);
+        per_tick.flush(got);
+        REQUIRE(per_tick.late_stats().dropped == 0);
+        REQUIRE(per_tick.late_stats().merged > 0);
+
+        io::TickToCandleResampler batched(tf, std::chrono::milliseconds(bound_ms));
+        core::CandleSeries got_batched;
+        io::TickBatch batch(777);
+        for (const auto &t : ticks)
+        {
+            batch.push_back(t);
+            if (batch.full())
+            {
+                batched.update_batch(batch, got_batched);
+                batch.clear();
+            }
+        }
+        batched.update_batch(batch, got_batched);
+        batched.flush(got_batched);
+        REQUIRE(batched.late_stats().merged == per_tick.late_stats().merged);
+
+        io::TickToCandleResampler candles(tf, std::chrono::milliseconds(bound_ms));
+        std::vector<core::Candle> got_candles;
+        for (const auto &t : ticks)
+            if (auto c = candles.update(t))
+                got_candles.push_back(*c);
+        while (auto c = candles.flush())
+            got_candles.push_back(*c);
+
+        REQUIRE(got.size() == expected.size());
+        REQUIRE(got_batched.size() == expected.size());
+        REQUIRE(got_candles.size() == expected.size());
+        const auto e = expected.view(), a = got.view(), b = got_batched.view();
+        for (std::size_t i = 0; i < e.size(); ++i)
+        {
+            REQUIRE(a.ts[i] == e.ts[i]);
+            REQUIRE(a.open[i] == e.open[i]);
+            REQUIRE(a.high[i] == e.high[i]);
+            REQUIRE(a.low[i] == e.low[i]);
+            REQUIRE(a.close[i] == e.close[i]);
+            REQUIRE(a.volume[i] == e.volume[i]); // integer sizes: exact
+            REQUIRE(b.ts[i] == e.ts[i]);
+            REQUIRE(b.close[i] == e.close[i]);
+            REQUIRE(b.volume[i] == e.volume[i]);
+            REQUIRE(got_candles[i].start_time() == e.ts[i]);
+            REQUIRE(got_candles[i].open().value() == e.open[i]);
+            REQUIRE(got_candles[i].close().value() == e.close[i]);
+        }
+    }
+}
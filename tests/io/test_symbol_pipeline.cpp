@@ -0,0 +1,153 @@
+#include "catch2_compat.hpp"
+
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "fin/core/SymbolMap.hpp"
+#include "fin/indicators/DynamicFeatureBus.hpp"
+#include "fin/indicators/FeatureSpec.hpp"
+#include "fin/io/Pipeline.hpp"
+#include "fin/io/SymbolPipeline.hpp"
+
+#include "io/TestTickCsvHelpers.hpp"
+
+namespace
+{
+    // Three symbols interleaved tick by tick, each with its own price level,
+    // plus a malformed row now and then.
+    std::filesystem::path write_interleaved_ticks(std::size_t rows_per_symbol)
+    {
+        tick_csv_test::TickCsvSpec spec;
+        spec.rows = rows_per_symbol * 3;
+        spec.step_ms = 333;
+        spec.symbols = {"EURUSD", "AAPL", "BTCUSD"};
+        spec.price_base = {1.1, 190.0, 30000.0};
+        spec.price_step = 0.01;
+        spec.bad_every = 3000; // after every 1000th round of the three symbols
+        spec.bad_offset = 2;
+        return tick_csv_test::write_temp_ticks_csv(spec, "aiquant_multi_");
+    }
+
+    std::vector<fin::core::Tick> ticks_of(const std::string &path, const fin::core::Symbol &sym)
+    {
+        fin::io::MmapTickSource src(path);
+        std::vector<fin::core::Tick> out;
+        while (auto t = src.next())
+            if (t->symbol() == sym)
+                out.push_back(*t);
+        return out;
+    }
+}
+
+TEST_CASE("SymbolMap keys state by interned id in first-seen order", "[core][symbol]")
+{
+    fin::core::SymbolMap<int> m;
+    const fin::core::Symbol a("SYMMAP_A"), b("SYMMAP_B");
+    REQUIRE(m.find(a) == nullptr);
+    m[b] = 2;
+    m.try_emplace(a, 1) += 10;
+    m.try_emplace(b, 99); // existing entry untouched
+    REQUIRE(m.size() == 2u);
+    REQUIRE(*m.find(a) == 11);
+    REQUIRE(*m.find(b) == 2);
+    REQUIRE(m.begin()->first == b);
+    REQUIRE(m.find(fin::core::Symbol("SYMMAP_C")) == nullptr);
+}
+
+TEST_CASE("Multi-symbol pipeline resamples each symbol separately", "[io][pipeline][symbols]")
+{
+    const auto path = write_interleaved_ticks(3000);
+
+    auto res = fin::io::resample_by_symbol(path.string(), fin::io::Timeframe::M1);
+    REQUIRE(res.symbols.size() == 3u);
+    REQUIRE(res.symbols[0].symbol.value() == "AAPL");
+    REQUIRE(res.symbols[2].symbol.value() == "EURUSD");
+    REQUIRE(res.stats.parsed == 9000u);
+    REQUIRE(res.stats.skipped == 3u);
+
+    for (const auto &s : res.symbols)
+    {
+        // Same candles as resampling that symbol's ticks on their own.
+        fin::io::TickToCandleResampler single(fin::io::Timeframe::M1);
+        fin::core::CandleSeries expected;
+        const auto ticks = ticks_of(path.string(), s.symbol);
+        for (const auto &t : ticks)
+            single.update(t, expected);
+        single.flush(expected);
+
+        REQUIRE(s.ticks == ticks.size());
+        REQUIRE(s.candles.size() == expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            REQUIRE(s.candles[i].start_time() == expected[i].start_time());
+            REQUIRE(s.candles[i].high() == expected[i].high());
+            REQUIRE(s.candles[i].volume().value() == expected[i].volume().value());
+        }
+    }
+
+    const auto *btc = res.find(fin::core::Symbol("BTCUSD"));
+    REQUIRE(btc != nullptr);
+    REQUIRE(btc->candles[0].low().value() >= 30000.0);
+    REQUIRE(res.find(fin::core::Symbol("MISSING")) == nullptr);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Partitioned multi-symbol pipeline matches the sequential one", "[io][pipeline][symbols][parallel]")
+{
+    const auto path = write_interleaved_ticks(20000);
+
+    const auto seq = fin::io::resample_by_symbol(path.string(), fin::io::Timeframe::M1);
+    fin::io::SymbolPipelineOptions sopt{};
+    sopt.ingest_threads = 2;
+    sopt.partition_threads = 3;
+    sopt.max_batches_queued = 1;
+    const auto par = fin::io::resample_by_symbol(path.string(), fin::io::Timeframe::M1, {}, sopt);
+
+    REQUIRE(par.symbols.size() == seq.symbols.size());
+    REQUIRE(par.stats.parsed == seq.stats.parsed);
+    REQUIRE(par.stats.skipped == seq.stats.skipped);
+    for (std::size_t s = 0; s < seq.symbols.size(); ++s)
+    {
+        REQUIRE(par.symbols[s].symbol == seq.symbols[s].symbol);
+        REQUIRE(par.symbols[s].ticks == seq.symbols[s].ticks);
+        REQUIRE(par.symbols[s].candles.size() == seq.symbols[s].candles.size());
+        for (std::size_t i = 0; i < seq.symbols[s].candles.size(); ++i)
+            REQUIRE(par.symbols[s].candles.close()[i] == seq.symbols[s].candles.close()[i]);
+    }
+
+    REQUIRE_FALSE(par.symbols[0].features.has_value());
+
+    // Per-symbol feature rows built on the partition workers.
+    sopt.features = fin::indicators::parse_feature_specs("close, ema:5, rsi:7, macd").value();
+    const auto feat = fin::io::resample_by_symbol(path.string(), fin::io::Timeframe::M1, {}, sopt);
+    REQUIRE(feat.symbols.size() == seq.symbols.size());
+    for (const auto &s : feat.symbols)
+    {
+        REQUIRE(s.features.has_value());
+        fin::indicators::DynamicFeatureBus bus(sopt.features);
+        fin::core::FeatureMatrix expected(bus.schema());
+        bus.update(s.candles.view(), expected);
+        REQUIRE(expected.rows() > 0u);
+        REQUIRE(s.features->rows() == expected.rows());
+        REQUIRE((s.features->schema()->names() == expected.schema()->names()));
+        for (std::size_t i = 0; i < expected.values().size(); ++i)
+            REQUIRE(s.features->values()[i] == expected.values()[i]);
+    }
+
+    sopt.features = {{fin::indicators::FeatureKind::Close, "close", {}}, {fin::indicators::FeatureKind::Close, "close", {}}};
+    bool threw = false;
+    try
+    {
+        fin::io::resample_by_symbol(path.string(), fin::io::Timeframe::M1, {}, sopt);
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,154 @@
+#include "catch2_compat.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+
+#include "fin/core/CandleSeries.hpp"
+#include "fin/io/Resampler.hpp"
+#include "fin/io/Sources.hpp"
+#include "fin/io/TickBatch.hpp"
+#include "fin/io/TickStore.hpp"
+
+#include "io/TestTickCsvHelpers.hpp"
+
+namespace
+{
+    // Several S5 buckets, a few late ticks (dropped by the resampler) and a malformed row.
+    std::filesystem::path write_ticks_csv()
+    {
+        tick_csv_test::TickCsvSpec spec;
+        spec.rows = 2000;
+        spec.step_ms = 700;
+        spec.symbols = {"XYZ", "ABC", "ABC", "ABC", "ABC"};
+        spec.late_every = 97;
+        spec.late_offset = 13;
+        spec.late_ms = 3000;
+        spec.bad_every = spec.rows;
+        spec.bad_offset = 1200;
+        return tick_csv_test::write_temp_ticks_csv(spec, "aiquant_batch_");
+    }
+
+    // Per-tick reference: next() + update(t, series).
+    template <class Source>
+    fin::core::CandleSeries resample_per_tick(Source &src)
+    {
+        fin::io::TickToCandleResampler res(fin::io::Timeframe::S5);
+        fin::core::CandleSeries out;
+        while (auto t = src.next())
+            res.update(*t, out);
+        res.flush(out);
+        return out;
+    }
+
+    fin::core::CandleSeries resample_batched(fin::io::ITickSource &src, std::size_t capacity)
+    {
+        fin::io::TickToCandleResampler res(fin::io::Timeframe::S5);
+        fin::core::CandleSeries out;
+        fin::io::TickBatch batch(capacity);
+        while (src.next_batch(batch))
+            res.update_batch(batch, out);
+        res.flush(out);
+        return out;
+    }
+
+    void require_same(const fin::core::CandleSeries &a, const fin::core::CandleSeries &b)
+    {
+        REQUIRE(a.size() == b.size());
+        const auto av = a.view(), bv = b.view();
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            REQUIRE(av.ts[i] == bv.ts[i]);
+            REQUIRE(av.open[i] == bv.open[i]);
+            REQUIRE(av.high[i] == bv.high[i]);
+            REQUIRE(av.low[i] == bv.low[i]);
+            REQUIRE(av.close[i] == bv.close[i]);
+            REQUIRE(av.volume[i] == bv.volume[i]);
+        }
+    }
+
+    void require_same(const fin::io::ReadStats &a, const fin::io::ReadStats &b)
+    {
+        REQUIRE(a.rows == b.rows);
+        REQUIRE(a.parsed == b.parsed);
+        REQUIRE(a.skipped == b.skipped);
+    }
+}
+
+TEST_CASE("TickBatch fills to capacity and rebuilds ticks", "[io][batch]")
+{
+    fin::io::TickBatch batch(2);
+    REQUIRE(batch.empty());
+    const fin::core::Tick t(fin::core::Timestamp(std::chrono::seconds(5)), fin::core::Symbol("ABC"),
+                            fin::core::Price(101.5), fin::core::Volume(3.0));
+    batch.push_back(t);
+    batch.push_back(t.timestamp(), t.symbol(), 102.0, 1.0);
+    REQUIRE(batch.full());
+    REQUIRE(batch.size() == 2);
+    REQUIRE(batch.tick(0).price().value() == 101.5);
+    REQUIRE(batch.tick(1).symbol() == t.symbol());
+    REQUIRE(batch.volume()[1] == 1.0);
+    batch.clear();
+    REQUIRE(batch.empty());
+    REQUIRE(batch.capacity() == 2);
+
+    bool threw = false;
+    try
+    {
+        fin::io::TickBatch zero(0);
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+}
+
+TEST_CASE("Batched sources and update_batch match the per-tick path", "[io][batch]")
+{
+    const auto csv = write_ticks_csv();
+    const auto store = tick_csv_test::temp_path("aiquant_batch_store_", ".aqt");
+    {
+        fin::io::MmapTickSource src(csv.string());
+        fin::io::TickStoreWriter w(store.string(), 64);
+        while (auto t = src.next())
+            w.append(*t);
+        w.finish();
+    }
+
+    // Odd capacities so batches straddle buckets, store blocks and the late ticks.
+    for (std::size_t capacity : {1u, 37u, 4096u})
+    {
+        {
+            fin::io::FileTickSource a(csv.string()), b(csv.string());
+            const auto ref = resample_per_tick(a);
+            REQUIRE(ref.size() > 200);
+            require_same(ref, resample_batched(b, capacity));
+            require_same(a.stats(), b.stats());
+            REQUIRE(b.stats().skipped == 1);
+        }
+        {
+            fin::io::MmapTickSource a(csv.string()), b(csv.string());
+            require_same(resample_per_tick(a), resample_batched(b, capacity));
+            require_same(a.stats(), b.stats());
+        }
+        {
+            fin::io::TickStoreSource a(store.string()), b(store.string());
+            require_same(resample_per_tick(a), resample_batched(b, capacity));
+            require_same(a.stats(), b.stats());
+        }
+    }
+
+    // next() and next_batch() share one read position.
+    fin::io::TickStoreSource mixed(store.string());
+    REQUIRE(mixed.next().has_value());
+    fin::io::TickBatch batch(10);
+    REQUIRE(mixed.next_batch(batch) == 10);
+    fin::io::TickStoreSource ref(store.string());
+    ref.next();
+    REQUIRE(batch.tick(0).timestamp() == ref.next()->timestamp());
+
+    std::filesystem::remove(csv);
+    std::filesystem::remove(store);
+}
@@ -0,0 +1,170 @@
+#include "catch2_compat.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "fin/io/Pipeline.hpp"
+#include "fin/io/TickStore.hpp"
+
+#include "io/TestTickCsvHelpers.hpp"
+
+namespace
+{
+    std::filesystem::path temp_store(const std::string &tag)
+    {
+        return tick_csv_test::temp_path("aiquant_store_" + tag + "_", ".aqt");
+    }
+
+    // Two symbols interleaved, one malformed row, enough ticks for several M1 candles.
+    std::filesystem::path write_ticks_csv()
+    {
+        tick_csv_test::TickCsvSpec spec;
+        spec.step_ms = 1500;
+        spec.symbols = {"XYZ", "ABC", "ABC"};
+        spec.bad_every = spec.rows;
+        spec.bad_offset = 500;
+        return tick_csv_test::write_temp_ticks_csv(spec, "aiquant_store_");
+    }
+}
+
+TEST_CASE("Tick store round-trips ticks across block boundaries", "[io][store]")
+{
+    const auto csv = write_ticks_csv();
+    const auto store = temp_store("rt");
+
+    std::vector<fin::core::Tick> expected;
+    {
+        fin::io::MmapTickSource src(csv.string());
+        fin::io::TickStoreWriter w(store.string(), 64); // small blocks => many + a partial tail
+        while (auto t = src.next())
+        {
+            expected.push_back(*t);
+            w.append(*t);
+        }
+        w.finish();
+        REQUIRE(w.symbols() == 2u);
+    }
+
+    REQUIRE(fin::io::is_tick_store_file(store.string()));
+    REQUIRE(!fin::io::is_tick_store_file(csv.string()));
+
+    fin::io::TickStoreSource src(store.string());
+    REQUIRE(src.size() == expected.size());
+    std::size_t i = 0;
+    while (auto t = src.next())
+    {
+        REQUIRE(i < expected.size());
+        REQUIRE(t->timestamp() == expected[i].timestamp());
+        REQUIRE(t->symbol() == expected[i].symbol());
+        REQUIRE(t->price().value() == expected[i].price().value());
+        REQUIRE(t->volume().value() == expected[i].volume().value());
+        ++i;
+    }
+    REQUIRE(i == expected.size());
+    REQUIRE(src.stats().parsed == expected.size());
+    REQUIRE(src.stats().skipped == 0u);
+
+    std::filesystem::remove(csv);
+    std::filesystem::remove(store);
+}
+
+TEST_CASE("Converted tick store resamples like the CSV", "[io][store]")
+{
+    const auto csv = write_ticks_csv();
+    const auto store = temp_store("conv");
+
+    fin::io::ParallelIngestOptions popt{};
+    popt.threads = 2;
+    auto stats = fin::io::convert_csv_to_tick_store(csv.string(), store.string(), {}, popt);
+    REQUIRE(stats.parsed == 1000u);
+    REQUIRE(stats.skipped == 1u);
+
+    auto a = fin::io::resample_ticks_with_stats(csv.string(), fin::io::Timeframe::M1);
+    auto b = fin::io::resample_ticks_with_stats(store.string(), fin::io::Timeframe::M1);
+    REQUIRE(a.candles.size() == b.candles.size());
+    REQUIRE(b.stats.parsed == a.stats.parsed);
+    for (std::size_t i = 0; i < a.candles.size(); ++i)
+    {
+        REQUIRE(a.candles[i].start_time() == b.candles[i].start_time());
+        REQUIRE(a.candles[i].close().value() == b.candles[i].close().value());
+        REQUIRE(a.candles[i].volume().value() == b.candles[i].volume().value());
+    }
+
+    std::filesystem::remove(csv);
+    std::filesystem::remove(store);
+}
+
+TEST_CASE("Tick store reader rejects corrupt files and tolerates missing ones", "[io][store]")
+{
+    fin::io::TickStoreSource missing("definitely_missing_store.aqt");
+    REQUIRE(!missing.next().has_value());
+
+    const auto bad = temp_store("bad");
+    {
+        std::ofstream out(bad, std::ios::binary);
+        out.write(fin::io::kTickStoreMagic, sizeof(fin::io::kTickStoreMagic));
+        out << "short";
+    }
+    bool threw = false;
+    try
+    {
+        fin::io::TickStoreSource src(bad.string());
+    }
+    catch (const std::runtime_error &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+    std::filesystem::remove(bad);
+}
+
+TEST_CASE("Tick store converter refuses a missing CSV", "[io][store]")
+{
+    const auto store = temp_store("missing");
+    bool threw = false;
+    try
+    {
+        fin::io::convert_csv_to_tick_store("/nonexistent/aiquant_ticks.csv", store.string());
+    }
+    catch (const std::runtime_error &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+    REQUIRE(!std::filesystem::exists(store));
+}
+
+TEST_CASE("Tick store writer removes its file when aborted or unwound", "[io][store]")
+{
+    const fin::core::Tick t(fin::core::Timestamp(std::chrono::seconds(1)), fin::core::Symbol("ABC"),
+                            fin::core::Price(100.0), fin::core::Volume(1.0));
+
+    const auto unwound = temp_store("unwound");
+    bool threw = false;
+    try
+    {
+        fin::io::TickStoreWriter w(unwound.string(), 4);
+        for (int i = 0; i < 10; ++i)
+            w.append(t);
+        throw std::runtime_error("input failed partway");
+    }
+    catch (const std::runtime_error &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+    REQUIRE(!std::filesystem::exists(unwound));
+
+    const auto aborted = temp_store("aborted");
+    {
+        fin::io::TickStoreWriter w(aborted.string());
+        w.append(t);
+        w.abort();
+        w.finish(); // no-op after abort
+    }
+    REQUIRE(!std::filesystem::exists(aborted));
+}
@@ -0,0 +1,157 @@
+#include "catch2_compat.hpp"
+
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+#include "fin/core/CandleSeries.hpp"
+#include "fin/io/MultiTimeframeResampler.hpp"
+#include "fin/io/Resampler.hpp"
+#include "fin/io/Timeframe.hpp"
+
+using namespace fin::io;
+using namespace std::chrono;
+
+namespace
+{
+    std::vector<fin::core::Tick> make_ticks(std::size_t n, long long step_ms)
+    {
+        std::vector<fin::core::Tick> ticks;
+        const fin::core::Symbol sym("TF");
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const long long ms = 1693492800000LL + 77 + static_cast<long long>(i) * step_ms - ((i % 101 == 50) ? 3 * step_ms : 0);
+            ticks.emplace_back(fin::core::Timestamp(milliseconds(ms)), sym, fin::core::Price(50.0 + static_cast<double>(i % 37)),
+                               fin::core::Volume(1.0 + static_cast<double>(i % 3)));
+        }
+        return ticks;
+    }
+
+    template <class Resampler>
+    fin::core::CandleSeries run(Resampler &res, const std::vector<fin::core::Tick> &ticks)
+    {
+        fin::core::CandleSeries out;
+        for (const auto &t : ticks)
+            res.update(t, out);
+        res.flush(out);
+        return out;
+    }
+
+    // Brute force: bucket = floor(ts / width), late ticks dropped.
+    std::vector<long long> expected_bucket_starts(const std::vector<fin::core::Tick> &ticks, nanoseconds width)
+    {
+        std::vector<long long> starts;
+        auto last = fin::core::Timestamp::min();
+        for (const auto &t : ticks)
+        {
+            if (t.timestamp() < last)
+                continue;
+            last = t.timestamp();
+            const long long ns = t.timestamp().time_since_epoch().count();
+            const long long start = ns - ns % width.count();
+            if (starts.empty() || starts.back() != start)
+                starts.push_back(start);
+        }
+        return starts;
+    }
+}
+
+TEST_CASE("Timeframe tokens parse and print", "[io][timeframe]")
+{
+    REQUIRE(parse_timeframe("M1") == Timeframe::M1);
+    REQUIRE(parse_timeframe("h1") == Timeframe::H1);
+    REQUIRE(parse_timeframe("5m") == Timeframe::M5);
+    REQUIRE(parse_timeframe(" 250ms ")->duration() == milliseconds(250));
+    REQUIRE(parse_timeframe("15s")->duration() == seconds(15));
+    REQUIRE(parse_timeframe("H4")->duration() == hours(4));
+    REQUIRE(parse_timeframe("1D")->duration() == hours(24));
+
+    for (const char *bad : {"", "M", "M0", "0s", "15", "15x", "X1", "1.5h", "-5m", "400d", "M1x"})
+        REQUIRE_FALSE(parse_timeframe(bad).has_value());
+
+    REQUIRE(to_string(Timeframe::S5) == "S5");
+    REQUIRE(to_string(Timeframe::H1) == "H1");
+    REQUIRE(to_string(Timeframe(minutes(60))) == "H1");
+    REQUIRE(to_string(Timeframe(seconds(90))) == "S90");
+    REQUIRE(to_string(Timeframe(milliseconds(250))) == "250ms");
+    REQUIRE(to_string(Timeframe(hours(48))) == "D2");
+    for (const char *token : {"250ms", "S15", "M15", "H4", "D1", "1500us", "7ns"})
+        REQUIRE(to_string(*parse_timeframe(token)) == token);
+
+    static_assert(Timeframe::M1 < Timeframe::M5 && Timeframe() == Timeframe::M1);
+}
+
+TEST_CASE("Arbitrary widths bucket on multiples of the width", "[io][timeframe]")
+{
+    const auto ticks = make_ticks(40000, 90); // ~1 hour
+    for (const char *token : {"250ms", "15s", "M15", "4h", "D1"})
+    {
+        const Timeframe tf = *parse_timeframe(token);
+        TickToCandleResampler res(tf);
+        REQUIRE(res.timeframe() == tf);
+        const auto bars = run(res, ticks);
+        const auto starts = expected_bucket_starts(ticks, tf.duration());
+        REQUIRE(bars.size() == starts.size());
+        for (std::size_t i = 0; i < starts.size(); ++i)
+            REQUIRE(bars.view().ts[i].time_since_epoch().count() == starts[i]);
+    }
+
+    bool threw = false;
+    try
+    {
+        TickToCandleResampler zero(Timeframe(nanoseconds::zero()));
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+
+    // Cascading still needs nested widths: 15s -> M1 works, 7s -> M1 does not.
+    MultiTimeframeResampler nested({*parse_timeframe("15s"), Timeframe::M1});
+    threw = false;
+    try
+    {
+        MultiTimeframeResampler bad({*parse_timeframe("7s"), Timeframe::M1});
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+}
+
+TEST_CASE("Compile-time widths match the run-time resampler", "[io][timeframe]")
+{
+    const auto ticks = make_ticks(20000, 330);
+
+    StaticTickToCandleResampler<duration<std::int64_t, std::ratio<15>>> fixed;
+    TickToCandleResampler dynamic(*parse_timeframe("15s"));
+    REQUIRE(fixed.timeframe() == dynamic.timeframe());
+    const auto a = run(fixed, ticks);
+    const auto b = run(dynamic, ticks);
+    REQUIRE(a.size() == b.size());
+    const auto av = a.view(), bv = b.view();
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        REQUIRE(av.ts[i] == bv.ts[i]);
+        REQUIRE(av.open[i] == bv.open[i]);
+        REQUIRE(av.high[i] == bv.high[i]);
+        REQUIRE(av.low[i] == bv.low[i]);
+        REQUIRE(av.close[i] == bv.close[i]);
+        REQUIRE(av.volume[i] == bv.volume[i]);
+    }
+
+    // Candle-returning path and the FixedPrice instantiation compile too.
+    StaticTickToCandleResampler<minutes> m1;
+    std::size_t emitted = 0;
+    for (const auto &t : ticks)
+        if (m1.update(t))
+            ++emitted;
+    REQUIRE(m1.flush().has_value());
+    TickToCandleResampler ref(Timeframe::M1);
+    REQUIRE(emitted + 1 == run(ref, ticks).size());
+
+    StaticTickToCandleResampler<minutes, fin::core::FixedPrice> fixed_m1;
+    REQUIRE_FALSE(fixed_m1.flush().has_value());
+}
@@ -2,6 +2,8 @@
 
 #include <filesystem>
 #include <fstream>
+#include <stdexcept>
+#include <string>
 #include <vector>
 #include "fin/ml/FeatureVector.hpp"
 #include "fin/ml/LinearModel.hpp"
@@ -183,3 +185,74 @@ TEST_CASE("LinearTrainer saves and reloads models", "[ml][linear]")
 
     std::filesystem::remove(temp_path);
 }
+
+TEST_CASE("LinearModel bind and predict_batch match predict", "[ml][linear]")
+{
+    const std::vector<FeatureRow> rows = {
+        {fin::core::Timestamp{}, 100.0, 101.0, 60.0, 1.5, 1.2, 0.3},
+        {fin::core::Timestamp{}, 99.0, 100.5, 45.0, -0.5, 0.1, -0.6},
+        {fin::core::Timestamp{}, 102.0, 100.0, 71.0, 2.0, 1.0, 1.0}};
+    fin::core::FeatureMatrix matrix(fin::indicators::FeatureBus::schema());
+    for (const auto &row : rows)
+        matrix.append(row.ts, FeatureVector::feature_row_values(row));
+
+    LinearModel named;
+    named.set_named_weights({{"macd", 1.0}, {"unknown", 5.0}, {"close", 0.05}}, 0.1);
+    LinearModel positional({0.01, -0.02, 0.03, 0.5, -0.1, 0.2}, -1.0);
+
+    for (LinearModel *model : {&named, &positional})
+    {
+        model->bind(*matrix.schema());
+        REQUIRE(model->is_bound());
+        std::vector<double> out(rows.size()), flat(rows.size());
+        model->predict_batch(matrix.view(), out);
+        model->predict_batch(matrix.values(), flat);
+        for (std::size_t i = 0; i < rows.size(); ++i)
+        {
+            const double expected = model->predict(FeatureVector::from_feature_row(rows[i]));
+            REQUIRE(out[i] == Approx(expected).margin(1e-12));
+            REQUIRE(flat[i] == out[i]);
+            REQUIRE(model->predict_row(FeatureVector::feature_row_values(rows[i])) == Approx(expected).margin(1e-12));
+        }
+    }
+
+    // New weights re-resolve an existing binding.
+    named.set_named_weights({{"rsi", 2.0}}, 0.0);
+    REQUIRE(named.predict_row(FeatureVector::feature_row_values(rows[0])) == Approx(120.0).margin(1e-12));
+
+    bool threw = false;
+    try
+    {
+        std::vector<double> out(2);
+        named.predict_batch(matrix.view(), out);
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+
+    threw = false;
+    try
+    {
+        const std::vector<std::string> narrow = {"close", "rsi"};
+        positional.bind(narrow);
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+
+    threw = false;
+    try
+    {
+        LinearModel unbound({1.0}, 0.0);
+        (void)unbound.predict_row(std::vector<double>{1.0});
+    }
+    catch (const std::logic_error &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+}
@@ -0,0 +1,92 @@
+#include "catch2_compat.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "fin/ml/LinearSolve.hpp"
+#include "fin/ml/RidgeAccumulator.hpp"
+
+namespace
+{
+    // B^T B + n I with B uniform in [-1, 1]: symmetric positive definite.
+    std::vector<double> make_spd(std::size_t n, unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> u(-1.0, 1.0);
+        std::vector<double> B(n * n);
+        for (auto &v : B)
+            v = u(rng);
+        std::vector<double> A(n * n, 0.0);
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                double s = 0.0;
+                for (std::size_t k = 0; k < n; ++k)
+                    s += B[k * n + i] * B[k * n + j];
+                A[i * n + j] = s + (i == j ? static_cast<double>(n) : 0.0);
+            }
+        return A;
+    }
+
+    std::vector<double> multiply(const std::vector<double> &A, const std::vector<double> &x)
+    {
+        const std::size_t n = x.size();
+        std::vector<double> b(n, 0.0);
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j < n; ++j)
+                b[i] += A[i * n + j] * x[j];
+        return b;
+    }
+}
+
+TEST_CASE("Cholesky and QR solve SPD systems across block boundaries", "[ml][solve]")
+{
+    const std::size_t n = 150; // spans three 64-column panels
+    const auto A = make_spd(n, 7);
+    std::vector<double> x(n);
+    for (std::size_t i = 0; i < n; ++i)
+        x[i] = std::sin(static_cast<double>(i));
+    const auto b = multiply(A, x);
+
+    auto chol_A = A;
+    auto chol_b = b;
+    REQUIRE(fin::ml::cholesky_solve(chol_A, chol_b));
+
+    auto qr_A = A;
+    auto qr_b = b;
+    REQUIRE(fin::ml::qr_solve(qr_A, qr_b));
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        REQUIRE(chol_b[i] == Approx(x[i]).margin(1e-9));
+        REQUIRE(qr_b[i] == Approx(x[i]).margin(1e-9));
+    }
+}
+
+TEST_CASE("solve_spd falls back to QR for indefinite or singular systems", "[ml][solve]")
+{
+    // Indefinite: Cholesky rejects it, QR solves it.
+    std::vector<double> A = {1.0, 2.0, 2.0, 1.0};
+    std::vector<double> b = {3.0, 3.0};
+    auto chol_A = A;
+    auto chol_b = b;
+    REQUIRE_FALSE(fin::ml::cholesky_solve(chol_A, chol_b));
+    REQUIRE(fin::ml::solve_spd(A, b));
+    REQUIRE(b[0] == Approx(1.0).margin(1e-12));
+    REQUIRE(b[1] == Approx(1.0).margin(1e-12));
+
+    // Collinear features without ridge: the fit still reproduces y.
+    fin::ml::RidgeAccumulator acc(3);
+    for (int i = 0; i < 20; ++i)
+    {
+        const double a = static_cast<double>(i), c = static_cast<double>(i % 4);
+        const std::vector<double> x = {a, c, a + c};
+        acc.add_sample(x, 1.0 + 2.0 * a - c);
+    }
+    const auto fit = acc.solve(0.0);
+    REQUIRE(acc.sse(fit) == Approx(0.0).margin(1e-8));
+
+    std::vector<double> zero(4, 0.0), rhs(2, 1.0);
+    REQUIRE_FALSE(fin::ml::qr_solve(zero, rhs));
+}
@@ -0,0 +1,113 @@
+#include "catch2_compat.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+#include "fin/ml/FeatureVector.hpp"
+#include "fin/ml/LinearModel.hpp"
+#include "fin/ml/RidgeAccumulator.hpp"
+
+namespace
+{
+    // y = 0.5 + 2 x0 - x1 + noise-free
+    std::vector<std::vector<double>> make_inputs(std::size_t n)
+    {
+        std::vector<std::vector<double>> xs;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double t = static_cast<double>(i);
+            xs.push_back({0.1 * t + 1.0, (i % 7) * 0.3 - 0.2 * (i % 3)});
+        }
+        return xs;
+    }
+
+    double target_of(const std::vector<double> &x)
+    {
+        return 0.5 + 2.0 * x[0] - x[1];
+    }
+}
+
+TEST_CASE("RidgeAccumulator recovers weights and drops removed samples", "[ml][ridge]")
+{
+    const auto xs = make_inputs(64);
+
+    fin::ml::RidgeAccumulator acc(2);
+    for (const auto &x : xs)
+        acc.add_sample(x, target_of(x));
+    REQUIRE(acc.samples() == 64u);
+
+    const auto fit = acc.solve(0.0);
+    REQUIRE(fit.weights[0] == Approx(2.0).margin(1e-9));
+    REQUIRE(fit.weights[1] == Approx(-1.0).margin(1e-9));
+    REQUIRE(fit.bias == Approx(0.5).margin(1e-9));
+    REQUIRE(acc.sse(fit) == Approx(0.0).margin(1e-8));
+
+    // Rolling window: slide a 16-sample window and compare with a fresh fit.
+    fin::ml::RidgeAccumulator rolling(2);
+    const std::size_t window = 16;
+    std::vector<double> ys;
+    for (std::size_t i = 0; i < xs.size(); ++i)
+    {
+        // A disturbance that only the removed samples carry.
+        ys.push_back(target_of(xs[i]) + (i < 40 ? 0.25 * static_cast<double>(i % 5) : 0.0));
+        rolling.add_sample(xs[i], ys[i]);
+        if (rolling.samples() > window)
+            rolling.remove_sample(xs[i - window], ys[i - window]);
+    }
+    REQUIRE(rolling.samples() == window);
+
+    fin::ml::RidgeAccumulator fresh(2);
+    for (std::size_t i = xs.size() - window; i < xs.size(); ++i)
+        fresh.add_sample(xs[i], ys[i]);
+    const auto a = rolling.solve(1e-6);
+    const auto b = fresh.solve(1e-6);
+    REQUIRE(a.weights[0] == Approx(b.weights[0]).margin(1e-7));
+    REQUIRE(a.weights[1] == Approx(b.weights[1]).margin(1e-7));
+    REQUIRE(a.bias == Approx(b.bias).margin(1e-7));
+
+    rolling.clear();
+    REQUIRE(rolling.empty());
+    bool threw = false;
+    try
+    {
+        rolling.remove_sample(xs[0], 1.0);
+    }
+    catch (const std::logic_error &)
+    {
+        threw = true;
+    }
+    REQUIRE(threw);
+}
+
+TEST_CASE("LinearModel partial_fit converges to the batch fit", "[ml][ridge]")
+{
+    const auto xs = make_inputs(40);
+    std::vector<fin::ml::FeatureVector> features;
+    std::vector<double> targets;
+    const auto schema = fin::core::FeatureSchema::make({"a", "b"});
+    for (const auto &x : xs)
+    {
+        fin::ml::FeatureVector fv;
+        fv.schema = schema;
+        fv.values = x;
+        features.push_back(fv);
+        targets.push_back(target_of(x));
+    }
+
+    fin::ml::LinearModel online;
+    for (std::size_t i = 0; i < features.size(); ++i)
+    {
+        online.partial_fit(features[i], targets[i]);
+        REQUIRE(online.is_ready() == (i >= 2));
+    }
+
+    fin::ml::LinearModel batch;
+    batch.fit(features, targets);
+    REQUIRE(batch.named_weights().size() == 2u);
+    REQUIRE(online.predict(features[5]) == Approx(batch.predict(features[5])).margin(1e-9));
+    REQUIRE(online.named_weights()[0].second == Approx(2.0).margin(1e-5));
+    REQUIRE(online.bias() == Approx(0.5).margin(1e-4));
+
+    online.reset();
+    REQUIRE_FALSE(online.is_ready());
+}